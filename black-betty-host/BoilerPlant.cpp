@@ -0,0 +1,49 @@
+#include "BoilerPlant.h"
+
+BoilerPlant::Parameters BoilerPlant::default_parameters() {
+    Parameters parameters;
+    parameters.heater_power = 1300.0;
+    parameters.plate_capacity = 180.0;
+    parameters.boiler_capacity = 850.0;
+    parameters.plate_to_boiler = 18.0;
+    parameters.boiler_to_ambient = 1.1;
+    parameters.ambient_temperature = 20.0;
+    parameters.sensor_lag = 2.0;
+    return parameters;
+}
+
+BoilerPlant::BoilerPlant() : BoilerPlant(default_parameters()) {
+}
+
+BoilerPlant::BoilerPlant(const Parameters& parameters) : parameters(parameters), draw(0.0), energy(0.0) {
+    this->reset(parameters.ambient_temperature);
+}
+
+void BoilerPlant::reset(double temperature) {
+    this->plate_temperature = temperature;
+    this->boiler_temperature = temperature;
+    this->sensor_temperature = temperature;
+    this->energy = 0.0;
+}
+
+void BoilerPlant::step(bool heater_on, double seconds) {
+    const Parameters& p = this->parameters;
+    const double heater = heater_on ? p.heater_power : 0.0;
+    const double plate_flow = p.plate_to_boiler * (this->plate_temperature - this->boiler_temperature);
+    const double ambient_flow = (p.boiler_to_ambient + this->draw) * (this->boiler_temperature - p.ambient_temperature);
+
+    this->plate_temperature += (heater - plate_flow) / p.plate_capacity * seconds;
+    this->boiler_temperature += (plate_flow - ambient_flow) / p.boiler_capacity * seconds;
+    this->sensor_temperature += (this->boiler_temperature - this->sensor_temperature) * (seconds / (p.sensor_lag + seconds));
+    this->energy += heater * seconds;
+}
+
+void BoilerPlant::draw_water(double joule_per_kelvin_per_second) {
+    this->draw = joule_per_kelvin_per_second;
+}
+
+double BoilerPlant::get_plate_temperature() const { return this->plate_temperature; }
+double BoilerPlant::get_boiler_temperature() const { return this->boiler_temperature; }
+double BoilerPlant::get_sensor_temperature() const { return this->sensor_temperature; }
+double BoilerPlant::get_energy() const { return this->energy; }
+const BoilerPlant::Parameters& BoilerPlant::get_parameters() const { return this->parameters; }
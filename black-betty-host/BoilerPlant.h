@@ -0,0 +1,45 @@
+#pragma once
+
+/*
+    Thermal model of the heater plate and the boiler. The heater element heats the plate, the plate heats
+    the boiler and the boiler loses heat to the ambient air. The sensor sits on the boiler and follows it
+    with a first order lag. Simple explicit euler integration, stable for steps well below one second.
+*/
+class BoilerPlant {
+public:
+    struct Parameters {
+        double heater_power;          // W
+        double plate_capacity;        // J/K
+        double boiler_capacity;       // J/K
+        double plate_to_boiler;       // W/K
+        double boiler_to_ambient;     // W/K
+        double ambient_temperature;   // °C
+        double sensor_lag;            // s
+    };
+
+    // Roughly a Gaggia Classic: 1300 W element, aluminium boiler with ~100 ml water
+    static Parameters default_parameters();
+
+    BoilerPlant();
+    explicit BoilerPlant(const Parameters& parameters);
+
+    void reset(double temperature);
+    void step(bool heater_on, double seconds);
+
+    // Draw water from the boiler, replacing it with water at ambient temperature (brewing)
+    void draw_water(double joule_per_kelvin_per_second);
+
+    double get_plate_temperature() const;
+    double get_boiler_temperature() const;
+    double get_sensor_temperature() const;
+    double get_energy() const;
+    const Parameters& get_parameters() const;
+
+private:
+    Parameters parameters;
+    double plate_temperature;
+    double boiler_temperature;
+    double sensor_temperature;
+    double draw;
+    double energy;
+};
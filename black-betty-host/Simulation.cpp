@@ -0,0 +1,46 @@
+#include "Simulation.h"
+
+#include <Arduino.h>
+#include <HostBoard.h>
+
+#include "Settings.h"
+
+// Integration step of the plant, fine enough for the 25 ms heater cadence
+constexpr uint64_t PLANT_STEP_US = 1000;
+
+Simulation::Simulation() : Simulation(BoilerPlant::default_parameters()) {
+}
+
+Simulation::Simulation(const BoilerPlant::Parameters& parameters) : plant(parameters), loop_count(0), relay_switches(0), relay_state(false) {
+}
+
+void Simulation::begin() {
+    host::set_sensor_temperature(static_cast<float>(this->plant.get_sensor_temperature()));
+    host::set_tick_handler([this](uint64_t step_us) {
+        const bool relay = host::get_pin(get_settings().relay_pin) == HIGH;
+        if (relay != this->relay_state) {
+            this->relay_state = relay;
+            this->relay_switches++;
+        }
+
+        this->plant.step(relay, static_cast<double>(step_us) / 1000000.0);
+        host::set_sensor_temperature(static_cast<float>(this->plant.get_sensor_temperature()));
+    }, PLANT_STEP_US);
+
+    setup();
+}
+
+void Simulation::run_for(unsigned long ms, const std::function<void()>& after_loop) {
+    const uint64_t end = host::now_us() + static_cast<uint64_t>(ms) * 1000;
+    while (host::now_us() < end) {
+        loop();
+        this->loop_count++;
+        if (after_loop) {
+            after_loop();
+        }
+    }
+}
+
+BoilerPlant& Simulation::get_plant() { return this->plant; }
+unsigned long Simulation::get_loop_count() const { return this->loop_count; }
+unsigned long Simulation::get_relay_switches() const { return this->relay_switches; }
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <functional>
+
+#include "BoilerPlant.h"
+
+/*
+    Runs the unmodified sketch (setup/loop) against the plant model on the simulated clock. The relay pin
+    drives the heater of the plant and the plant drives the ADT7410 stand-in. Since time only advances in
+    delay(), a simulated hour takes well below a second on a workstation.
+
+    The firmware uses singletons, so there can only be one simulation per process.
+*/
+class Simulation {
+public:
+    Simulation();
+    explicit Simulation(const BoilerPlant::Parameters& parameters);
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    // Runs setup() of the sketch and connects the plant to the relay pin and the sensor
+    void begin();
+
+    // Runs loop() until the simulated clock advanced by the given time, the callback runs after every loop()
+    void run_for(unsigned long ms, const std::function<void()>& after_loop = nullptr);
+
+    BoilerPlant& get_plant();
+    unsigned long get_loop_count() const;
+    unsigned long get_relay_switches() const;
+
+private:
+    BoilerPlant plant;
+    unsigned long loop_count;
+    unsigned long relay_switches;
+    bool relay_state;
+};
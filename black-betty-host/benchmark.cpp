@@ -0,0 +1,237 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+#include <HostBoard.h>
+#include <TM1637Display.h>
+#include <ESP8266WebServer.h>
+
+#include "Simulation.h"
+#include "util.h"
+#include "Settings.h"
+#include "Status.h"
+#include "HeaterPID.h"
+#include "TemperatureSensor.h"
+#include "WebServer.h"
+#include "CommandParser.h"
+
+/*
+    Measures every stage of loop() on the host and prints min/median/p99/max in nanoseconds per call.
+
+    Usage: black-betty-bench [-n samples] [-o baseline.csv] [-b baseline.csv] [-r percent]
+    -o writes the result as csv, -b compares against a stored csv and fails if a median or p99 got
+    slower by more than -r percent (default 50). The plant is warmed up first, so the heater pid is
+    regulating around the setpoint while measuring. Every stage advances the simulated clock by its
+    loop() cadence between two samples.
+*/
+
+extern ESP8266WebServer server;
+
+static size_t json_sink_size = 0;
+static void json_sink(const char* data, size_t size) {
+    json_sink_size += size;
+}
+
+struct StageResult {
+    std::string name;
+    size_t samples;
+    double min;
+    double median;
+    double p99;
+    double max;
+};
+
+struct Stage {
+    const char* name;
+    unsigned long cadence;
+    int repeat;
+    std::function<void()> run;
+};
+
+static StageResult measure(const Stage& stage, size_t samples) {
+    std::vector<double> values;
+    values.reserve(samples);
+
+    for (size_t index = 0; index < samples; index++) {
+        if (stage.cadence > 0) {
+            delay(stage.cadence);
+        }
+
+        const uint64_t start = host::cycle_count();
+        for (int count = 0; count < stage.repeat; count++) {
+            stage.run();
+        }
+        values.push_back(static_cast<double>(host::cycle_count() - start) / static_cast<double>(stage.repeat));
+    }
+
+    std::sort(values.begin(), values.end());
+    StageResult result;
+    result.name = stage.name;
+    result.samples = samples;
+    result.min = values.front();
+    result.median = values[samples / 2];
+    result.p99 = values[std::min(samples - 1, (samples * 99) / 100)];
+    result.max = values.back();
+    return result;
+}
+
+static bool write_csv(const char* filename, const std::vector<StageResult>& results) {
+    FILE* file = fopen(filename, "w");
+    if (file == nullptr) {
+        fprintf(stderr, "Unable to write %s\n", filename);
+        return false;
+    }
+
+    fprintf(file, "stage,samples,min_ns,median_ns,p99_ns,max_ns\n");
+    for (const StageResult& result : results) {
+        fprintf(file, "%s,%zu,%.1f,%.1f,%.1f,%.1f\n", result.name.c_str(), result.samples, result.min, result.median, result.p99, result.max);
+    }
+
+    fclose(file);
+    return true;
+}
+
+static bool read_csv(const char* filename, std::vector<StageResult>& results) {
+    FILE* file = fopen(filename, "r");
+    if (file == nullptr) {
+        fprintf(stderr, "Unable to read %s\n", filename);
+        return false;
+    }
+
+    char line[256];
+    char name[64];
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        StageResult result;
+        if (sscanf(line, "%63[^,],%zu,%lf,%lf,%lf,%lf", name, &result.samples, &result.min, &result.median, &result.p99, &result.max) == 6) {
+            result.name = name;
+            results.push_back(result);
+        }
+    }
+
+    fclose(file);
+    return true;
+}
+
+// Returns false if any stage regressed by more than the allowed percentage
+static bool compare(const std::vector<StageResult>& results, const std::vector<StageResult>& baseline, double percent) {
+    bool success = true;
+    const double limit = 1.0 + percent / 100.0;
+
+    printf("\n%-24s %12s %12s\n", "stage", "median", "p99");
+    for (const StageResult& result : results) {
+        auto found = std::find_if(baseline.begin(), baseline.end(), [&](const StageResult& item) { return item.name == result.name; });
+        if (found == baseline.end()) {
+            printf("%-24s %12s %12s\n", result.name.c_str(), "new", "new");
+            continue;
+        }
+
+        const double median = found->median > 0.0 ? result.median / found->median : 1.0;
+        const double p99 = found->p99 > 0.0 ? result.p99 / found->p99 : 1.0;
+        const bool regressed = median > limit || p99 > limit;
+        success = success && !regressed;
+        printf("%-24s %11.2fx %11.2fx%s\n", result.name.c_str(), median, p99, regressed ? "  REGRESSION" : "");
+    }
+
+    return success;
+}
+
+int main(int argc, char** argv) {
+    size_t samples = 20000;
+    const char* output = nullptr;
+    const char* baseline = nullptr;
+    double percent = 50.0;
+
+    for (int index = 1; index < argc; index++) {
+        if (strcmp(argv[index], "-n") == 0 && index + 1 < argc) {
+            samples = std::max<size_t>(100, strtoul(argv[++index], nullptr, 10));
+        } else if (strcmp(argv[index], "-o") == 0 && index + 1 < argc) {
+            output = argv[++index];
+        } else if (strcmp(argv[index], "-b") == 0 && index + 1 < argc) {
+            baseline = argv[++index];
+        } else if (strcmp(argv[index], "-r") == 0 && index + 1 < argc) {
+            percent = atof(argv[++index]);
+        } else {
+            fprintf(stderr, "Usage: %s [-n samples] [-o baseline.csv] [-b baseline.csv] [-r percent]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    // Bring up the sketch with a connected (simulated) wifi, so the web routes are registered
+    host::serial_mute(true);
+    get_settings().validate_set_wifi("bench", "ssid", "password");
+    WiFi.set_status(WL_CONNECTED);
+
+    Simulation simulation;
+    simulation.begin();
+    simulation.run_for(300000);
+
+    Status& status = get_status();
+    HeaterPID& heater = get_heater();
+    const Settings& settings = get_settings();
+    TemperatureSensor& sensor = get_temperature_sensor();
+    SensorSample sample;
+    sensor.get(0, sample);
+    TM1637Display display(settings.display_clock_pin, settings.display_dio_pin);
+    unsigned long start = millis();
+
+    char json[256];
+    char number[32];
+    char token_buffer[256];
+    char* token[8];
+    char command[64];
+    snprintf(command, sizeof(command), "token %d set heater.low %.1f", get_command_parser().get_security_token(), settings.heater_temperature_low);
+
+    const std::vector<Stage> stages = {
+        { "loop", 0, 1, [&]() { simulation.run_for(1); } },
+        { "console", 15, 1, [&]() { get_command_parser().update(); } },
+        { "console.command", 15, 1, [&]() { host::serial_input("get heater.low\n"); get_command_parser().update(); } },
+        { "sensor", 5, 1, [&]() { sensor.update(); } },
+        { "heater.compute", 240, 1, [&]() { heater.compute(sample); } },
+        { "display", 30, 1, [&]() {
+            const int value = static_cast<int>(status.temperature * 10.0);
+            if (status.display_needs_update(value, heater.is_active())) {
+                display.showNumberDecEx(value, heater.is_active() ? 0b10100000 : 0b00100000, false, 4, 0);
+            }
+        } },
+        { "webserver.serve", 50, 1, [&]() { get_webserver().serve(); } },
+        { "webserver.status", 50, 1, [&]() { server.host_request(HTTP_GET, "/status"); } },
+        { "webserver.command", 50, 1, [&]() { server.host_request(HTTP_POST, "/command", command); } },
+        { "create_status_json", 50, 1, [&]() {
+            JsonStream stream(json, array_size(json), json_sink);
+            WebServer::create_status_json(stream, -1);
+            stream.flush();
+        } },
+        { "webserver.metrics", 50, 1, [&]() { server.host_request(HTTP_GET, "/metrics"); } },
+        { "webserver.status.bin", 50, 1, [&]() { server.host_request(HTTP_GET, "/status.bin"); } },
+        { "send_status", 0, 1, [&]() { status.sendStatus(); } },
+        { "update_history", 5, 1, [&]() { status.update_history(status.temperature, heater.get_output(), heater.is_active(), millis() - start); } },
+        { "tokenize", 0, 16, [&]() { tokenize(command, token_buffer, array_size(token_buffer), token, array_size(token)); } },
+        { "json_add(double)", 0, 16, [&]() { *json_add(number, status.temperature) = 0x00; } },
+    };
+
+    std::vector<StageResult> results;
+    printf("%-24s %8s %10s %10s %10s %10s\n", "stage [ns]", "samples", "min", "median", "p99", "max");
+    for (const Stage& stage : stages) {
+        StageResult result = measure(stage, samples);
+        printf("%-24s %8zu %10.1f %10.1f %10.1f %10.1f\n", result.name.c_str(), result.samples, result.min, result.median, result.p99, result.max);
+        results.push_back(result);
+    }
+
+    if (output != nullptr && !write_csv(output, results)) {
+        return 1;
+    }
+
+    if (baseline != nullptr) {
+        std::vector<StageResult> stored;
+        if (!read_csv(baseline, stored) || !compare(results, stored, percent)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,250 @@
+#include "Arduino.h"
+#include "HostBoard.h"
+#include "EEPROM.h"
+#include "flash_hal.h"
+
+#include <stdarg.h>
+#include <strings.h>
+#include <chrono>
+#include <deque>
+
+HardwareSerial Serial;
+EspClass ESP;
+EEPROMClass EEPROM;
+const String emptyString;
+
+namespace {
+    uint64_t simulated_us = 0;
+    uint64_t tick_us = 1000;
+    uint64_t next_tick_us = 0;
+    std::function<void(uint64_t)> tick_handler;
+
+    timercallback timer1_callback = nullptr;
+    bool timer1_enabled = false;
+    bool timer1_loop = false;
+    uint8_t timer1_divider = TIM_DIV1;
+    uint64_t timer1_period_us = 0;
+    uint64_t timer1_next_us = 0;
+
+    constexpr uint64_t NEVER = UINT64_MAX;
+
+    int pins[64] = {};
+    float sensor_temperature = 20.0f;
+
+    uint8_t flash[FS_PHYS_SIZE];
+    unsigned long flash_erase_count = 0;
+
+    std::deque<char> serial_buffer;
+    bool serial_muted = false;
+
+    const std::chrono::steady_clock::time_point process_start = std::chrono::steady_clock::now();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Host board control
+uint64_t host::now_us() {
+    return simulated_us;
+}
+
+void host::advance(uint64_t us) {
+    // Run the tick handler and timer1 interrupts in time order until the target time is reached
+    const uint64_t target = simulated_us + us;
+    for (;;) {
+        const uint64_t tick = tick_handler ? next_tick_us : NEVER;
+        const uint64_t timer = timer1_enabled && timer1_callback != nullptr ? timer1_next_us : NEVER;
+        const uint64_t next = tick < timer ? tick : timer;
+        if (next > target) {
+            break;
+        }
+
+        simulated_us = next;
+        if (next == timer) {
+            timer1_enabled = timer1_loop;
+            timer1_next_us += timer1_period_us;
+            timer1_callback();
+        }
+
+        if (next == tick) {
+            next_tick_us += tick_us;
+            tick_handler(tick_us);
+        }
+    }
+
+    simulated_us = target;
+}
+
+void host::set_tick_handler(std::function<void(uint64_t step_us)> handler, uint64_t step_us) {
+    tick_handler = handler;
+    tick_us = step_us > 0 ? step_us : 1;
+    next_tick_us = simulated_us + tick_us;
+}
+
+int host::get_pin(uint8_t pin) {
+    return pin < 64 ? pins[pin] : LOW;
+}
+
+void host::set_pin(uint8_t pin, int value) {
+    if (pin < 64) {
+        pins[pin] = value;
+    }
+}
+
+float host::get_sensor_temperature() {
+    return sensor_temperature;
+}
+
+void host::set_sensor_temperature(float value) {
+    sensor_temperature = value;
+}
+
+void host::serial_input(const char* text) {
+    while (*text != 0x00) {
+        serial_buffer.push_back(*(text++));
+    }
+}
+
+void host::serial_mute(bool mute) {
+    serial_muted = mute;
+}
+
+uint64_t host::cycle_count() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - process_start).count());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Arduino api
+unsigned long millis() { return static_cast<unsigned long>(simulated_us / 1000); }
+unsigned long micros() { return static_cast<unsigned long>(simulated_us); }
+void delay(unsigned long ms) { host::advance(static_cast<uint64_t>(ms) * 1000); }
+void delayMicroseconds(unsigned int us) { host::advance(us); }
+void yield() {}
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+void digitalWrite(uint8_t pin, uint8_t value) { host::set_pin(pin, value); }
+int digitalRead(uint8_t pin) { return host::get_pin(pin); }
+
+void timer1_isr_init() {}
+void timer1_attachInterrupt(timercallback callback) { timer1_callback = callback; }
+void timer1_detachInterrupt() { timer1_callback = nullptr; timer1_enabled = false; }
+void timer1_disable() { timer1_enabled = false; }
+
+void timer1_enable(uint8_t divider, uint8_t int_type, uint8_t reload) {
+    timer1_divider = divider;
+    timer1_loop = reload == TIM_LOOP;
+}
+
+void timer1_write(uint32_t ticks) {
+    // The timer runs with 80 MHz divided by 1, 16 or 256
+    const uint64_t divider = timer1_divider == TIM_DIV256 ? 256 : (timer1_divider == TIM_DIV16 ? 16 : 1);
+    timer1_period_us = (static_cast<uint64_t>(ticks) * divider) / 80;
+    timer1_period_us = timer1_period_us > 0 ? timer1_period_us : 1;
+    timer1_next_us = simulated_us + timer1_period_us;
+    timer1_enabled = true;
+}
+
+void wdt_disable() {}
+void wdt_enable(unsigned long timeout) {
+    // There is nothing to restart on the host, end the simulation instead of spinning forever
+    fprintf(stderr, "host: watchdog restart requested\n");
+    exit(0);
+}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    return strcasecmp(this->c_str(), other.c_str()) == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Serial
+void HardwareSerial::begin(unsigned long baud) {}
+
+int HardwareSerial::available() {
+    return static_cast<int>(serial_buffer.size());
+}
+
+int HardwareSerial::read() {
+    if (serial_buffer.empty()) {
+        return -1;
+    }
+
+    const char c = serial_buffer.front();
+    serial_buffer.pop_front();
+    return static_cast<unsigned char>(c);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (!serial_muted) {
+        fputc(c, stdout);
+    }
+    return 1;
+}
+
+size_t HardwareSerial::print(const char* value) { return this->printf("%s", value); }
+size_t HardwareSerial::print(const __FlashStringHelper* value) { return this->printf("%s", reinterpret_cast<const char*>(value)); }
+size_t HardwareSerial::print(const String& value) { return this->printf("%s", value.c_str()); }
+size_t HardwareSerial::print(char value) { return this->write(static_cast<uint8_t>(value)); }
+size_t HardwareSerial::print(int value) { return this->printf("%d", value); }
+size_t HardwareSerial::print(unsigned int value) { return this->printf("%u", value); }
+size_t HardwareSerial::print(long value) { return this->printf("%ld", value); }
+size_t HardwareSerial::print(unsigned long value) { return this->printf("%lu", value); }
+size_t HardwareSerial::print(double value, int digits) { return this->printf("%.*f", digits, value); }
+size_t HardwareSerial::println() { return this->print("\r\n"); }
+
+size_t HardwareSerial::printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int count = serial_muted ? vsnprintf(nullptr, 0, format, args) : vfprintf(stdout, format, args);
+    va_end(args);
+    return count > 0 ? static_cast<size_t>(count) : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// ESP
+uint32_t EspClass::getCycleCount() {
+    return static_cast<uint32_t>(host::cycle_count());
+}
+
+void EspClass::restart() {
+    wdt_enable(0);
+}
+
+static bool is_flash_range(uint32_t address, size_t size) {
+    return address >= FS_PHYS_ADDR && address + size <= FS_PHYS_ADDR + FS_PHYS_SIZE && address % 4 == 0 && size % 4 == 0;
+}
+
+bool EspClass::flashEraseSector(uint32_t sector) {
+    const uint32_t address = sector * FLASH_SECTOR_SIZE;
+    if (!is_flash_range(address, FLASH_SECTOR_SIZE)) {
+        return false;
+    }
+
+    memset(flash + (address - FS_PHYS_ADDR), 0xFF, FLASH_SECTOR_SIZE);
+    flash_erase_count++;
+    host::advance(host::FLASH_ERASE_US);
+    return true;
+}
+
+bool EspClass::flashWrite(uint32_t address, const uint32_t* data, size_t size) {
+    if (!is_flash_range(address, size)) {
+        return false;
+    }
+
+    const uint8_t* source = reinterpret_cast<const uint8_t*>(data);
+    for (size_t index = 0; index < size; index++) {
+        flash[address - FS_PHYS_ADDR + index] &= source[index];
+    }
+
+    return true;
+}
+
+bool EspClass::flashRead(uint32_t address, uint32_t* data, size_t size) {
+    if (!is_flash_range(address, size)) {
+        return false;
+    }
+
+    memcpy(data, flash + (address - FS_PHYS_ADDR), size);
+    return true;
+}
+
+unsigned long host::get_flash_erase_count() {
+    return flash_erase_count;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+// Host stand-in for the ESP8266 Arduino core. Time, pins and the serial port are simulated, see HostBoard.h
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+#include <sys/pgmspace.h>
+#include "WString.h"
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x00
+#define INPUT_PULLUP 0x02
+#define OUTPUT 0x01
+
+#define WDTO_4S 4000
+
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+
+// Timer1 (the only hardware timer), simulated on the host clock
+#define TIM_DIV1 0
+#define TIM_DIV16 1
+#define TIM_DIV256 3
+#define TIM_EDGE 0
+#define TIM_LEVEL 1
+#define TIM_SINGLE 0
+#define TIM_LOOP 1
+
+class __FlashStringHelper;
+#define FPSTR(pstr_pointer) (reinterpret_cast<const __FlashStringHelper*>(pstr_pointer))
+#define F(string_literal) (FPSTR(PSTR(string_literal)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+typedef void (*timercallback)(void);
+void timer1_isr_init();
+void timer1_attachInterrupt(timercallback callback);
+void timer1_detachInterrupt();
+void timer1_enable(uint8_t divider, uint8_t int_type, uint8_t reload);
+void timer1_disable();
+void timer1_write(uint32_t ticks);
+
+// Interrupts only run while the host clock advances, there is nothing to mask
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+void wdt_disable();
+void wdt_enable(unsigned long timeout);
+
+void setup();
+void loop();
+
+class HardwareSerial {
+public:
+    void begin(unsigned long baud);
+
+    int available();
+    int read();
+
+    size_t write(uint8_t c);
+    size_t print(const char* value);
+    size_t print(const __FlashStringHelper* value);
+    size_t print(const String& value);
+    size_t print(char value);
+    size_t print(int value);
+    size_t print(unsigned int value);
+    size_t print(long value);
+    size_t print(unsigned long value);
+    size_t print(double value, int digits = 2);
+    size_t println();
+    template<typename T> size_t println(T value) { size_t count = this->print(value); return count + this->println(); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    // Real elapsed host cpu cycles (nanoseconds), not the simulated clock
+    uint32_t getCycleCount();
+    uint32_t getCpuFreqMHz() { return 1000; }
+    uint32_t getFreeHeap() { return 0xFFFF; }
+    void restart();
+
+    // Emulated NOR flash of the file system region (flash_hal.h): erase sets all bits, writes only clear bits.
+    // Addresses and sizes need to be 4 byte aligned, an erase stalls the simulated clock like the real chip
+    bool flashEraseSector(uint32_t sector);
+    bool flashWrite(uint32_t address, const uint32_t* data, size_t size);
+    bool flashRead(uint32_t address, uint32_t* data, size_t size);
+};
+
+extern EspClass ESP;
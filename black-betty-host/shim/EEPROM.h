@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Host stand-in for the ESP8266 flash emulated EEPROM. The data survives begin/end, every commit is counted
+class EEPROMClass {
+public:
+    static constexpr size_t SECTOR_SIZE = 4096;
+
+    void begin(size_t size) { this->size = size <= SECTOR_SIZE ? size : SECTOR_SIZE; }
+    bool commit() { this->commits++; return true; }
+    bool end() { bool result = this->commit(); this->size = 0; return result; }
+
+    uint8_t read(int address) const { return this->data[address]; }
+    void write(int address, uint8_t value) { this->data[address] = value; }
+    size_t length() const { return this->size; }
+
+    template<typename T> T& get(int address, T& value) {
+        memcpy(reinterpret_cast<void*>(&value), this->data + address, sizeof(T));
+        return value;
+    }
+
+    template<typename T> const T& put(int address, const T& value) {
+        memcpy(this->data + address, reinterpret_cast<const void*>(&value), sizeof(T));
+        return value;
+    }
+
+    uint8_t* getDataPtr() { return this->data; }
+    const uint8_t* getConstDataPtr() const { return this->data; }
+    unsigned long get_commit_count() const { return this->commits; }
+
+private:
+    uint8_t data[SECTOR_SIZE] = {};
+    size_t size = 0;
+    unsigned long commits = 0;
+};
+
+extern EEPROMClass EEPROM;
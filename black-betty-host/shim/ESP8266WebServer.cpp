@@ -0,0 +1,134 @@
+#include "ESP8266WebServer.h"
+
+#include <strings.h>
+
+ESP8266WiFiClass WiFi;
+
+void ESP8266WebServer::on(const String& uri, HTTPMethod method, THandlerFunction handler) {
+    // Registering the same route again replaces the handler
+    for (Route& route : this->routes) {
+        if (route.uri == uri.c_str() && route.method == method) {
+            route.handler = handler;
+            return;
+        }
+    }
+
+    this->routes.push_back({ uri.c_str(), method, handler });
+}
+
+String ESP8266WebServer::arg(const String& name) const {
+    for (const auto& arg : this->request_args) {
+        if (arg.first == name.c_str()) {
+            return String(arg.second);
+        }
+    }
+
+    return emptyString;
+}
+
+bool ESP8266WebServer::hasArg(const String& name) const {
+    for (const auto& arg : this->request_args) {
+        if (arg.first == name.c_str()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+String ESP8266WebServer::header(const String& name) const {
+    for (const auto& header : this->request_headers) {
+        if (strcasecmp(header.first.c_str(), name.c_str()) == 0) {
+            return String(header.second);
+        }
+    }
+
+    return emptyString;
+}
+
+bool ESP8266WebServer::hasHeader(const String& name) const {
+    for (const auto& header : this->request_headers) {
+        if (strcasecmp(header.first.c_str(), name.c_str()) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ESP8266WebServer::sendHeader(const String& name, const String& value, bool first) {
+    if (first) {
+        this->pending_headers.insert(this->pending_headers.begin(), { name.c_str(), value.c_str() });
+    } else {
+        this->pending_headers.push_back({ name.c_str(), value.c_str() });
+    }
+}
+
+void ESP8266WebServer::send(int code, const char* content_type, const String& content) {
+    this->send(code, content_type, content.c_str(), content.length());
+}
+
+void ESP8266WebServer::send(int code, const char* content_type, const char* content, size_t length) {
+    this->response.code = code;
+    this->response.content_type = content_type != nullptr ? content_type : "";
+    this->response.headers = this->pending_headers;
+    this->response.body.assign(content, length);
+    this->pending_headers.clear();
+}
+
+void ESP8266WebServer::sendContent(const char* content, size_t length) {
+    // Chunked content, the zero length chunk ends the response
+    this->response.body.append(content, length);
+    this->response.chunks++;
+}
+
+const ESP8266WebServer::HostResponse& ESP8266WebServer::host_request(HTTPMethod method, const char* uri, const char* body, const std::vector<std::pair<std::string, std::string>>& headers) {
+    this->response = HostResponse();
+    this->response.client = WiFiClient::host_create();
+    this->pending_headers.clear();
+    this->content_length = CONTENT_LENGTH_NOT_SET;
+    this->request_method = method;
+    this->request_headers = headers;
+    this->request_args.clear();
+
+    // Split the query string into arguments, the body is available as "plain" like on the device
+    std::string path(uri);
+    size_t query = path.find('?');
+    if (query != std::string::npos) {
+        std::string arguments = path.substr(query + 1);
+        path = path.substr(0, query);
+        size_t start = 0;
+        while (start <= arguments.size()) {
+            size_t end = arguments.find('&', start);
+            std::string pair = arguments.substr(start, end == std::string::npos ? std::string::npos : end - start);
+            size_t equal = pair.find('=');
+            if (!pair.empty()) {
+                this->request_args.push_back({ pair.substr(0, equal), equal == std::string::npos ? "" : pair.substr(equal + 1) });
+            }
+            if (end == std::string::npos) {
+                break;
+            }
+            start = end + 1;
+        }
+    }
+
+    if (body != nullptr && *body != 0x00) {
+        this->request_args.push_back({ "plain", body });
+    }
+
+    this->request_uri = String(path);
+    if (this->running) {
+        for (const Route& route : this->routes) {
+            if (route.uri == path && (route.method == HTTP_ANY || route.method == method)) {
+                route.handler();
+                return this->response;
+            }
+        }
+    }
+
+    if (this->not_found_handler) {
+        this->not_found_handler();
+    }
+
+    return this->response;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Arduino.h"
+#include "ESP8266WiFi.h"
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#define CONTENT_LENGTH_NOT_SET ((size_t) -2)
+
+/*
+    Host stand-in for the ESP8266 web server. There is no socket, requests are injected with host_request
+    and the response (including chunked content) is captured in host_response.
+*/
+class ESP8266WebServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    struct HostResponse {
+        int code = 0;
+        std::string content_type;
+        std::vector<std::pair<std::string, std::string>> headers;
+        std::string body;
+        size_t chunks = 0;
+        WiFiClient client;  // Connection of the request, handlers may keep it open (server sent events)
+    };
+
+    ESP8266WebServer(int port = 80) : port(port) {}
+
+    void begin() { this->running = true; }
+    void close() { this->running = false; }
+    void handleClient() {}
+
+    void on(const String& uri, THandlerFunction handler) { this->on(uri, HTTP_ANY, handler); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction handler);
+    void onNotFound(THandlerFunction handler) { this->not_found_handler = handler; }
+
+    WiFiClient& client() { return this->response.client; }
+    HTTPMethod method() const { return this->request_method; }
+    const String& uri() const { return this->request_uri; }
+    String arg(const String& name) const;
+    bool hasArg(const String& name) const;
+    String header(const String& name) const;
+    bool hasHeader(const String& name) const;
+    void collectHeaders(const char* header_keys[], const size_t count) {}
+
+    void sendHeader(const String& name, const String& value, bool first = false);
+    void setContentLength(size_t length) { this->content_length = length; }
+    void send(int code, const char* content_type = nullptr, const String& content = emptyString);
+    void send(int code, const String& content_type, const String& content) { this->send(code, content_type.c_str(), content); }
+    void send(int code, const char* content_type, const char* content, size_t length);
+    void send_P(int code, PGM_P content_type, PGM_P content) { this->send(code, content_type, content, strlen(content)); }
+    void send_P(int code, PGM_P content_type, PGM_P content, size_t length) { this->send(code, content_type, content, length); }
+    void sendContent(const String& content) { this->sendContent(content.c_str(), content.length()); }
+    void sendContent(const char* content, size_t length);
+    void sendContent_P(PGM_P content) { this->sendContent(content, strlen(content)); }
+    void sendContent_P(PGM_P content, size_t length) { this->sendContent(content, length); }
+
+    // Host harness: dispatch one request synchronously and keep the response
+    const HostResponse& host_request(HTTPMethod method, const char* uri, const char* body = "", const std::vector<std::pair<std::string, std::string>>& headers = {});
+    const HostResponse& host_response() const { return this->response; }
+
+private:
+    struct Route {
+        std::string uri;
+        HTTPMethod method;
+        THandlerFunction handler;
+    };
+
+    int port;
+    bool running = false;
+    std::vector<Route> routes;
+    THandlerFunction not_found_handler;
+
+    HTTPMethod request_method = HTTP_GET;
+    String request_uri;
+    std::vector<std::pair<std::string, std::string>> request_args;
+    std::vector<std::pair<std::string, std::string>> request_headers;
+
+    size_t content_length = CONTENT_LENGTH_NOT_SET;
+    std::vector<std::pair<std::string, std::string>> pending_headers;
+    HostResponse response;
+};
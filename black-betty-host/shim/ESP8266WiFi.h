@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <memory>
+#include <string>
+
+// Host stand-in for the ESP8266 WiFi stack. There is no network, so the station never connects
+// unless the harness calls WiFi.set_status(WL_CONNECTED)
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_WRONG_PASSWORD = 6,
+    WL_DISCONNECTED = 7
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } WiFiMode_t;
+
+class IPAddress {
+public:
+    IPAddress(uint32_t address = 0) : address(address) {}
+    uint32_t v4() const { return this->address; }
+
+private:
+    uint32_t address;
+};
+
+// Remote side of a host client connection, shared by all copies of the WiFiClient like the ClientContext on the device
+struct HostClientState {
+    std::string output;
+    size_t window = 2920;
+    bool connected = true;
+};
+
+class WiFiClient {
+public:
+    WiFiClient() {}
+
+    size_t write(const uint8_t* data, size_t size) {
+        if (!this->connected()) {
+            return 0;
+        }
+        this->state->output.append(reinterpret_cast<const char*>(data), size);
+        return size;
+    }
+    size_t write(const char* data, size_t size) { return this->write(reinterpret_cast<const uint8_t*>(data), size); }
+    int availableForWrite() { return this->connected() ? static_cast<int>(this->state->window) : 0; }
+    uint8_t connected() const { return this->state && this->state->connected ? 1 : 0; }
+    void stop() { if (this->state) { this->state->connected = false; } }
+    void setNoDelay(bool enabled) {}
+    explicit operator bool() const { return this->connected() != 0; }
+
+    // Harness side: a new connection, everything written to it and the free send window (bytes)
+    static WiFiClient host_create() { WiFiClient client; client.state = std::make_shared<HostClientState>(); return client; }
+    const std::string& host_output() const { static const std::string empty; return this->state ? this->state->output : empty; }
+    void host_set_window(size_t window) { if (this->state) { this->state->window = window; } }
+
+private:
+    std::shared_ptr<HostClientState> state;
+};
+
+class ESP8266WiFiClass {
+public:
+    bool mode(WiFiMode_t mode, bool persistent = true) { return true; }
+    bool hostname(const char* name) { return true; }
+    wl_status_t begin(const char* ssid, const char* password) { return this->wifi_status; }
+    bool disconnect(bool wifioff = false) { this->wifi_status = WL_DISCONNECTED; return true; }
+    bool setAutoReconnect(bool enabled) { return true; }
+    wl_status_t status() const { return this->wifi_status; }
+    IPAddress localIP() const { return IPAddress(this->wifi_status == WL_CONNECTED ? 0x0A00A8C0 : 0); }
+
+    void set_status(wl_status_t status) { this->wifi_status = status; }
+
+private:
+    wl_status_t wifi_status = WL_DISCONNECTED;
+};
+
+extern ESP8266WiFiClass WiFi;
@@ -0,0 +1,107 @@
+#include "ESPAsyncTCP.h"
+
+AsyncClient::AsyncClient(std::shared_ptr<HostPeer> peer) : peer(peer) {
+    this->peer->client = this;
+}
+
+AsyncClient::~AsyncClient() {
+    this->peer->client = nullptr;
+    this->peer->closed = true;
+}
+
+size_t AsyncClient::space() const {
+    return this->peer->closed ? 0 : HOST_TCP_SND_BUF - this->peer->unacked - this->peer->queued;
+}
+
+size_t AsyncClient::add(const char* data, size_t size, uint8_t flags) {
+    const size_t added = size < this->space() ? size : this->space();
+    this->peer->received.append(data, added);
+    this->peer->queued += added;
+    return added;
+}
+
+bool AsyncClient::send() {
+    this->peer->unacked += this->peer->queued;
+    this->peer->queued = 0;
+    return true;
+}
+
+// The disconnect callback usually deletes the client, so it is the last thing touching it
+void AsyncClient::close(bool now) {
+    if (this->peer->closed) {
+        return;
+    }
+
+    this->peer->closed = true;
+    if (this->disconnect_handler) {
+        this->disconnect_handler(this->disconnect_arg, this);
+    }
+}
+
+bool AsyncClient::connected() const {
+    return !this->peer->closed;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+
+int AsyncServer::host_connect() {
+    if (!this->running || !this->client_handler) {
+        return -1;
+    }
+
+    const int id = this->next_id++;
+    std::shared_ptr<HostPeer> peer = std::make_shared<HostPeer>();
+    this->peers[id] = peer;
+    this->client_handler(this->client_arg, new AsyncClient(peer));
+    return id;
+}
+
+void AsyncServer::host_send(int id, const std::string& data) {
+    HostPeer& peer = *this->peers.at(id);
+    if (peer.client != nullptr && !peer.closed && peer.client->data_handler) {
+        std::string copy(data);
+        peer.client->data_handler(peer.client->data_arg, peer.client, &copy[0], copy.size());
+    }
+}
+
+void AsyncServer::host_ack(int id) {
+    HostPeer& peer = *this->peers.at(id);
+    const size_t size = peer.unacked;
+    peer.unacked = 0;
+    if (size > 0 && peer.client != nullptr && !peer.closed && peer.client->ack_handler) {
+        peer.client->ack_handler(peer.client->ack_arg, peer.client, size, 1);
+    }
+}
+
+void AsyncServer::host_poll() {
+    for (auto& pair : this->peers) {
+        HostPeer& peer = *pair.second;
+        if (peer.client != nullptr && !peer.closed && peer.client->poll_handler) {
+            peer.client->poll_handler(peer.client->poll_arg, peer.client);
+        }
+    }
+}
+
+void AsyncServer::host_disconnect(int id) {
+    HostPeer& peer = *this->peers.at(id);
+    if (peer.client != nullptr) {
+        peer.client->close(true);
+    }
+}
+
+const std::string& AsyncServer::host_received(int id) const {
+    return this->peers.at(id)->received;
+}
+
+bool AsyncServer::host_is_closed(int id) const {
+    return this->peers.at(id)->closed;
+}
+
+size_t AsyncServer::host_open_count() const {
+    size_t count = 0;
+    for (const auto& pair : this->peers) {
+        count += pair.second->closed ? 0 : 1;
+    }
+
+    return count;
+}
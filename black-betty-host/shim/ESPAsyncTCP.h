@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#define ASYNC_WRITE_FLAG_COPY 0x01
+
+// Send buffer of the lwip configuration of the ESP8266 core (2 * 536 byte segments)
+constexpr size_t HOST_TCP_SND_BUF = 1072;
+
+class AsyncClient;
+
+typedef std::function<void(void*, AsyncClient*)> AcConnectHandler;
+typedef std::function<void(void*, AsyncClient*, size_t len, uint32_t time)> AcAckHandler;
+typedef std::function<void(void*, AsyncClient*, int8_t error)> AcErrorHandler;
+typedef std::function<void(void*, AsyncClient*, void* data, size_t len)> AcDataHandler;
+typedef std::function<void(void*, AsyncClient*, uint32_t time)> AcTimeoutHandler;
+
+// State of the remote side of a host connection, it outlives the client (which the firmware deletes)
+struct HostPeer {
+    AsyncClient* client = nullptr;
+    std::string received;
+    size_t unacked = 0;
+    size_t queued = 0;
+    bool closed = false;
+};
+
+/*
+    Host stand-in for the ESPAsyncTCP client. There is no network, the harness plays the peer through
+    AsyncServer::host_connect and the host_* methods of the server. Callbacks run synchronously in the harness
+    like they run in the tcp stack context on the device.
+*/
+class AsyncClient {
+public:
+    explicit AsyncClient(std::shared_ptr<HostPeer> peer);
+    ~AsyncClient();
+
+    void onData(AcDataHandler handler, void* arg = nullptr) { this->data_handler = handler; this->data_arg = arg; }
+    void onAck(AcAckHandler handler, void* arg = nullptr) { this->ack_handler = handler; this->ack_arg = arg; }
+    void onPoll(AcConnectHandler handler, void* arg = nullptr) { this->poll_handler = handler; this->poll_arg = arg; }
+    void onTimeout(AcTimeoutHandler handler, void* arg = nullptr) { this->timeout_handler = handler; this->timeout_arg = arg; }
+    void onDisconnect(AcConnectHandler handler, void* arg = nullptr) { this->disconnect_handler = handler; this->disconnect_arg = arg; }
+    void onError(AcErrorHandler handler, void* arg = nullptr) {}
+
+    void setRxTimeout(uint32_t timeout) {}
+    void setNoDelay(bool enabled) {}
+
+    size_t space() const;
+    bool canSend() const { return this->space() > 0; }
+    size_t add(const char* data, size_t size, uint8_t flags = 0);
+    bool send();
+    void close(bool now = false);
+    bool connected() const;
+
+private:
+    friend class AsyncServer;
+
+    std::shared_ptr<HostPeer> peer;
+
+    AcDataHandler data_handler;
+    void* data_arg = nullptr;
+    AcAckHandler ack_handler;
+    void* ack_arg = nullptr;
+    AcConnectHandler poll_handler;
+    void* poll_arg = nullptr;
+    AcTimeoutHandler timeout_handler;
+    void* timeout_arg = nullptr;
+    AcConnectHandler disconnect_handler;
+    void* disconnect_arg = nullptr;
+};
+
+class AsyncServer {
+public:
+    explicit AsyncServer(uint16_t port) : port(port) {}
+
+    void onClient(AcConnectHandler handler, void* arg) { this->client_handler = handler; this->client_arg = arg; }
+    void begin() { this->running = true; }
+    void end() { this->running = false; }
+    void setNoDelay(bool enabled) {}
+
+    // Harness side: opens a connection (-1 if the server is not running), sends data to it, acknowledges
+    // everything the firmware sent, runs the poll timer and reads the response
+    int host_connect();
+    void host_send(int id, const std::string& data);
+    void host_ack(int id);
+    void host_poll();
+    void host_disconnect(int id);
+    const std::string& host_received(int id) const;
+    bool host_is_closed(int id) const;
+    size_t host_open_count() const;
+
+private:
+    uint16_t port;
+    bool running = false;
+    AcConnectHandler client_handler;
+    void* client_arg = nullptr;
+    int next_id = 0;
+    std::map<int, std::shared_ptr<HostPeer>> peers;
+};
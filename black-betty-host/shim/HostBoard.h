@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <functional>
+
+/*
+    Host side control of the simulated ESP8266 board. The firmware only sees the Arduino api, the harness
+    uses these functions to drive the simulated clock, inject serial input and connect the plant model.
+*/
+namespace host {
+    // Simulated time since boot
+    uint64_t now_us();
+
+    // Advance the simulated clock, the tick handler and the timer1 interrupt run at their simulated times
+    void advance(uint64_t us);
+    void set_tick_handler(std::function<void(uint64_t step_us)> handler, uint64_t step_us);
+
+    int get_pin(uint8_t pin);
+    void set_pin(uint8_t pin, int value);
+
+    // The temperature converted by the emulated ADT7410, a disconnected sensor does not acknowledge on the bus
+    float get_sensor_temperature();
+    void set_sensor_temperature(float value);
+    void set_sensor_connected(bool connected);
+
+    // Number of I2C transactions (writes and reads) since boot
+    unsigned long get_i2c_transaction_count();
+
+    // Queue input for Serial.read, output can be muted for benchmark runs
+    void serial_input(const char* text);
+    void serial_mute(bool mute);
+
+    // Number of emulated flash sector erases and the simulated time one erase takes
+    unsigned long get_flash_erase_count();
+    constexpr uint64_t FLASH_ERASE_US = 40000;
+
+    // Real (not simulated) nanoseconds since process start
+    uint64_t cycle_count();
+}
@@ -0,0 +1,165 @@
+#include "PID_v1.h"
+
+#include <Arduino.h>
+
+PID::PID(double* input, double* output, double* setpoint, double kp, double ki, double kd, int pon, int direction) {
+    this->myOutput = output;
+    this->myInput = input;
+    this->mySetpoint = setpoint;
+    this->inAuto = false;
+    this->outputSum = 0.0;
+    this->lastInput = 0.0;
+
+    this->SetOutputLimits(0, 255);
+    this->SampleTime = 100;
+
+    this->controllerDirection = DIRECT;
+    this->SetControllerDirection(direction);
+    this->SetTunings(kp, ki, kd, pon);
+
+    this->lastTime = millis() - this->SampleTime;
+}
+
+PID::PID(double* input, double* output, double* setpoint, double kp, double ki, double kd, int direction)
+    : PID(input, output, setpoint, kp, ki, kd, P_ON_E, direction) {
+}
+
+bool PID::Compute() {
+    if (!this->inAuto) {
+        return false;
+    }
+
+    unsigned long now = millis();
+    unsigned long timeChange = now - this->lastTime;
+    if (timeChange < this->SampleTime) {
+        return false;
+    }
+
+    double input = *this->myInput;
+    double error = *this->mySetpoint - input;
+    double dInput = input - this->lastInput;
+    this->outputSum += this->ki * error;
+
+    // Add proportional on measurement, if P_ON_M is specified
+    if (!this->pOnE) {
+        this->outputSum -= this->kp * dInput;
+    }
+
+    if (this->outputSum > this->outMax) {
+        this->outputSum = this->outMax;
+    } else if (this->outputSum < this->outMin) {
+        this->outputSum = this->outMin;
+    }
+
+    // Add proportional on error, if P_ON_E is specified
+    double output = this->pOnE ? this->kp * error : 0.0;
+
+    // Compute rest of PID output
+    output += this->outputSum - this->kd * dInput;
+
+    if (output > this->outMax) {
+        output = this->outMax;
+    } else if (output < this->outMin) {
+        output = this->outMin;
+    }
+    *this->myOutput = output;
+
+    this->lastInput = input;
+    this->lastTime = now;
+    return true;
+}
+
+void PID::SetTunings(double kp, double ki, double kd, int pon) {
+    if (kp < 0 || ki < 0 || kd < 0) {
+        return;
+    }
+
+    this->pOn = pon;
+    this->pOnE = pon == P_ON_E;
+
+    this->dispKp = kp;
+    this->dispKi = ki;
+    this->dispKd = kd;
+
+    double sampleTimeInSec = static_cast<double>(this->SampleTime) / 1000.0;
+    this->kp = kp;
+    this->ki = ki * sampleTimeInSec;
+    this->kd = kd / sampleTimeInSec;
+
+    if (this->controllerDirection == REVERSE) {
+        this->kp = -this->kp;
+        this->ki = -this->ki;
+        this->kd = -this->kd;
+    }
+}
+
+void PID::SetTunings(double kp, double ki, double kd) {
+    this->SetTunings(kp, ki, kd, this->pOn);
+}
+
+void PID::SetSampleTime(int sample_time) {
+    if (sample_time > 0) {
+        double ratio = static_cast<double>(sample_time) / static_cast<double>(this->SampleTime);
+        this->ki *= ratio;
+        this->kd /= ratio;
+        this->SampleTime = static_cast<unsigned long>(sample_time);
+    }
+}
+
+void PID::SetOutputLimits(double min, double max) {
+    if (min >= max) {
+        return;
+    }
+
+    this->outMin = min;
+    this->outMax = max;
+
+    if (this->inAuto) {
+        if (*this->myOutput > this->outMax) {
+            *this->myOutput = this->outMax;
+        } else if (*this->myOutput < this->outMin) {
+            *this->myOutput = this->outMin;
+        }
+
+        if (this->outputSum > this->outMax) {
+            this->outputSum = this->outMax;
+        } else if (this->outputSum < this->outMin) {
+            this->outputSum = this->outMin;
+        }
+    }
+}
+
+void PID::SetMode(int mode) {
+    bool newAuto = mode == AUTOMATIC;
+    if (newAuto && !this->inAuto) {
+        this->Initialize();
+    }
+
+    this->inAuto = newAuto;
+}
+
+void PID::Initialize() {
+    this->outputSum = *this->myOutput;
+    this->lastInput = *this->myInput;
+    if (this->outputSum > this->outMax) {
+        this->outputSum = this->outMax;
+    } else if (this->outputSum < this->outMin) {
+        this->outputSum = this->outMin;
+    }
+}
+
+void PID::SetControllerDirection(int direction) {
+    if (this->inAuto && direction != this->controllerDirection) {
+        this->kp = -this->kp;
+        this->ki = -this->ki;
+        this->kd = -this->kd;
+    }
+
+    this->controllerDirection = direction;
+}
+
+double PID::GetKp() { return this->dispKp; }
+double PID::GetKi() { return this->dispKi; }
+double PID::GetKd() { return this->dispKd; }
+int PID::GetMode() { return this->inAuto ? AUTOMATIC : MANUAL; }
+int PID::GetDirection() { return this->controllerDirection; }
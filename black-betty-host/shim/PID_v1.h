@@ -0,0 +1,58 @@
+#pragma once
+
+// Host stand-in for the Arduino PID library (V1.2, Brett Beauregard) with the same api and arithmetic
+#define AUTOMATIC 1
+#define MANUAL 0
+#define DIRECT 0
+#define REVERSE 1
+#define P_ON_M 0
+#define P_ON_E 1
+
+class PID {
+public:
+    PID(double* input, double* output, double* setpoint, double kp, double ki, double kd, int pon, int direction);
+    PID(double* input, double* output, double* setpoint, double kp, double ki, double kd, int direction);
+
+    void SetMode(int mode);
+    bool Compute();
+    void SetOutputLimits(double min, double max);
+
+    void SetTunings(double kp, double ki, double kd);
+    void SetTunings(double kp, double ki, double kd, int pon);
+    void SetControllerDirection(int direction);
+    void SetSampleTime(int sample_time);
+
+    double GetKp();
+    double GetKi();
+    double GetKd();
+    int GetMode();
+    int GetDirection();
+
+private:
+    void Initialize();
+
+    double dispKp;
+    double dispKi;
+    double dispKd;
+
+    double kp;
+    double ki;
+    double kd;
+
+    int controllerDirection;
+    int pOn;
+
+    double* myInput;
+    double* myOutput;
+    double* mySetpoint;
+
+    unsigned long lastTime;
+    double outputSum;
+    double lastInput;
+
+    unsigned long SampleTime;
+    double outMin;
+    double outMax;
+    bool inAuto;
+    bool pOnE;
+};
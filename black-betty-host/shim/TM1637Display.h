@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+
+// Host stand-in for the TM1637 display, it only remembers the last shown number
+class TM1637Display {
+public:
+    TM1637Display(uint8_t pinClk, uint8_t pinDIO, unsigned int bitDelay = 100) : number(0), dots(0), brightness(0), updates(0) {}
+
+    void setBrightness(uint8_t brightness, bool on = true) { this->brightness = on ? brightness : 0; }
+    void clear() { this->number = 0; this->updates++; }
+
+    void showNumberDecEx(int num, uint8_t dots = 0, bool leading_zero = false, uint8_t length = 4, uint8_t pos = 0) {
+        this->number = num;
+        this->dots = dots;
+        this->updates++;
+    }
+
+    int number;
+    uint8_t dots;
+    uint8_t brightness;
+    unsigned long updates;
+};
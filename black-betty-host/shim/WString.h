@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string>
+
+// Host stand-in for the Arduino String class, backed by std::string
+class __FlashStringHelper;
+
+class String {
+public:
+    String() {}
+    String(const char* value) : value(value != nullptr ? value : "") {}
+    String(const __FlashStringHelper* value) : value(reinterpret_cast<const char*>(value)) {}
+    String(const std::string& value) : value(value) {}
+    explicit String(int value) : value(std::to_string(value)) {}
+    explicit String(unsigned int value) : value(std::to_string(value)) {}
+    explicit String(long value) : value(std::to_string(value)) {}
+    explicit String(unsigned long value) : value(std::to_string(value)) {}
+
+    const char* c_str() const { return this->value.c_str(); }
+    unsigned int length() const { return static_cast<unsigned int>(this->value.length()); }
+    bool isEmpty() const { return this->value.empty(); }
+    long toInt() const { return strtol(this->value.c_str(), nullptr, 10); }
+
+    bool equals(const String& other) const { return this->value == other.value; }
+    bool equalsIgnoreCase(const String& other) const;
+
+    String& operator+=(const String& other) { this->value += other.value; return *this; }
+    String& operator+=(const char* other) { this->value += other; return *this; }
+    String& operator+=(char other) { this->value += other; return *this; }
+    bool operator==(const String& other) const { return this->value == other.value; }
+    bool operator==(const char* other) const { return this->value == other; }
+    bool operator!=(const String& other) const { return this->value != other.value; }
+
+private:
+    std::string value;
+};
+
+inline String operator+(const String& lhs, const String& rhs) { String result(lhs); result += rhs; return result; }
+
+extern const String emptyString;
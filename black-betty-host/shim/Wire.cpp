@@ -0,0 +1,108 @@
+#include "Wire.h"
+#include "HostBoard.h"
+
+TwoWire Wire;
+
+namespace {
+    constexpr uint8_t ADT7410_ADDRESS = 0x48;
+    constexpr uint64_t ADT7410_CONVERSION_US = 240000;
+
+    bool sensor_connected = true;
+    unsigned long transaction_count = 0;
+
+    // The register pointer, config register and the conversion that was read last. Conversions are counted
+    // from the last config write (power up at boot)
+    uint8_t pointer = 0;
+    uint8_t config = 0;
+    uint64_t conversion_start_us = 0;
+    uint64_t conversion_read = 0;
+
+    uint64_t get_conversion() {
+        return (host::now_us() - conversion_start_us) / ADT7410_CONVERSION_US;
+    }
+
+    uint8_t read_adt7410(uint8_t reg) {
+        // 16 bit resolution, the 13 bit mode has three flag bits in the lsb
+        const int raw = static_cast<int>(host::get_sensor_temperature() * 128.0f);
+        const uint16_t value = static_cast<uint16_t>(static_cast<int16_t>((config & 0x80) != 0 ? raw : raw & ~0x07));
+
+        switch (reg) {
+            case 0x00: return static_cast<uint8_t>(value >> 8);
+            case 0x01: conversion_read = get_conversion(); return static_cast<uint8_t>(value & 0xFF);
+            case 0x02: return get_conversion() > conversion_read ? 0x00 : 0x80;
+            case 0x03: return config;
+            case 0x0B: return 0xCB;
+            default: return 0x00;
+        }
+    }
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+    this->address = address;
+    this->transmit_size = 0;
+}
+
+size_t TwoWire::write(uint8_t value) {
+    if (this->transmit_size >= sizeof(this->transmit)) {
+        return 0;
+    }
+
+    this->transmit[this->transmit_size++] = value;
+    return 1;
+}
+
+// 0 on success, 2 if the address was not acknowledged
+uint8_t TwoWire::endTransmission(bool stop) {
+    transaction_count++;
+    host::advance((1 + this->transmit_size) * HOST_I2C_BYTE_US);
+    if (this->address != ADT7410_ADDRESS || !sensor_connected) {
+        return 2;
+    }
+
+    if (this->transmit_size > 0) {
+        pointer = this->transmit[0];
+    }
+
+    if (this->transmit_size > 1 && pointer == 0x03) {
+        config = this->transmit[1];
+        conversion_start_us = host::now_us();
+        conversion_read = 0;
+    }
+
+    return 0;
+}
+
+// Reads auto increment the register pointer like on the ADT7410
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t size) {
+    transaction_count++;
+    host::advance((1 + size) * HOST_I2C_BYTE_US);
+    this->receive_size = 0;
+    this->receive_position = 0;
+    if (address != ADT7410_ADDRESS || !sensor_connected) {
+        return 0;
+    }
+
+    while (this->receive_size < size && this->receive_size < sizeof(this->receive)) {
+        this->receive[this->receive_size++] = read_adt7410(pointer++);
+    }
+
+    return static_cast<uint8_t>(this->receive_size);
+}
+
+int TwoWire::available() {
+    return static_cast<int>(this->receive_size - this->receive_position);
+}
+
+int TwoWire::read() {
+    return this->receive_position < this->receive_size ? this->receive[this->receive_position++] : -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Host board control
+void host::set_sensor_connected(bool connected) {
+    sensor_connected = connected;
+}
+
+unsigned long host::get_i2c_transaction_count() {
+    return transaction_count;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Time of one byte (8 bits and the ack) on the bus at 100 kHz
+constexpr uint64_t HOST_I2C_BYTE_US = 90;
+
+/*
+    Host stand-in for the I2C bus of the ESP8266 core. The only device is an emulated ADT7410 at 0x48 that
+    converts the temperature set by the plant model every 240 ms. Every transaction advances the simulated
+    clock by its time on the bus.
+*/
+class TwoWire {
+public:
+    void begin() {}
+    void begin(int sda, int scl) {}
+    void setClock(uint32_t frequency) {}
+
+    void beginTransmission(uint8_t address);
+    size_t write(uint8_t value);
+    uint8_t endTransmission(bool stop = true);
+
+    uint8_t requestFrom(uint8_t address, uint8_t size);
+    int available();
+    int read();
+
+private:
+    uint8_t address = 0;
+    uint8_t transmit[8] = {};
+    size_t transmit_size = 0;
+    uint8_t receive[8] = {};
+    size_t receive_size = 0;
+    size_t receive_position = 0;
+};
+
+extern TwoWire Wire;
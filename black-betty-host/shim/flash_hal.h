@@ -0,0 +1,7 @@
+#pragma once
+
+// Host stand-in for the flash layout of the ESP8266 core. The file system region is emulated by EspClass, see
+// Arduino.cpp, all other flash addresses are rejected
+#define FLASH_SECTOR_SIZE 0x1000
+#define FS_PHYS_ADDR 0x200000
+#define FS_PHYS_SIZE 0x10000
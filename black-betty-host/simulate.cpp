@@ -0,0 +1,52 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Arduino.h>
+#include <HostBoard.h>
+
+#include "Simulation.h"
+#include "Status.h"
+#include "HeaterPID.h"
+
+/*
+    Simulates a cold start of the machine and prints one csv line per second of simulated time.
+
+    Usage: black-betty-sim [-t seconds] [-c command]...
+    Commands are passed to the serial console before the simulation starts, e.g. -c "set pid 40 1 2".
+*/
+int main(int argc, char** argv) {
+    unsigned long seconds = 600;
+    Simulation simulation;
+
+    for (int index = 1; index < argc; index++) {
+        if (strcmp(argv[index], "-t") == 0 && index + 1 < argc) {
+            seconds = strtoul(argv[++index], nullptr, 10);
+        } else if (strcmp(argv[index], "-c") == 0 && index + 1 < argc) {
+            host::serial_input(argv[++index]);
+            host::serial_input("\n");
+        } else {
+            fprintf(stderr, "Usage: %s [-t seconds] [-c command]...\n", argv[0]);
+            return 1;
+        }
+    }
+
+    host::serial_mute(true);
+    simulation.begin();
+
+    const Status& status = get_status();
+    const HeaterPID& heater = get_heater();
+    const BoilerPlant& plant = simulation.get_plant();
+
+    printf("time,plate,boiler,sensor,setpoint,output,heater,mode\n");
+    for (unsigned long second = 0; second < seconds; second++) {
+        simulation.run_for(1000);
+        printf("%lu,%.3f,%.3f,%.3f,%.1f,%.3f,%d,%s\n",
+            second + 1, plant.get_plate_temperature(), plant.get_boiler_temperature(), status.temperature,
+            heater.get_setpoint(), heater.get_output(), heater.is_active() ? 1 : 0, status.get_heater_mode());
+    }
+
+    fprintf(stderr, "%lu loops, %lu relay switches, %.1f kJ heater energy\n",
+        simulation.get_loop_count(), simulation.get_relay_switches(), plant.get_energy() / 1000.0);
+    return 0;
+}
@@ -0,0 +1,4 @@
+// The Arduino IDE compiles the .ino as C++ after including Arduino.h, do the same for the host build
+#include <Arduino.h>
+
+#include "black-betty.ino"
@@ -0,0 +1,123 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <Arduino.h>
+#include <HostBoard.h>
+
+#include "Simulation.h"
+#include "Settings.h"
+#include "HeaterPID.h"
+#include "PidAutoTune.h"
+#include "CommandParser.h"
+#include "check.h"
+
+/*
+    Runs the relay feedback auto tuning on the simulated plant from a cold start. The tuning has to finish in
+    time with plausible results, the gains have to end up in the settings and the pid has to regulate with them
+    afterwards. A second tuning is stopped half way, which has to leave the gains alone.
+
+    Usage: test-autotune
+*/
+
+// Cold start included, the tuning itself takes about 10 minutes on the default plant
+constexpr unsigned long MAX_TUNING_TIME = 20UL * 60UL * 1000UL;
+
+// Regulation with the tuned gains after the hand back
+constexpr unsigned long SETTLE_TIME = 3UL * 60UL * 1000UL;
+constexpr unsigned long REGULATION_TIME = 15UL * 60UL * 1000UL;
+constexpr double MAX_ERROR = 0.25;
+constexpr double MAX_RMS_ERROR = 0.05;
+
+static void test_tuning(Simulation& simulation) {
+    printf("tuning\n");
+    const HeaterPID& heater = get_heater();
+    const PidAutoTune& autotune = heater.get_autotune();
+    const Settings& settings = get_settings();
+
+    CHECK(!execute("autotune ziegler"));
+    CHECK(execute("autotune classic"));
+    CHECK(autotune.is_running());
+
+    const unsigned long start = millis();
+    while (autotune.is_running() && millis() - start < MAX_TUNING_TIME) {
+        simulation.run_for(1000);
+    }
+
+    const unsigned long elapsed = millis() - start;
+    printf("  %s after %lu s: Ku %.2f Tu %.1f s, kp %.3f ki %.4f kd %.3f\n", autotune.get_state() == AutoTuneState::done ? "done" : "not done",
+        elapsed / 1000, autotune.get_ultimate_gain(), autotune.get_ultimate_period(), autotune.get_kp(), autotune.get_ki(), autotune.get_kd());
+    CHECK(autotune.get_state() == AutoTuneState::done);
+    CHECK(autotune.get_cycle() == AUTOTUNE_CYCLES);
+    CHECK(autotune.get_ultimate_gain() > 0.0);
+    CHECK(autotune.get_ultimate_period() > 0.0);
+    CHECK(settings.heater_kp == autotune.get_kp());
+    CHECK(settings.heater_ki == autotune.get_ki());
+    CHECK(settings.heater_kd == autotune.get_kd());
+    CHECK(heater.get_kp() == autotune.get_kp());
+    CHECK(heater.is_enabled());
+
+    // The values are only written if they fit the output
+    char output[16];
+    CHECK(!execute("get autotune", output, sizeof(output)));
+    CHECK(strlen(output) < sizeof(output));
+    CHECK(execute("get autotune"));
+}
+
+static void test_regulation(Simulation& simulation) {
+    printf("regulation\n");
+    const HeaterPID& heater = get_heater();
+    const BoilerPlant& plant = simulation.get_plant();
+
+    simulation.run_for(SETTLE_TIME);
+
+    double max_error = 0.0, error_sum = 0.0;
+    int count = 0;
+    for (unsigned long time = 0; time < REGULATION_TIME; time += 1000) {
+        simulation.run_for(1000);
+        const double error = plant.get_boiler_temperature() - heater.get_setpoint();
+        max_error = fabs(error) > max_error ? fabs(error) : max_error;
+        error_sum += error * error;
+        count++;
+    }
+
+    const double rms_error = sqrt(error_sum / count);
+    printf("  max error %.3f (max %.3f) rms %.4f (max %.4f)\n", max_error, MAX_ERROR, rms_error, MAX_RMS_ERROR);
+    CHECK(max_error <= MAX_ERROR);
+    CHECK(rms_error <= MAX_RMS_ERROR);
+}
+
+static void test_stop(Simulation& simulation) {
+    printf("stop\n");
+    const HeaterPID& heater = get_heater();
+    const PidAutoTune& autotune = heater.get_autotune();
+    const double kp = heater.get_kp();
+
+    CHECK(execute("autotune no_overshoot"));
+    simulation.run_for(60000);
+    CHECK(autotune.is_running());
+    CHECK(execute("autotune stop"));
+    CHECK(autotune.get_state() == AutoTuneState::idle);
+    CHECK(heater.get_kp() == kp);
+    CHECK(heater.is_enabled());
+
+    // No tuning while the heater is disabled, disabling stops a running one
+    CHECK(execute("autotune classic"));
+    CHECK(execute("set heater.enabled false"));
+    CHECK(!autotune.is_running());
+    CHECK(!execute("autotune classic"));
+    CHECK(execute("set heater.enabled true"));
+}
+
+int main(int argc, char** argv) {
+    host::serial_mute(true);
+    Simulation simulation;
+    simulation.begin();
+
+    test_tuning(simulation);
+    test_regulation(simulation);
+    test_stop(simulation);
+
+    printf("%s, %d failures\n", failures == 0 ? "ok" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
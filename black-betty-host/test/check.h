@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+
+#include "CommandParser.h"
+
+/*
+    Shared by the tests: CHECK counts a failed condition and reports it with its location, main returns an
+    error if there were failures.
+*/
+
+static int failures = 0;
+
+#define CHECK(condition) do { \
+        if (!(condition)) { \
+            printf("  FAIL %s:%d %s\n", __FILE__, __LINE__, #condition); \
+            failures++; \
+        } \
+    } while (0)
+
+// Runs a command like on the serial console, the parser tokenizes it in place so it is copied first
+static inline bool execute(const char* command, char* output, size_t output_size) {
+    char buffer[64];
+    strncpy(buffer, command, sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = 0x00;
+    output[0] = 0x00;
+    return get_command_parser().execute(buffer, false, output, output_size);
+}
+
+static inline bool execute(const char* command) {
+    char output[128];
+    return execute(command, output, sizeof(output));
+}
@@ -0,0 +1,133 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <Arduino.h>
+#include <HostBoard.h>
+#include <PID_v1.h>
+
+#include "FixedPID.h"
+
+/*
+    Runs the PID library and the fixed point FixedPID side by side on a recorded temperature trace and
+    fails if their outputs drift apart. The trace is a csv of time (s), sensor and setpoint as written by
+    black-betty-sim, it is interpolated to the 100 ms sample time of the pid.
+
+    Usage: test-pid-equivalence trace.csv
+*/
+struct TraceRow {
+    double time;
+    double sensor;
+    double setpoint;
+};
+
+struct PidCase {
+    const char* name;
+    double kp;
+    double ki;
+    double kd;
+    double output_max;
+    double setpoint_step;  // Added to the setpoint for the second half of the trace
+};
+
+// Allowed difference of the outputs in percent of the output range
+constexpr double MAX_DIFFERENCE_PERCENT = 0.05;
+
+static bool load_trace(const char* path, std::vector<TraceRow>& rows) {
+    FILE* file = fopen(path, "r");
+    if (file == nullptr) {
+        fprintf(stderr, "Can not open %s\n", path);
+        return false;
+    }
+
+    char line[128];
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        TraceRow row;
+        if (sscanf(line, "%lf,%lf,%lf", &row.time, &row.sensor, &row.setpoint) == 3) {
+            rows.push_back(row);
+        }
+    }
+
+    fclose(file);
+    return rows.size() > 1;
+}
+
+static double interpolate(double a, double b, double fraction) {
+    return a + (b - a) * fraction;
+}
+
+static bool run_case(const PidCase& test, const std::vector<TraceRow>& rows) {
+    double input = rows[0].sensor, output = 0.0, setpoint = rows[0].setpoint;
+    double fixed_input = input, fixed_output = 0.0, fixed_setpoint = setpoint;
+
+    PID pid(&input, &output, &setpoint, test.kp, test.ki, test.kd, DIRECT);
+    FixedPID fixed_pid(&fixed_input, &fixed_output, &fixed_setpoint, test.kp, test.ki, test.kd, DIRECT);
+    pid.SetOutputLimits(0.0, test.output_max);
+    fixed_pid.SetOutputLimits(0.0, test.output_max);
+    pid.SetMode(AUTOMATIC);
+    fixed_pid.SetMode(AUTOMATIC);
+
+    const double half_time = rows.back().time / 2.0;
+    double max_difference = 0.0, max_difference_time = 0.0;
+    int computed = 0;
+
+    for (size_t index = 0; index + 1 < rows.size(); index++) {
+        for (int step = 0; step < 10; step++) {
+            host::advance(100000);
+
+            const double fraction = static_cast<double>(step) / 10.0;
+            const double time = interpolate(rows[index].time, rows[index + 1].time, fraction);
+            input = fixed_input = interpolate(rows[index].sensor, rows[index + 1].sensor, fraction);
+            setpoint = fixed_setpoint = rows[index].setpoint + (time >= half_time ? test.setpoint_step : 0.0);
+
+            const bool computed_double = pid.Compute();
+            const bool computed_fixed = fixed_pid.Compute();
+            if (computed_double != computed_fixed) {
+                printf("%-12s FAIL sample timing differs at %.1f s\n", test.name, time);
+                return false;
+            }
+
+            computed += computed_double ? 1 : 0;
+            const double difference = fabs(output - fixed_output);
+            if (difference > max_difference) {
+                max_difference = difference;
+                max_difference_time = time;
+            }
+        }
+    }
+
+    const double limit = test.output_max * MAX_DIFFERENCE_PERCENT / 100.0;
+    const bool passed = computed > 0 && max_difference <= limit;
+    printf("%-12s %s %d samples, max difference %.5f at %.1f s (limit %.5f)\n",
+        test.name, passed ? "ok  " : "FAIL", computed, max_difference, max_difference_time, limit);
+    return passed;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s trace.csv\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<TraceRow> rows;
+    if (!load_trace(argv[1], rows)) {
+        fprintf(stderr, "Invalid trace %s\n", argv[1]);
+        return 1;
+    }
+
+    const PidCase cases[] = {
+        { "default", 50.0, 2.0, 1.0, 255.0, 0.0 },
+        { "window", 50.0, 2.0, 1.0, 500.0, -10.0 },
+        { "aggressive", 200.0, 10.0, 20.0, 500.0, 5.0 },
+        { "slow", 5.0, 0.05, 100.0, 5000.0, -20.0 },
+        { "wide", 900.0, 900.0, 900.0, 65000.0, 10.0 },
+    };
+
+    bool passed = true;
+    for (const PidCase& test : cases) {
+        passed = run_case(test, rows) && passed;
+    }
+
+    return passed ? 0 : 1;
+}
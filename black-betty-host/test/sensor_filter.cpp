@@ -0,0 +1,231 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include <Arduino.h>
+#include <HostBoard.h>
+
+#include "Settings.h"
+#include "SensorFilter.h"
+#include "TemperatureSensor.h"
+#include "CommandParser.h"
+#include "check.h"
+
+/*
+    Runs the sensor filter stages on a recorded temperature trace. The trace (time in s, sensor, setpoint as
+    written by black-betty-sim) is interpolated to the conversion time of the sensor, then gaussian noise, the
+    16 bit quantization of the ADT7410 and single spikes are added with a fixed seed. Every case checks how far
+    the filtered signal is from the clean one and how much it lags behind it.
+
+    Usage: test-sensor-filter trace.csv
+*/
+struct FilterCase {
+    const char* name;
+    int median;
+    LowpassMode lowpass;
+    double lowpass_value;
+    double kalman_q;
+    double kalman_r;
+    double max_noise;   // RMS of the error in the steady part
+    double max_spike;   // Largest error after a spike
+    double max_lag;     // Mean error while heating up
+};
+
+constexpr double NOISE = 0.05;
+constexpr double SPIKE = 5.0;
+constexpr int SPIKE_INTERVAL = 97;
+
+// Samples after a spike that are checked against max_spike instead of the noise and lag limits
+constexpr size_t SPIKE_WINDOW = 16;
+
+// After this time (s) the trace is regulating around the setpoint
+constexpr double STEADY_TIME = 400.0;
+
+static bool load_trace(const char* path, std::vector<double>& times, std::vector<double>& values) {
+    FILE* file = fopen(path, "r");
+    if (file == nullptr) {
+        fprintf(stderr, "Can not open %s\n", path);
+        return false;
+    }
+
+    char line[128];
+    double time, sensor, setpoint;
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        if (sscanf(line, "%lf,%lf,%lf", &time, &sensor, &setpoint) == 3) {
+            times.push_back(time);
+            values.push_back(sensor);
+        }
+    }
+
+    fclose(file);
+    return times.size() > 1;
+}
+
+// Deterministic gaussian noise (Box-Muller on a LCG)
+static double next_noise(uint32_t& state) {
+    state = state * 1664525u + 1013904223u;
+    const double u1 = (static_cast<double>(state >> 8) + 1.0) / 16777217.0;
+    state = state * 1664525u + 1013904223u;
+    const double u2 = static_cast<double>(state >> 8) / 16777216.0;
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+struct Signal {
+    std::vector<double> time;
+    std::vector<double> clean;
+    std::vector<double> noisy;
+};
+
+static Signal make_signal(const std::vector<double>& times, const std::vector<double>& values) {
+    Signal signal;
+    uint32_t state = 42;
+    const double step = SENSOR_CONVERSION_TIME / 1000.0;
+    size_t row = 0;
+    for (double time = times.front(); time <= times.back(); time += step) {
+        while (row + 2 < times.size() && times[row + 1] < time) {
+            row++;
+        }
+
+        const double fraction = (time - times[row]) / (times[row + 1] - times[row]);
+        const double clean = values[row] + (values[row + 1] - values[row]) * fraction;
+        const bool spike = signal.time.size() % SPIKE_INTERVAL == SPIKE_INTERVAL - 1;
+        const double noisy = clean + NOISE * next_noise(state) + (spike ? SPIKE : 0.0);
+
+        signal.time.push_back(time);
+        signal.clean.push_back(clean);
+        signal.noisy.push_back(floor(noisy * 128.0) / 128.0);
+    }
+
+    return signal;
+}
+
+static void run_case(const FilterCase& test, const Signal& signal) {
+    Settings settings;
+    CHECK(settings.validate_set_filter_median(test.median));
+    CHECK(settings.validate_set_filter_lowpass(static_cast<uint8_t>(test.lowpass), test.lowpass_value));
+    CHECK(settings.validate_set_filter_kalman(test.kalman_q, test.kalman_r));
+
+    SensorFilter filter;
+    filter.configure(settings);
+
+    double noise_sum = 0.0, lag_sum = 0.0, max_spike = 0.0;
+    int noise_count = 0, lag_count = 0;
+    for (size_t index = 0; index < signal.time.size(); index++) {
+        const double error = filter.next(signal.noisy[index]) - signal.clean[index];
+        if (index % SPIKE_INTERVAL >= SPIKE_INTERVAL - 1 || index % SPIKE_INTERVAL < SPIKE_WINDOW - 1) {
+            max_spike = fabs(error) > max_spike ? fabs(error) : max_spike;
+        } else if (signal.time[index] >= STEADY_TIME) {
+            noise_sum += error * error;
+            noise_count++;
+        } else if (signal.time[index] >= 10.0 && signal.time[index] < 120.0) {
+            lag_sum += fabs(error);
+            lag_count++;
+        }
+    }
+
+    const double noise = sqrt(noise_sum / noise_count);
+    const double lag = lag_sum / lag_count;
+    const bool passed = noise <= test.max_noise && max_spike <= test.max_spike && lag <= test.max_lag;
+    printf("%-22s %s noise %.4f (max %.4f) spike %.3f (max %.3f) lag %.3f (max %.3f)\n", test.name, passed ? "ok  " : "FAIL",
+        noise, test.max_noise, max_spike, test.max_spike, lag, test.max_lag);
+    failures += passed ? 0 : 1;
+}
+
+// A constant input passes every stage unchanged, no gain error and no start up transient
+static void test_dc_gain() {
+    printf("dc gain\n");
+    Settings settings;
+    settings.validate_set_filter_median(5);
+    settings.validate_set_filter_lowpass(static_cast<uint8_t>(LowpassMode::biquad), 0.2);
+    settings.validate_set_filter_kalman(0.001, 0.01);
+
+    SensorFilter filter;
+    filter.configure(settings);
+    for (int index = 0; index < 100; index++) {
+        CHECK(fabs(filter.next(93.5) - 93.5) < 1e-9);
+    }
+
+    settings.validate_set_filter_lowpass(static_cast<uint8_t>(LowpassMode::ema), 0.25);
+    filter.configure(settings);
+    CHECK(filter.next(20.0) == 20.0);
+    CHECK(fabs(filter.next(24.0) - 20.0) < 2.0);
+}
+
+static void test_validation() {
+    printf("validation\n");
+    Settings settings;
+    CHECK(!settings.validate_set_filter_median(0));
+    CHECK(!settings.validate_set_filter_median(4));
+    CHECK(!settings.validate_set_filter_median(7));
+    CHECK(!settings.validate_set_filter_lowpass(static_cast<uint8_t>(LowpassMode::ema), 0.0));
+    CHECK(!settings.validate_set_filter_lowpass(static_cast<uint8_t>(LowpassMode::ema), 1.5));
+    CHECK(!settings.validate_set_filter_lowpass(static_cast<uint8_t>(LowpassMode::biquad), 2.5));
+    CHECK(!settings.validate_set_filter_lowpass(7, 0.5));
+    CHECK(!settings.validate_set_filter_kalman(-1.0, 0.1));
+    CHECK(!settings.validate_set_filter_kalman(0.1, 0.0));
+    CHECK(settings.filter_median == 1);
+    CHECK(settings.filter_lowpass == static_cast<uint8_t>(LowpassMode::none));
+    CHECK(settings.filter_kalman_q == 0.0);
+}
+
+static void test_commands() {
+    printf("commands\n");
+    CommandParser& parser = get_command_parser();
+    const Settings& settings = get_settings();
+    char output[128];
+
+    CHECK(parser.execute("set filter.median 5", false, output, sizeof(output)));
+    CHECK(!parser.execute("set filter.median 2", false, output, sizeof(output)));
+    CHECK(parser.execute("set filter.lowpass biquad 0.3", false, output, sizeof(output)));
+    CHECK(!parser.execute("set filter.lowpass ema", false, output, sizeof(output)));
+    CHECK(!parser.execute("set filter.lowpass fir 0.3", false, output, sizeof(output)));
+    CHECK(parser.execute("set filter.kalman 0.001 0.004", false, output, sizeof(output)));
+    CHECK(settings.filter_median == 5);
+    CHECK(settings.filter_lowpass == static_cast<uint8_t>(LowpassMode::biquad));
+    CHECK(settings.filter_lowpass_value == 0.3);
+    CHECK(settings.filter_kalman_r == 0.004);
+
+    CHECK(parser.execute("get filter", false, output, sizeof(output)));
+    CHECK(strcmp(output, "5 biquad 0.3 0.001 0.004") == 0);
+
+    CHECK(parser.execute("set filter.lowpass none", false, output, sizeof(output)));
+    CHECK(settings.filter_lowpass == static_cast<uint8_t>(LowpassMode::none));
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s trace.csv\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<double> times, values;
+    if (!load_trace(argv[1], times, values)) {
+        return 2;
+    }
+
+    host::serial_mute(true);
+    const Signal signal = make_signal(times, values);
+
+    // The unfiltered error is the noise (0.05), the spikes (5 degrees) and the quantization. The low pass stages
+    // trade noise for lag, only the median removes the spikes
+    const FilterCase cases[] = {
+        { "none", 1, LowpassMode::none, 0.0, 0.0, 0.01, 0.06, 5.2, 0.05 },
+        { "median 5", 5, LowpassMode::none, 0.0, 0.0, 0.01, 0.035, 0.45, 0.35 },
+        { "ema 0.2", 1, LowpassMode::ema, 0.2, 0.0, 0.01, 0.025, 1.3, 0.65 },
+        { "biquad 0.2 Hz", 1, LowpassMode::biquad, 0.2, 0.0, 0.01, 0.025, 1.0, 0.75 },
+        { "kalman", 1, LowpassMode::none, 0.0, 0.0002, 0.0025, 0.025, 1.5, 0.5 },
+        { "median+biquad+kalman", 5, LowpassMode::biquad, 0.3, 0.001, 0.0025, 0.025, 1.1, 1.0 },
+    };
+
+    for (const FilterCase& test : cases) {
+        run_case(test, signal);
+    }
+
+    test_dc_gain();
+    test_validation();
+    test_commands();
+
+    printf("%s, %d failures\n", failures == 0 ? "ok" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
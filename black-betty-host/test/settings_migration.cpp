@@ -0,0 +1,292 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <HostBoard.h>
+#include <flash_hal.h>
+
+#include "Settings.h"
+#include "SettingsJournal.h"
+#include "SettingsMigration.h"
+#include "SensorFilter.h"
+#include "RelayOutput.h"
+#include "util.h"
+#include "check.h"
+
+/*
+    Round trips of the settings through the flash journal and upgrades of older stored versions: journals
+    without a schema version record (version 1), the version 1 EEPROM blob, EEPROM records of an older version
+    and journals of a newer firmware.
+*/
+static void erase_journal() {
+    for (int sector = 0; sector < SETTINGS_JOURNAL_SECTORS; sector++) {
+        ESP.flashEraseSector(FS_PHYS_ADDR / SETTINGS_JOURNAL_SECTOR_SIZE + sector);
+    }
+}
+
+// Writes a record in the journal format, returns the offset of the next record
+static uint32_t write_record(uint32_t offset, uint8_t tag, const void* value, size_t size) {
+    uint32_t record[1 + SETTINGS_JOURNAL_MAX_FIELD_SIZE / 4] = {};
+    const uint8_t header[2] = { tag, static_cast<uint8_t>(size) };
+    const uint16_t crc = crc16(reinterpret_cast<const uint8_t*>(value), size, crc16(header, 2));
+    const size_t padded_size = (size + 3) & ~static_cast<size_t>(3);
+
+    record[0] = static_cast<uint32_t>(tag) | (static_cast<uint32_t>(size) << 8) | (static_cast<uint32_t>(crc) << 16);
+    memcpy(record + 1, value, size);
+    ESP.flashWrite(FS_PHYS_ADDR + offset, record, 4 + padded_size);
+    return offset + 4 + static_cast<uint32_t>(padded_size);
+}
+
+static void write_header(uint32_t sequence) {
+    const uint32_t header[2] = { SETTINGS_JOURNAL_MAGIC, sequence };
+    ESP.flashWrite(FS_PHYS_ADDR, header, sizeof(header));
+}
+
+static void set_custom(Settings& settings) {
+    settings.validate_set_wifi("machine", "network", "secret");
+    settings.validate_set_heater_pid(42.5, 1.25, 3.5);
+    settings.validate_set_heater_temperature_low(96.0);
+    settings.validate_set_heater_temperature_high(128.0);
+    settings.validate_set_heater_window(750);
+    settings.validate_set_temperature_offset(-1.5);
+    settings.validate_set_filter_median(3);
+    settings.validate_set_filter_lowpass(static_cast<uint8_t>(LowpassMode::biquad), 0.25);
+    settings.validate_set_filter_kalman(0.002, 0.004);
+    settings.validate_set_relay_mode(static_cast<uint8_t>(RelayMode::pulse));
+    settings.validate_set_relay_min_time(300);
+    settings.set_debug(true);
+    settings.relay_pin = 5;
+}
+
+static bool is_equal(const Settings& a, const Settings& b) {
+    return a.version == b.version && a.heater_window == b.heater_window && a.relay_pin == b.relay_pin &&
+        a.heater_toggle_pin == b.heater_toggle_pin && a.display_clock_pin == b.display_clock_pin &&
+        a.display_dio_pin == b.display_dio_pin && a.flags == b.flags &&
+        strcmp(a.device_id, b.device_id) == 0 && strcmp(a.wifi_ssid, b.wifi_ssid) == 0 &&
+        strcmp(a.wifi_password, b.wifi_password) == 0 && a.heater_kp == b.heater_kp && a.heater_ki == b.heater_ki &&
+        a.heater_kd == b.heater_kd && a.heater_temperature_low == b.heater_temperature_low &&
+        a.heater_temperature_high == b.heater_temperature_high && a.temperature_offset == b.temperature_offset &&
+        a.filter_median == b.filter_median && a.filter_lowpass == b.filter_lowpass &&
+        a.filter_lowpass_value == b.filter_lowpass_value && a.filter_kalman_q == b.filter_kalman_q &&
+        a.filter_kalman_r == b.filter_kalman_r && a.relay_mode == b.relay_mode && a.relay_min_time == b.relay_min_time;
+}
+
+static void test_round_trip() {
+    printf("round trip\n");
+    erase_journal();
+
+    Settings settings;
+    set_custom(settings);
+    SettingsJournal journal;
+    journal.request_save(settings);
+    journal.flush();
+
+    Settings loaded;
+    SettingsJournal reader;
+    CHECK(reader.load(loaded));
+    CHECK(is_equal(settings, loaded));
+    CHECK(loaded.version == SETTINGS_SCHEMA_VERSION);
+
+    // Enough saves to rotate through all sectors
+    const unsigned long erases = host::get_flash_erase_count();
+    for (int index = 0; index < 1500; index++) {
+        settings.validate_set_heater_pid(10.0 + index * 0.5, 2.0, 1.0);
+        journal.request_save(settings);
+        journal.flush();
+    }
+
+    CHECK(host::get_flash_erase_count() - erases >= SETTINGS_JOURNAL_SECTORS);
+    CHECK(host::get_flash_erase_count() - erases < 10);
+
+    Settings rotated;
+    SettingsJournal rotated_reader;
+    CHECK(rotated_reader.load(rotated));
+    CHECK(is_equal(settings, rotated));
+}
+
+static void test_torn_record() {
+    printf("torn record\n");
+    erase_journal();
+
+    Settings settings;
+    set_custom(settings);
+    SettingsJournal journal;
+    journal.request_save(settings);
+    journal.flush();
+
+    // The last record is the kp change, clear some of its bits like an interrupted write
+    settings.validate_set_heater_pid(99.0, 1.25, 3.5);
+    journal.request_save(settings);
+    journal.flush();
+
+    uint32_t last = 0, word;
+    for (uint32_t offset = 0; offset < SETTINGS_JOURNAL_SECTOR_SIZE; offset += 4) {
+        ESP.flashRead(FS_PHYS_ADDR + offset, &word, 4);
+        last = word != UINT32_MAX ? offset : last;
+    }
+
+    word = 0x00FF00FF;
+    ESP.flashWrite(FS_PHYS_ADDR + last, &word, 4);
+
+    Settings loaded;
+    SettingsJournal reader;
+    CHECK(reader.load(loaded));
+    CHECK(loaded.heater_kp == 42.5);
+
+    // The next save can not append behind the broken record and starts a new sector
+    loaded.validate_set_heater_pid(77.0, 1.25, 3.5);
+    reader.request_save(loaded);
+    reader.flush();
+
+    Settings reloaded;
+    SettingsJournal second_reader;
+    CHECK(second_reader.load(reloaded));
+    CHECK(reloaded.heater_kp == 77.0);
+}
+
+static void test_journal_version_1() {
+    printf("journal version 1\n");
+    erase_journal();
+
+    // The first journal format had no version record and no temperature offset
+    const double kp = 33.0, low = 99.0;
+    const char id[16] = "old-machine";
+    uint32_t offset = 8;
+    offset = write_record(offset, FIELD_DEVICE_ID, id, sizeof(id));
+    offset = write_record(offset, FIELD_HEATER_KP, &kp, sizeof(kp));
+    offset = write_record(offset, FIELD_HEATER_TEMPERATURE_LOW, &low, sizeof(low));
+    write_header(1);
+
+    Settings loaded;
+    SettingsJournal reader;
+    CHECK(reader.load(loaded));
+    CHECK(loaded.version == 1);
+    CHECK(migrate_settings(loaded));
+    CHECK(loaded.version == SETTINGS_SCHEMA_VERSION);
+    CHECK(strcmp(loaded.device_id, "old-machine") == 0);
+    CHECK(loaded.heater_kp == kp);
+    CHECK(loaded.heater_temperature_low == low);
+    CHECK(loaded.temperature_offset == 0.0);
+    CHECK(loaded.filter_median == 1);
+    CHECK(loaded.filter_lowpass == static_cast<uint8_t>(LowpassMode::none));
+    CHECK(loaded.filter_kalman_q == 0.0);
+    CHECK(loaded.relay_mode == static_cast<uint8_t>(RelayMode::window));
+    CHECK(loaded.relay_min_time == 200);
+
+    // Saving the upgraded settings only appends the version and the records of the new fields
+    reader.request_save(loaded);
+    reader.flush();
+
+    Settings reloaded;
+    SettingsJournal second_reader;
+    CHECK(second_reader.load(reloaded));
+    CHECK(reloaded.version == SETTINGS_SCHEMA_VERSION);
+    CHECK(reloaded.heater_kp == kp);
+}
+
+static void test_eeprom_version_1() {
+    printf("eeprom version 1\n");
+    erase_journal();
+
+    SettingsV1 blob;
+    memset(&blob, 0, sizeof(blob));
+    blob.magic = 0xB1ACBE71;
+    blob.version = 1;
+    blob.heater_window = 500;
+    blob.relay_pin = 15;
+    blob.heater_toggle_pin = 12;
+    blob.display_dio_pin = 2;
+    blob.flags = FLAG_COUNTDOWN_MODE;
+    strcpy(blob.device_id, "eeprom");
+    strcpy(blob.wifi_ssid, "wifi");
+    strcpy(blob.wifi_password, "password");
+    blob.heater_kp = 60.0;
+    blob.heater_ki = 3.0;
+    blob.heater_kd = 2.0;
+    blob.heater_temperature_low = 101.0;
+    blob.heater_temperature_high = 131.0;
+
+    EEPROM.begin(32 + sizeof(blob));
+    EEPROM.put<SettingsV1>(32, blob);
+    EEPROM.end();
+
+    Settings& settings = get_settings();
+    settings.load();
+    settings.flush();
+    CHECK(settings.version == SETTINGS_SCHEMA_VERSION);
+    CHECK(strcmp(settings.wifi_password, "password") == 0);
+    CHECK(settings.is_countdown_mode());
+    CHECK(settings.heater_kp == 60.0);
+    CHECK(settings.heater_temperature_high == 131.0);
+    CHECK(settings.temperature_offset == 0.0);
+
+    // The upgrade was stored in the journal
+    Settings loaded;
+    SettingsJournal reader;
+    CHECK(reader.load(loaded));
+    CHECK(is_equal(settings, loaded));
+}
+
+// Boards without a journal region keep the records in the EEPROM, they are upgraded like the journal
+static void test_eeprom_records() {
+    printf("eeprom records\n");
+    erase_journal();
+
+    Settings stored;
+    set_custom(stored);
+    stored.version = 3;
+    EEPROM.begin(32 + SETTINGS_EEPROM_SIZE);
+    CHECK(write_settings_records(stored, EEPROM.getDataPtr() + 32, SETTINGS_EEPROM_SIZE));
+    CHECK(!write_settings_records(stored, EEPROM.getDataPtr() + 32, 64));
+    EEPROM.end();
+
+    Settings replayed;
+    CHECK(read_settings_records(replayed, EEPROM.getConstDataPtr() + 32, SETTINGS_EEPROM_SIZE));
+    CHECK(is_equal(stored, replayed));
+    CHECK(!read_settings_records(replayed, EEPROM.getConstDataPtr(), SETTINGS_EEPROM_SIZE));
+
+    Settings& settings = get_settings();
+    settings.load();
+    settings.flush();
+    CHECK(settings.version == SETTINGS_SCHEMA_VERSION);
+    CHECK(settings.heater_kp == 42.5);
+    CHECK(settings.filter_median == 3);
+    CHECK(settings.relay_mode == static_cast<uint8_t>(RelayMode::window));
+    CHECK(settings.relay_min_time == 200);
+}
+
+static void test_newer_version() {
+    printf("newer version\n");
+    erase_journal();
+
+    const uint8_t version = SETTINGS_SCHEMA_VERSION + 1;
+    const double kp = 12.0;
+    const uint32_t unknown = 0x12345678;
+    uint32_t offset = 8;
+    offset = write_record(offset, FIELD_SCHEMA_VERSION, &version, sizeof(version));
+    offset = write_record(offset, 0x70, &unknown, sizeof(unknown));
+    offset = write_record(offset, FIELD_HEATER_KP, &kp, sizeof(kp));
+    write_header(1);
+
+    Settings loaded;
+    SettingsJournal reader;
+    CHECK(reader.load(loaded));
+    CHECK(loaded.heater_kp == kp);
+    CHECK(!migrate_settings(loaded));
+    CHECK(loaded.version == version);
+}
+
+int main() {
+    host::serial_mute(true);
+
+    test_round_trip();
+    test_torn_record();
+    test_journal_version_1();
+    test_eeprom_version_1();
+    test_eeprom_records();
+    test_newer_version();
+
+    printf("%s, %d failures\n", failures == 0 ? "ok" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <Arduino.h>
+#include <HostBoard.h>
+
+#include "Settings.h"
+#include "Status.h"
+#include "WebServer.h"
+#include "util.h"
+#include "check.h"
+
+/*
+    Fills the history with the output of the longest heater window the settings accept. The sum of a 1 s slot
+    must not overflow and the average has to survive the roll up into the coarse tiers and their json. The
+    complete /status with the longest device id and saturated history values has to fit STATUS_JSON_MAX_SIZE,
+    the async response buffer and the /events frames are sized by it.
+
+    Usage: test-status-history
+*/
+
+constexpr unsigned long SAMPLE_TIME = 5;
+constexpr int SLOT_SAMPLES = HISTORY_SLOT_TIME / SAMPLE_TIME;
+
+static void test_maximum_window() {
+    printf("maximum window\n");
+    Settings settings;
+    CHECK(!settings.validate_set_heater_window(UINT16_MAX));
+    CHECK(settings.validate_set_heater_window(UINT16_MAX - 1));
+    const double output = static_cast<double>(settings.heater_window);
+
+    // The first slot closes after 10 more slots, so the first tier slot is complete
+    Status status;
+    const unsigned long duration = (HISTORY_TIER_FACTOR[0] + 1) * HISTORY_SLOT_TIME + SAMPLE_TIME;
+    for (unsigned long time = 0; time < duration; time += SAMPLE_TIME) {
+        status.update_history(93.0, output, true, 1);
+        delay(SAMPLE_TIME);
+    }
+
+    const StatusHistoryItem& item = status.get_history(1);
+    const int64_t average = item.output.sum / item.samples;
+    printf("  slot: %d samples, sum %lld, average %lld\n", item.samples, static_cast<long long>(item.output.sum), static_cast<long long>(average));
+    CHECK(item.samples == SLOT_SAMPLES);
+    CHECK(item.output.min == to_milli(output));
+    CHECK(item.output.max == to_milli(output));
+    CHECK(average == to_milli(output));
+
+    char buffer[JSON_STREAM_ITEM_SIZE];
+    const uint8_t* end = binary_add_counter(reinterpret_cast<uint8_t*>(buffer), item.output, item.samples);
+    const uint32_t bits = end[-4] | (end[-3] << 8) | (end[-2] << 16) | (static_cast<uint32_t>(end[-1]) << 24);
+    CHECK(static_cast<int32_t>(bits) == to_milli(output));
+
+    const CompactHistoryItem& compact = status.get_history_tier(0).get(1);
+    printf("  tier: %u samples, average %d\n", compact.samples, compact.output.average);
+    CHECK(compact.samples >= HISTORY_TIER_FACTOR[0] * SLOT_SAMPLES);
+    CHECK(compact.output.average == static_cast<int16_t>(output * COMPACT_SCALE_OUTPUT));
+
+    *json_add_compact_counter(buffer, compact.output, true, COMPACT_SCALE_OUTPUT) = 0x00;
+    printf("  json: %s\n", buffer);
+    CHECK(strcmp(buffer, "65534.0,65534.0,65534.0,65534.0") == 0);
+}
+
+static size_t status_size = 0;
+
+static void count_status(const char* data, size_t size) {
+    status_size += size;
+}
+
+static void test_status_size() {
+    printf("status size\n");
+    CHECK(get_settings().validate_set_device_id("black-betty-012"));
+
+    // The live counters are clamped to -99.999 and 999.999 in the json, the longest values
+    Status& status = get_status();
+    for (int sample = 0; sample < (HISTORY_SIZE + 1) * SLOT_SAMPLES; sample++) {
+        status.update_history(sample % 2 == 0 ? -99.999 : 999.999, sample % 2 == 0 ? -99.999 : 999.999, sample % 2 == 0, 99999);
+        delay(SAMPLE_TIME);
+    }
+
+    char buffer[256];
+    JsonStream json(buffer, sizeof(buffer), count_status);
+    WebServer::create_status_json(json, -1);
+    json.flush();
+    printf("  %u bytes (max %u)\n", static_cast<unsigned>(status_size), static_cast<unsigned>(STATUS_JSON_MAX_SIZE));
+    CHECK(status_size <= STATUS_JSON_MAX_SIZE);
+}
+
+int main(int argc, char** argv) {
+    host::serial_mute(true);
+
+    test_maximum_window();
+    test_status_size();
+
+    printf("%s, %d failures\n", failures == 0 ? "ok" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
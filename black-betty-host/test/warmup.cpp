@@ -0,0 +1,151 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <Arduino.h>
+#include <HostBoard.h>
+
+#include "Simulation.h"
+#include "Settings.h"
+#include "Status.h"
+#include "HeaterPID.h"
+#include "WarmupController.h"
+#include "CommandParser.h"
+#include "WebServer.h"
+#include "check.h"
+
+/*
+    Runs the warm-up on the simulated plant: a cold start and a switch from the low to the high temperature.
+    Both have to reach the band around the setpoint in time and must not overshoot it. The boiler model
+    identified on the way is compared with the parameters of the plant and the status with its warm-up block
+    has to fit into an /events frame.
+
+    Usage: test-warmup
+*/
+
+// Band around the setpoint the machine is ready in and how long it has to stay there (s)
+constexpr double READY_BAND = 0.5;
+constexpr int READY_HOLD = 120;
+
+// With the pid alone both overshoot by about 6°, the cold start is ready after 300 s, low to high after 180 s
+constexpr int MAX_COLD_READY = 150;
+constexpr int MAX_HIGH_READY = 90;
+constexpr double MAX_OVERSHOOT = 1.0;
+
+// Allowed relative error of the identified rate and loss
+constexpr double MAX_RATE_ERROR = 0.15;
+constexpr double MAX_LOSS_ERROR = 0.2;
+
+// Seconds until the sensor temperature entered the band for good and the largest overshoot on the way
+static void run_to_ready(Simulation& simulation, int seconds, int& ready, double& overshoot) {
+    const Status& status = get_status();
+    const HeaterPID& heater = get_heater();
+    ready = -1;
+    overshoot = 0.0;
+    for (int second = 0; second < seconds; second++) {
+        simulation.run_for(1000);
+        const double error = status.temperature - heater.get_setpoint();
+        overshoot = error > overshoot ? error : overshoot;
+        if (fabs(error) > READY_BAND) {
+            ready = -1;
+        } else if (ready < 0) {
+            ready = second + 1;
+        }
+    }
+}
+
+static void test_cold_start(Simulation& simulation) {
+    printf("cold start\n");
+    int ready;
+    double overshoot;
+    run_to_ready(simulation, MAX_COLD_READY + READY_HOLD, ready, overshoot);
+    printf("  ready after %d s (max %d), overshoot %.2f (max %.2f)\n", ready, MAX_COLD_READY, overshoot, MAX_OVERSHOOT);
+    CHECK(ready > 0 && ready <= MAX_COLD_READY);
+    CHECK(overshoot <= MAX_OVERSHOOT);
+    CHECK(!get_heater().get_warmup().is_active());
+}
+
+static void test_model(Simulation& simulation) {
+    printf("model\n");
+
+    // Regulation teaches the model the loss at the setpoint
+    simulation.run_for(10UL * 60UL * 1000UL);
+
+    const BoilerPlant::Parameters& plant = simulation.get_plant().get_parameters();
+    const double capacity = plant.plate_capacity + plant.boiler_capacity;
+    const double rate = plant.heater_power / capacity;
+    const double loss = plant.boiler_to_ambient / capacity;
+    const BoilerModel& model = get_heater().get_warmup().get_model();
+    printf("  dead time %.2f s, rate %.4f (plant %.4f), loss %.6f (plant %.6f), ambient %.2f\n", model.get_dead_time(),
+        model.get_rate(), rate, model.get_loss(), loss, model.get_ambient());
+    CHECK(model.is_identified());
+    CHECK(model.get_dead_time() > plant.sensor_lag && model.get_dead_time() < 20.0);
+    CHECK(fabs(model.get_rate() - rate) <= MAX_RATE_ERROR * rate);
+    CHECK(fabs(model.get_loss() - loss) <= MAX_LOSS_ERROR * loss);
+    CHECK(fabs(model.get_ambient() - plant.ambient_temperature) < 0.5);
+}
+
+static size_t status_size = 0;
+
+static void count_status(const char* data, size_t size) {
+    status_size += size;
+}
+
+// The complete history goes out to every new /events client, "data: " and the blank line frame it
+static void test_status_frame() {
+    printf("status frame\n");
+    char buffer[256];
+    JsonStream json(buffer, sizeof(buffer), count_status);
+    WebServer::create_status_json(json, -1);
+    json.flush();
+    printf("  %u bytes (max %u)\n", static_cast<unsigned>(status_size + 8), static_cast<unsigned>(EVENT_FRAME_SIZE));
+    CHECK(status_size + 8 <= EVENT_FRAME_SIZE);
+}
+
+static void test_low_to_high(Simulation& simulation) {
+    printf("low to high\n");
+    host::set_pin(get_settings().heater_toggle_pin, HIGH);
+
+    int ready;
+    double overshoot;
+    run_to_ready(simulation, MAX_HIGH_READY + READY_HOLD, ready, overshoot);
+    printf("  ready after %d s (max %d), overshoot %.2f (max %.2f)\n", ready, MAX_HIGH_READY, overshoot, MAX_OVERSHOOT);
+    CHECK(get_heater().get_setpoint() == get_settings().heater_temperature_high);
+    CHECK(ready > 0 && ready <= MAX_HIGH_READY);
+    CHECK(overshoot <= MAX_OVERSHOOT);
+
+    // Back to low is left to the pid
+    host::set_pin(get_settings().heater_toggle_pin, LOW);
+    simulation.run_for(1000);
+    CHECK(!get_heater().get_warmup().is_active());
+}
+
+static void test_commands() {
+    printf("commands\n");
+    char output[128];
+    CHECK(execute("get warmup", output, sizeof(output)));
+    CHECK(strncmp(output, "true idle ", 10) == 0);
+    CHECK(execute("set warmup false", output, sizeof(output)));
+    CHECK(!get_settings().is_warmup());
+    CHECK(!execute("set warmup maybe", output, sizeof(output)));
+}
+
+int main(int argc, char** argv) {
+    host::serial_mute(true);
+    Simulation simulation;
+    simulation.begin();
+
+    // Disabled by default, the warm-up starts with the first sample after it is enabled
+    char output[128];
+    CHECK(!get_settings().is_warmup());
+    CHECK(execute("set warmup true", output, sizeof(output)));
+
+    test_cold_start(simulation);
+    test_model(simulation);
+    test_status_frame();
+    test_low_to_high(simulation);
+    test_commands();
+
+    printf("%s, %d failures\n", failures == 0 ? "ok" : "FAIL", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,24 @@
+# Fails if the web interface changed after the page in WebServer_index.cpp was exported. The exporters note the
+# hash of the sources, the same as "sha256sum index.html index.css index.ts src/*.ts | sha256sum"
+#
+# Usage: cmake -DWEB_DIR=<black-betty-web> -DINDEX_FILE=<WebServer_index.cpp> -P web_bundle.cmake
+
+file(GLOB modules RELATIVE ${WEB_DIR} ${WEB_DIR}/src/*.ts)
+list(SORT modules)
+
+set(lines "")
+foreach(source index.html index.css index.ts ${modules})
+    file(SHA256 ${WEB_DIR}/${source} hash)
+    string(APPEND lines "${hash}  ${source}\n")
+endforeach()
+
+string(SHA256 hash "${lines}")
+string(SUBSTRING ${hash} 0 16 hash)
+
+file(STRINGS ${INDEX_FILE} exported REGEX "^// Sources: [0-9a-f]+$")
+string(REPLACE "// Sources: " "" exported "${exported}")
+if(NOT exported STREQUAL hash)
+    message(FATAL_ERROR "The page was exported from other sources (${exported}, now ${hash}), run npm run export or npm run export-node in black-betty-web")
+endif()
+
+message(STATUS "The page matches the sources (${hash})")
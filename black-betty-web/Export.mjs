@@ -0,0 +1,85 @@
+// Exports the page without parcel and PowerShell (npm run export-node), needs node 22.13 or newer for the type
+// stripping. The modules are concatenated into one classic script instead of being bundled and minified, so the
+// page is larger than the one of Export.ps1 but shows the same interface
+import { createHash } from "node:crypto";
+import { readdirSync, readFileSync, writeFileSync } from "node:fs";
+import { stripTypeScriptTypes } from "node:module";
+import { gzipSync } from "node:zlib";
+
+// index.ts imports the modules, every module only uses the ones before it
+const modules = ["src/Status.ts", "src/HistoryGraph.ts", "src/Command.ts", "src/AppUI.ts", "index.ts"];
+const scriptTag = "<script type=\"module\" src=\"index.ts\"></script>";
+const styleTag = "<link rel=\"stylesheet\" href=\"index.css\" />";
+
+// Same as "sha256sum index.html index.css index.ts src/*.ts | sha256sum", the host build compares it to detect a
+// page that was not exported again after the sources changed
+function hashSources() {
+    const files = ["index.html", "index.css", "index.ts", ...readdirSync("src").filter(name => name.endsWith(".ts")).sort().map(name => "src/" + name)];
+    const lines = files.map(file => createHash("sha256").update(readFileSync(file)).digest("hex") + "  " + file + "\n");
+    return createHash("sha256").update(lines.join("")).digest("hex").substring(0, 16);
+}
+
+// All modules share one scope, so a name may only be declared once
+function bundleScript() {
+    const names = new Map();
+    let script = "";
+    for (const file of modules) {
+        let code = readFileSync(file, "utf8").replace(/^import .* from "[^"]+";\s*$/mg, "");
+        code = stripTypeScriptTypes(code, { mode: "transform" }).replace(/^export /mg, "");
+        for (const match of code.matchAll(/^(?:async )?(?:function|class|const|let|var) ([A-Za-z_$][\w$]*)/mg)) {
+            if (names.has(match[1])) {
+                throw new Error(`${match[1]} is declared in ${names.get(match[1])} and ${file}`);
+            }
+            names.set(match[1], file);
+        }
+
+        script += "// " + file + "\n" + code + "\n";
+    }
+
+    return "<script>(function () {\n\"use strict\";\n" + script + "})();</script>";
+}
+
+function formatBytes(data) {
+    const lines = [];
+    for (let offset = 0; offset < data.length; offset += 16) {
+        lines.push("    " + Array.from(data.subarray(offset, offset + 16), value => "0x" + value.toString(16).padStart(2, "0") + ",").join(" "));
+    }
+
+    return lines.join("\n");
+}
+
+function exportPage() {
+    console.log("Exporting html package to ESP8266 sources");
+    let page = readFileSync("index.html", "utf8");
+    if (!page.includes(scriptTag) || !page.includes(styleTag)) {
+        throw new Error("index.html has no script or stylesheet tag to inline");
+    }
+
+    page = page.replace(scriptTag, () => bundleScript());
+    page = page.replace(styleTag, () => "<style>" + readFileSync("index.css", "utf8") + "</style>");
+
+    // The etag is the start of the sha256 of the compressed page, like the one of Export.ps1
+    const bytes = gzipSync(Buffer.from(page, "utf8"), { level: 9 });
+    const etag = createHash("sha256").update(bytes).digest("hex").substring(0, 16);
+
+    const content = `#include "WebServer.h"
+
+#include <sys/pgmspace.h>
+
+// Generated by black-betty-web/Export.mjs (npm run export-node): index.html with the type stripped scripts and the styles inlined, gzip compressed
+// Sources: ${hashSources()}
+static const uint8_t webpage_index_local[] PROGMEM = {
+${formatBytes(bytes)}
+};
+
+static const char webpage_index_etag_local[] PROGMEM = "\\"${etag}\\"";
+
+const uint8_t* WebServer::webpage_index_content = webpage_index_local;
+const size_t WebServer::webpage_index_size = sizeof(webpage_index_local);
+const __FlashStringHelper* WebServer::webpage_index_etag = reinterpret_cast<const __FlashStringHelper*>(webpage_index_etag_local);
+`;
+
+    writeFileSync("../black-betty/WebServer_index.cpp", content, "ascii");
+}
+
+exportPage();
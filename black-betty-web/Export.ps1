@@ -16,24 +16,61 @@ function Replace-Css([System.Text.RegularExpressions.Match] $Match) {
     return "<style>" + $local:content + "</style>";
 }
 
+# The page is served gzip compressed, browsers decompress it on their own
+function Compress([byte[]] $Data) {
+    $local:output = New-Object System.IO.MemoryStream
+    $local:gzip = New-Object System.IO.Compression.GZipStream($local:output, [System.IO.Compression.CompressionLevel]::Optimal)
+    $local:gzip.Write($Data, 0, $Data.Length)
+    $local:gzip.Close()
+    return ,$local:output.ToArray()
+}
+
+function Format-Bytes([byte[]] $Data) {
+    $local:lines = for ($local:offset = 0; $local:offset -lt $Data.Length; $local:offset += 16) {
+        $local:last = [Math]::Min($local:offset + 15, $Data.Length - 1)
+        "    " + (($Data[$local:offset..$local:last] | ForEach-Object { "0x{0:x2}," -f $_ }) -join " ")
+    }
+    return $local:lines -join "`n"
+}
+
+# Same as "sha256sum index.html index.css index.ts src/*.ts | sha256sum", the host build compares it to detect a
+# page that was not exported again after the sources changed
+function Hash-Sources() {
+    $local:files = @("index.html", "index.css", "index.ts") + (Get-ChildItem -Path "./src" -Filter "*.ts" | Sort-Object Name | ForEach-Object { "src/" + $_.Name })
+    $local:lines = $local:files | ForEach-Object { (Get-FileHash -LiteralPath $_ -Algorithm SHA256).Hash.ToLower() + "  " + $_ + "`n" }
+    $local:hash = [System.Security.Cryptography.SHA256]::Create().ComputeHash([System.Text.Encoding]::ASCII.GetBytes(-join $local:lines))
+    return -join ($local:hash[0..7] | ForEach-Object { "{0:x2}" -f $_ })
+}
+
 function Export()
 {
     $local:content = Get-Content -LiteralPath "./dist/index.html" -Raw -Encoding UTF8;
     $local:content = [regex]::Replace($local:content, "<script src=`"(?<File>[^`"]+)`"></script>", { param($Match) Replace-Script($Match) }, $options)
     $local:content = [regex]::Replace($local:content, "<link rel=`"stylesheet`" href=`"(?<File>[^`"]+)`">", { param($Match) Replace-Css($Match) }, $options)
-    
+
+    # The etag is the start of the sha256 of the compressed page, it changes with every new export
+    [byte[]] $local:bytes = Compress([System.Text.Encoding]::UTF8.GetBytes($local:content))
+    $local:hash = [System.Security.Cryptography.SHA256]::Create().ComputeHash($local:bytes)
+    $local:etag = -join ($local:hash[0..7] | ForEach-Object { "{0:x2}" -f $_ })
+
     $local:content = @"
 #include "WebServer.h"
 
 #include <sys/pgmspace.h>
 
-static const char webpage_index_local[] PROGMEM = R"###(
-$($local:content)
-)###";
+// Generated by black-betty-web/Export.ps1 (npm run export): index.html with the inlined scripts and styles, gzip compressed
+// Sources: $(Hash-Sources)
+static const uint8_t webpage_index_local[] PROGMEM = {
+$(Format-Bytes($local:bytes))
+};
+
+static const char webpage_index_etag_local[] PROGMEM = "\"$($local:etag)\"";
 
-const __FlashStringHelper* WebServer::webpage_index_content = reinterpret_cast<const __FlashStringHelper*>(webpage_index_local);
+const uint8_t* WebServer::webpage_index_content = webpage_index_local;
+const size_t WebServer::webpage_index_size = sizeof(webpage_index_local);
+const __FlashStringHelper* WebServer::webpage_index_etag = reinterpret_cast<const __FlashStringHelper*>(webpage_index_etag_local);
 "@
 
-    $local:content | Out-File -LiteralPath "../black-betty/WebServer_index.cpp" -Encoding UTF8 -Force
+    $local:content | Out-File -LiteralPath "../black-betty/WebServer_index.cpp" -Encoding ascii -Force
 }
 Export
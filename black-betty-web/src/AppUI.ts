@@ -1,5 +1,5 @@
-import { getStatus, StatusResponse } from "./Status";
-import { execute } from "./Command";
+import { getHistoryTier, getStatusBinary, parseStatus, subscribeStatus, HistoryTierResponse, StatusResponse } from "./Status";
+import { execute, executeBatch } from "./Command";
 import { HistoryGraph } from "./HistoryGraph";
 
 
@@ -7,11 +7,21 @@ export class AppUI {
     private status: StatusResponse | null;
     private graphs: HistoryGraph[];
     private active: boolean;
+    private events: EventSource | null;
+
+    // Range of the graphs: 0 is the live history of the status, 1 and 2 are the coarse tiers of the device
+    private range: number;
+    private tier: HistoryTierResponse | null;
+    private tierTime: number;
 
     constructor() {
         this.status = null;
         this.graphs = [];
         this.active = true;
+        this.events = null;
+        this.range = 0;
+        this.tier = null;
+        this.tierTime = 0;
     }
 
     public init(): void {
@@ -27,6 +37,14 @@ export class AppUI {
             }
         });
 
+        // Select the history range of the graphs
+        this.on("history-range", "change", async () => {
+            this.range = parseInt(this.getText("history-range")) || 0;
+            this.tier = null;
+            await this.updateTier();
+            this.render();
+        });
+
         // Open setting pane
         this.on("setting-open", "click", async () => {
             const element = this.get("setting-panel");
@@ -80,9 +98,14 @@ export class AppUI {
             }
         });
 
-        // Save values to eeprom
+        // Apply the values of the dialog and save them to eeprom in one request
         this.on("setting-save", "click", async () => {
-            await execute(this, "SAVE");
+            const low = parseFloat(this.getText("setting-temperature-low"));
+            const high = parseFloat(this.getText("setting-temperature-high"));
+            const kp = parseFloat(this.getText("setting-pid-kp"));
+            const ki = parseFloat(this.getText("setting-pid-ki"));
+            const kd = parseFloat(this.getText("setting-pid-kd"));
+            await executeBatch(this, ["SET heater " + low + " " + high, "SET pid " + kp + " " + ki + " " + kd, "SAVE"]);
         });
 
         // Restart
@@ -99,6 +122,14 @@ export class AppUI {
         if (notify != null) {
             notify.style.display = "none";
         }
+
+        // Live status pushed by the device, the history is merged even while inactive so no slot gets lost
+        this.events = subscribeStatus((source) => {
+            this.status = parseStatus(source, this.status);
+            if (this.active) {
+                this.render();
+            }
+        });
     }
 
     public async update(): Promise<void> {
@@ -106,8 +137,38 @@ export class AppUI {
         if (!this.active) {
             return;
         }
-        
-        this.status = await getStatus(this.status);
+
+        // Polling is the fallback while the event stream is not open, the tiers are always polled
+        const updated = await this.updateTier();
+        if (this.events != null && this.events.readyState === EventSource.OPEN) {
+            if (updated) {
+                this.render();
+            }
+            return;
+        }
+
+        this.status = await getStatusBinary(this.status);
+        this.render();
+    }
+
+    // Fetches the selected tier once per slot of it, returns true if it was fetched. Without the tier (e.g. the async
+    // web server has no /history) the graphs show the live history
+    private async updateTier(): Promise<boolean> {
+        if (this.range === 0 || (this.tier != null && Date.now() - this.tierTime < this.tier.window)) {
+            return false;
+        }
+
+        try {
+            this.tierTime = Date.now();
+            this.tier = await getHistoryTier(this.range);
+            return true;
+        } catch (ex) {
+            this.tier = null;
+            return false;
+        }
+    }
+
+    private render(): void {
         if (this.status == null) {
             return;
         }
@@ -131,7 +192,10 @@ export class AppUI {
         t("heater-mode", heater.mode);
         t("heater-active", heater.active);
 
-        this.graphs.forEach((graph) => graph.update(this.status, 15, 1));
+        // The tiers hold 60 slots, the grid is drawn every minute (10 s slots) or every 10 minutes (1 minute slots)
+        const { history, window: slotWindow } = this.tier != null ? this.tier : this.status;
+        const [maxItems, xStep] = this.tier != null ? [60, this.range === 1 ? 6 : 10] : [15, 1];
+        this.graphs.forEach((graph) => graph.update(history, slotWindow, maxItems, xStep));
     }
 
     public getToken(): number {
@@ -173,7 +237,7 @@ export class AppUI {
 
     private getText(id: string): string {
         const element = this.get(id);
-        if (element instanceof HTMLInputElement) {
+        if (element instanceof HTMLInputElement || element instanceof HTMLSelectElement) {
             return element.value || "";
         } else if (element instanceof HTMLElement) {
             return element.textContent || "";
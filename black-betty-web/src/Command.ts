@@ -18,3 +18,18 @@ export async function execute(app: AppUI, command: string): Promise<void> {
 
     }
 }
+
+// Executes the commands in one request, the device applies all of them or none
+export async function executeBatch(app: AppUI, commands: string[]): Promise<boolean> {
+    const content = ["TOKEN " + app.getToken(), ...commands].join("\n");
+
+    try {
+        const response = await window.fetch(getApiUri("/batch"), { "method": "POST", body: content });
+        const results = <CommandResult[]>await response.json();
+        const failed = results.find((result) => !result.success);
+        app.notify(failed == null ? "Successfully executed commands" : "Error executing commands", failed == null ? "ok" : failed.message);
+        return failed == null;
+    } catch (ex) {
+        return false;
+    }
+}
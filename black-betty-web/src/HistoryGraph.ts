@@ -1,4 +1,4 @@
-import { StatusResponse, StatusResponseHistoryStat } from "./Status";
+import { StatusResponseHistoryItem, StatusResponseHistoryStat } from "./Status";
 
 export type HistoryProperty = ("temperature" | "output" | "heater" | "health");
 
@@ -55,10 +55,11 @@ export class HistoryGraph {
         canvas.stroke();
     }
 
-    public update(status: StatusResponse | null, maxItems: number, xStep: number) {
+    // Draws the newest slots of the history, slotWindow is the duration of a slot in ms
+    public update(history: StatusResponseHistoryItem[], slotWindow: number, maxItems: number, xStep: number) {
         // Check for valid canvas
         const canvas = this.element?.getContext("2d");
-        if (canvas == null || status == null) {
+        if (canvas == null || history.length === 0) {
             return;
         }
 
@@ -77,7 +78,7 @@ export class HistoryGraph {
         }
         
         let items: StatusResponseHistoryStat[] = [];
-        status.history.slice(0, maxItems).forEach((item) => {
+        history.slice(0, maxItems).forEach((item) => {
             const stat: StatusResponseHistoryStat = item[this.property];
             bounding.min = Math.min(bounding.min, stat.min);
             bounding.max = Math.max(bounding.max, stat.max);
@@ -97,8 +98,11 @@ export class HistoryGraph {
         
         // Calculate grid layout
         let layout : HistoryGridInfo = { "x": [], xy1: bounding.height, xy2: 0, "y": [], yx1: bounding.left, yx2:bounding.fullWidth };
+
+        // The coarse tiers are labeled in minutes
         for (let grid = 0; grid < maxItems; grid++) {
-            layout.x.push({ "x": px(grid), "label": (-grid * status.window / 1000.0).toFixed(1) + "s" });
+            const label = slotWindow >= 10000 ? (-grid * slotWindow / 60000.0).toFixed(0) + "min" : (-grid * slotWindow / 1000.0).toFixed(1) + "s";
+            layout.x.push({ "x": px(grid), "label": label });
         }
 
         for (let grid = Math.floor(bounding.min / this.axisInfo.yStep) * this.axisInfo.yStep; grid < bounding.max; grid += this.axisInfo.yStep) {
@@ -25,7 +25,7 @@ interface CommonStatusResponse {
     window: number;
 }
 
-interface RawStatusResponse extends CommonStatusResponse {
+export interface RawStatusResponse extends CommonStatusResponse {
     history: {
         // 4-pair value of current, min, max, avg
         temperature: number[];
@@ -75,10 +75,31 @@ function explode(index: number, array: number[]): StatusResponseHistoryStat {
     return { "current": array[offset], "min": array[offset + 1], "max": array[offset + 2], "average": array[offset + 3] };
 }
 
-export async function getStatus(oldStatus: StatusResponse | null): Promise<StatusResponse> {
-    const response = await window.fetch(getApiUri("/status"), { "method": "GET" });
-    const source = <RawStatusResponse>await response.json();
+// Query for only the history slots the client does not have yet. The newest known slot is requested again since it was
+// still filling up, the device answers with the complete history if it does not know the sequence (e.g. after a restart)
+function sinceQuery(oldStatus: StatusResponse | null): string {
+    if (oldStatus == null || oldStatus.history.length === 0) {
+        return "";
+    }
+
+    return "?since=" + oldStatus.history[0].sequence;
+}
+
+function mergeHistory(status: StatusResponse, oldStatus: StatusResponse | null): StatusResponse {
+    // Merge with old history, a lower sequence than before means the device restarted and the old history is discarded
+    const restarted = oldStatus != null && oldStatus.history.length > 0 && status.history.length > 0 && status.history[0].sequence < oldStatus.history[0].sequence;
+    if (oldStatus != null && !restarted) {
+        const sequences = status.history.map((item) => item.sequence);
+        status.history.push(...oldStatus.history.filter((item) => sequences.indexOf(item.sequence) === -1));
+    }
 
+    // Limit history to 120 entries
+    status.history = status.history.slice(0, 120);
+    return status
+}
+
+// Converts the json of /status (and of the /events frames) and merges it with the known history
+export function parseStatus(source: RawStatusResponse, oldStatus: StatusResponse | null): StatusResponse {
     const status: StatusResponse = {
         "id": source.id,
         "token": source.token,
@@ -104,13 +125,118 @@ export async function getStatus(oldStatus: StatusResponse | null): Promise<Statu
         });
     }
 
-    // Merge with old history
-    if (oldStatus != null) {
-        const sequences = status.history.map((item) => item.sequence);
-        status.history.push(...oldStatus.history.filter((item) => sequences.indexOf(item.sequence) === -1));
+    return mergeHistory(status, oldStatus);
+}
+
+export async function getStatus(oldStatus: StatusResponse | null): Promise<StatusResponse> {
+    const response = await window.fetch(getApiUri("/status" + sinceQuery(oldStatus)), { "method": "GET" });
+    return parseStatus(<RawStatusResponse>await response.json(), oldStatus);
+}
+
+// Opens the /events stream, every frame is a status json with the history slots since the previous frame. The browser
+// reconnects on its own, the stream is not available with the async web server (it answers 404)
+export function subscribeStatus(onStatus: (source: RawStatusResponse) => void): EventSource | null {
+    if (typeof window.EventSource === "undefined") {
+        return null;
     }
 
-    // Limit history to 120 entries
-    status.history = status.history.slice(0, 120);
-    return status
+    const events = new window.EventSource(getApiUri("/events"));
+    events.onmessage = (event: MessageEvent) => onStatus(<RawStatusResponse>JSON.parse(event.data));
+    return events;
+}
+
+export interface HistoryTierResponse {
+    window: number
+    history: StatusResponseHistoryItem[]
+}
+
+// Coarse history kept on the device, tier 1 has 10 second slots and tier 2 has 1 minute slots. Compacted slots carry no
+// current value, the average is reported instead
+export async function getHistoryTier(tier: number): Promise<HistoryTierResponse> {
+    const response = await window.fetch(getApiUri("/history?tier=" + tier), { "method": "GET" });
+    const source = <RawStatusResponse["history"] & { window: number }>await response.json();
+
+    const result: HistoryTierResponse = { "window": source.window, "history": [] };
+    const count = source.samples.length;
+    for (let index = 0; index < count; index++) {
+        result.history.push({
+            "sequence": source.sequence[index],
+            "samples": source.samples[index],
+            "temperature": explode(index, source.temperature),
+            "output": explode(index, source.output),
+            "heater": explode(index, source.heater),
+            "health": explode(index, source.health)
+        });
+    }
+
+    return result;
+}
+
+// Layout version of /status.bin, see WebServer.h
+const STATUS_BINARY_VERSION = 1;
+const STATUS_BINARY_HEADER_SIZE = 68;
+const STATUS_BINARY_ITEM_SIZE = 72;
+const HEATER_MODES: ("off" | "low" | "high")[] = ["off", "low", "high"];
+
+export function decodeStatusBinary(buffer: ArrayBuffer): StatusResponse {
+    const view = new DataView(buffer);
+    if (buffer.byteLength < STATUS_BINARY_HEADER_SIZE || view.getUint8(0) !== 0x42 || view.getUint8(1) !== 0x42) {
+        throw new Error("Invalid binary status");
+    }
+
+    if (view.getUint8(2) !== STATUS_BINARY_VERSION) {
+        throw new Error("Unsupported binary status version " + view.getUint8(2));
+    }
+
+    // All values are little endian, doubles are transferred as int32 milli units
+    let offset = 0;
+    const u8 = () => view.getUint8(offset++);
+    const u16 = () => { const value = view.getUint16(offset, true); offset += 2; return value; };
+    const i32 = () => { const value = view.getInt32(offset, true); offset += 4; return value; };
+    const milli = () => i32() / 1000;
+    const stat = (): StatusResponseHistoryStat => ({ "current": milli(), "min": milli(), "max": milli(), "average": milli() });
+
+    offset = 3;
+    const count = u8();
+    const mode = HEATER_MODES[u8()] || "off";
+    const flags = u8();
+    const historyWindow = u16();
+    const token = i32();
+
+    const id = new Uint8Array(buffer, offset, 16);
+    const idLength = id.indexOf(0);
+    offset += 16;
+
+    const status: StatusResponse = {
+        "id": new TextDecoder().decode(id.subarray(0, idLength < 0 ? 16 : idLength)),
+        "token": token,
+        "isDebug": (flags & 0x01) !== 0,
+        "isCountdownMode": (flags & 0x02) !== 0,
+        "temperature": { "current": milli(), "target": milli(), "low": milli(), "high": milli() },
+        "pid": { "kp": milli(), "ki": milli(), "kd": milli(), "input": milli(), "output": milli(), "setpoint": milli() },
+        "heater": { "mode": mode, "active": (flags & 0x04) !== 0 },
+        "window": historyWindow || 1000,
+        "history": []
+    };
+
+    for (let index = 0; index < count && offset + STATUS_BINARY_ITEM_SIZE <= buffer.byteLength; index++) {
+        const sequence = i32();
+        const samples = u16();
+        offset += 2;
+        status.history.push({
+            "sequence": sequence,
+            "samples": samples,
+            "temperature": stat(),
+            "output": stat(),
+            "heater": stat(),
+            "health": stat()
+        });
+    }
+
+    return status;
+}
+
+export async function getStatusBinary(oldStatus: StatusResponse | null): Promise<StatusResponse> {
+    const response = await window.fetch(getApiUri("/status.bin" + sinceQuery(oldStatus)), { "method": "GET" });
+    return mergeHistory(decodeStatusBinary(await response.arrayBuffer()), oldStatus);
 }
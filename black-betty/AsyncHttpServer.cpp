@@ -0,0 +1,443 @@
+#include "AsyncHttpServer.h"
+
+#if WEBSERVER_ASYNC
+
+#include <algorithm>
+#include <sys/pgmspace.h>
+
+#include "util.h"
+
+// Bounded append of a ram or flash string, returns the new end
+static char* append(char* pos, const char* end, const char* text) {
+    const size_t size = std::min(strlen(text), static_cast<size_t>(end - pos));
+    memcpy(pos, text, size);
+    return pos + size;
+}
+
+static char* append_P(char* pos, const char* end, PGM_P text) {
+    const size_t size = std::min(strlen_P(text), static_cast<size_t>(end - pos));
+    memcpy_P(pos, text, size);
+    return pos + size;
+}
+
+static const char* get_status_text(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 406: return "Not Acceptable";
+        case 413: return "Payload Too Large";
+        default: return "Internal Server Error";
+    }
+}
+
+AsyncHttpConnection::AsyncHttpConnection() : server(nullptr), client(nullptr), state(AsyncHttpState::free) {
+    this->release();
+}
+
+HttpMethod AsyncHttpConnection::get_method() const {
+    return this->method;
+}
+
+const char* AsyncHttpConnection::get_path() const {
+    return this->path;
+}
+
+const char* AsyncHttpConnection::get_body() const {
+    return this->request + this->head_size;
+}
+
+// Query arguments are not url decoded, the routes only use numbers
+bool AsyncHttpConnection::get_argument(const char* name, char* output, size_t size) const {
+    const size_t name_size = strlen(name);
+    for (const char* pos = this->query; *pos != 0x00; ) {
+        const char* end = strchr(pos, '&');
+        const size_t pair_size = end != nullptr ? static_cast<size_t>(end - pos) : strlen(pos);
+        if (pair_size >= name_size && strncmp(pos, name, name_size) == 0 && (pair_size == name_size || pos[name_size] == '=')) {
+            const size_t value_size = pair_size > name_size ? std::min(pair_size - name_size - 1, size - 1) : 0;
+            memcpy(output, pos + name_size + 1, value_size);
+            output[value_size] = 0x00;
+            return true;
+        }
+
+        pos += pair_size + (end != nullptr ? 1 : 0);
+    }
+
+    return false;
+}
+
+// The header lines were split by parse_head, every line is terminated
+bool AsyncHttpConnection::get_header(const char* name, char* output, size_t size) const {
+    const size_t name_size = strlen(name);
+    for (const char* line = this->header_lines; line < this->request + this->head_size - 2; line += strlen(line) + 2) {
+        if (strncasecmp(line, name, name_size) == 0 && line[name_size] == ':') {
+            const char* value = line + name_size + 1;
+            while (*value == ' ') {
+                value++;
+            }
+
+            strncpy(output, value, size - 1);
+            output[size - 1] = 0x00;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void AsyncHttpConnection::add_header(const __FlashStringHelper* name, const __FlashStringHelper* value) {
+    if (this->header_count < ASYNC_HTTP_MAX_HEADERS) {
+        this->headers[this->header_count++] = { name, value };
+    }
+}
+
+void AsyncHttpConnection::write(const char* data, size_t size) {
+    if (this->response_end + size > ASYNC_HTTP_RESPONSE_SIZE) {
+        this->response_overflow = true;
+        return;
+    }
+
+    memcpy(this->response + this->response_end, data, size);
+    this->response_end += size;
+}
+
+void AsyncHttpConnection::send(int code, const __FlashStringHelper* content_type) {
+    // One response per request
+    if (this->state == AsyncHttpState::sending || this->state == AsyncHttpState::closing || this->client == nullptr) {
+        return;
+    }
+
+    if (this->response_overflow) {
+        Serial.printf("AsyncHttpConnection::send Response of %s does not fit into %d bytes\n", this->path, ASYNC_HTTP_RESPONSE_SIZE);
+        this->response_end = ASYNC_HTTP_HEAD_SIZE;
+        this->response_overflow = false;
+        this->header_count = 0;
+        this->flash_size = 0;
+        this->send(500, F("text/plain"), "Response too large");
+        return;
+    }
+
+    // The head is written right in front of the body
+    char head[ASYNC_HTTP_HEAD_SIZE];
+    char number[16];
+    const char* end = head + ASYNC_HTTP_HEAD_SIZE;
+    char* pos = head;
+    snprintf(number, sizeof(number), "%d ", code);
+    pos = append(pos, end, "HTTP/1.1 ");
+    pos = append(pos, end, number);
+    pos = append(pos, end, get_status_text(code));
+    pos = append(pos, end, "\r\nContent-Type: ");
+    pos = append_P(pos, end, reinterpret_cast<PGM_P>(content_type));
+    snprintf(number, sizeof(number), "%u", static_cast<unsigned>(this->response_end - ASYNC_HTTP_HEAD_SIZE + this->flash_size));
+    pos = append(pos, end, "\r\nContent-Length: ");
+    pos = append(pos, end, number);
+    pos = append(pos, end, "\r\nConnection: close\r\n");
+    for (int index = 0; index < this->header_count; index++) {
+        pos = append_P(pos, end, reinterpret_cast<PGM_P>(this->headers[index].name));
+        pos = append(pos, end, ": ");
+        pos = append_P(pos, end, reinterpret_cast<PGM_P>(this->headers[index].value));
+        pos = append(pos, end, "\r\n");
+    }
+    pos = append(pos, end, "\r\n");
+
+    const size_t head_size = static_cast<size_t>(pos - head);
+    this->response_start = ASYNC_HTTP_HEAD_SIZE - head_size;
+    memcpy(this->response + this->response_start, head, head_size);
+
+    this->state = AsyncHttpState::sending;
+    this->pump();
+}
+
+void AsyncHttpConnection::send(int code, const __FlashStringHelper* content_type, const char* body) {
+    this->write(body, strlen(body));
+    this->send(code, content_type);
+}
+
+// Flash content is copied chunk by chunk while sending, it does not need to fit into the response buffer
+void AsyncHttpConnection::send_P(int code, const __FlashStringHelper* content_type, PGM_P content, size_t size) {
+    this->flash_content = content;
+    this->flash_size = size;
+    this->send(code, content_type);
+}
+
+bool AsyncHttpConnection::is_free() const {
+    return this->state == AsyncHttpState::free;
+}
+
+void AsyncHttpConnection::attach(AsyncHttpServer* server, AsyncClient* client) {
+    this->release();
+    this->server = server;
+    this->client = client;
+    this->state = AsyncHttpState::receive_head;
+
+    client->onData(on_data, this);
+    client->onAck(on_ack, this);
+    client->onPoll(on_poll, this);
+    client->onTimeout(on_timeout, this);
+    client->onDisconnect(on_disconnect, this);
+    client->setRxTimeout(ASYNC_HTTP_TIMEOUT);
+}
+
+void AsyncHttpConnection::release() {
+    this->client = nullptr;
+    this->state = AsyncHttpState::free;
+    this->request[0] = 0x00;
+    this->request_size = 0;
+    this->head_size = 0;
+    this->content_length = 0;
+    this->method = HttpMethod::other;
+    this->path = this->request;
+    this->query = this->request;
+    this->header_lines = this->request;
+    this->header_count = 0;
+    this->response_start = ASYNC_HTTP_HEAD_SIZE;
+    this->response_end = ASYNC_HTTP_HEAD_SIZE;
+    this->response_sent = 0;
+    this->response_overflow = false;
+    this->flash_content = nullptr;
+    this->flash_size = 0;
+    this->flash_sent = 0;
+    this->acked = 0;
+}
+
+// Aborting the client calls on_disconnect, which releases the connection, so nothing is touched afterwards
+void AsyncHttpConnection::close() {
+    if (this->client != nullptr && this->state != AsyncHttpState::closing) {
+        this->state = AsyncHttpState::closing;
+        this->client->close(true);
+    }
+}
+
+void AsyncHttpConnection::receive(const char* data, size_t size) {
+    // Data after the request is ignored
+    if (this->state != AsyncHttpState::receive_head && this->state != AsyncHttpState::receive_body) {
+        return;
+    }
+
+    if (this->request_size + size > ASYNC_HTTP_REQUEST_SIZE) {
+        this->send(413, F("text/plain"), "Request too large");
+        return;
+    }
+
+    memcpy(this->request + this->request_size, data, size);
+    this->request_size += size;
+    this->request[this->request_size] = 0x00;
+
+    if (this->state == AsyncHttpState::receive_head) {
+        const char* end = strstr(this->request, "\r\n\r\n");
+        if (end == nullptr) {
+            return;
+        }
+
+        this->head_size = static_cast<size_t>(end + 4 - this->request);
+        if (!this->parse_head()) {
+            this->send(400, F("text/plain"), "Bad request");
+            return;
+        }
+
+        if (this->head_size + this->content_length > ASYNC_HTTP_REQUEST_SIZE) {
+            this->send(413, F("text/plain"), "Request too large");
+            return;
+        }
+
+        this->state = AsyncHttpState::receive_body;
+    }
+
+    if (this->request_size - this->head_size < this->content_length) {
+        return;
+    }
+
+    this->request[this->head_size + this->content_length] = 0x00;
+    this->server->handle(*this);
+}
+
+// Splits the request line into method, path and query, the only header of interest is the content length
+bool AsyncHttpConnection::parse_head() {
+    char* line_end = strstr(this->request, "\r\n");
+    *line_end = 0x00;
+
+    char* target = strchr(this->request, ' ');
+    if (target == nullptr) {
+        return false;
+    }
+    *target++ = 0x00;
+
+    char* version = strchr(target, ' ');
+    if (version == nullptr || strncmp(version + 1, "HTTP/1.", 7) != 0) {
+        return false;
+    }
+    *version = 0x00;
+
+    if (strcmp(this->request, "GET") == 0) {
+        this->method = HttpMethod::get;
+    } else if (strcmp(this->request, "HEAD") == 0) {
+        this->method = HttpMethod::head;
+    } else if (strcmp(this->request, "POST") == 0) {
+        this->method = HttpMethod::post;
+    } else if (strcmp(this->request, "OPTIONS") == 0) {
+        this->method = HttpMethod::options;
+    }
+
+    char* query = strchr(target, '?');
+    if (query != nullptr) {
+        *query++ = 0x00;
+    }
+    this->path = target;
+    this->query = query != nullptr ? query : "";
+
+    this->header_lines = line_end + 2;
+    for (char* line = line_end + 2; line < this->request + this->head_size - 2; ) {
+        char* next = strstr(line, "\r\n");
+        *next = 0x00;
+        if (strncasecmp(line, "Content-Length:", 15) == 0) {
+            this->content_length = strtoul(line + 15, nullptr, 10);
+        }
+        line = next + 2;
+    }
+
+    return true;
+}
+
+// Queues as much of the response as the tcp window takes, the next part follows on the ack
+void AsyncHttpConnection::pump() {
+    if (this->state != AsyncHttpState::sending) {
+        return;
+    }
+
+    const size_t response_size = this->response_end - this->response_start;
+    while (this->client->space() > 0) {
+        const size_t space = this->client->space();
+        size_t added = 0;
+        if (this->response_sent < response_size) {
+            const size_t size = std::min(space, response_size - this->response_sent);
+            added = this->client->add(this->response + this->response_start + this->response_sent, size, ASYNC_WRITE_FLAG_COPY);
+            this->response_sent += added;
+        } else if (this->flash_sent < this->flash_size) {
+            char chunk[256];
+            const size_t size = std::min(std::min(space, this->flash_size - this->flash_sent), sizeof(chunk));
+            memcpy_P(chunk, this->flash_content + this->flash_sent, size);
+            added = this->client->add(chunk, size, ASYNC_WRITE_FLAG_COPY);
+            this->flash_sent += added;
+        }
+
+        if (added == 0) {
+            break;
+        }
+    }
+
+    this->client->send();
+
+    // Closed once the peer has everything, closing earlier would drop the unacknowledged data
+    if (this->response_sent == response_size && this->flash_sent == this->flash_size && this->acked >= response_size + this->flash_size) {
+        this->close();
+    }
+}
+
+void AsyncHttpConnection::on_data(void* arg, AsyncClient* client, void* data, size_t size) {
+    static_cast<AsyncHttpConnection*>(arg)->receive(static_cast<const char*>(data), size);
+}
+
+void AsyncHttpConnection::on_ack(void* arg, AsyncClient* client, size_t size, uint32_t time) {
+    AsyncHttpConnection* connection = static_cast<AsyncHttpConnection*>(arg);
+    connection->acked += size;
+    connection->pump();
+}
+
+void AsyncHttpConnection::on_poll(void* arg, AsyncClient* client) {
+    static_cast<AsyncHttpConnection*>(arg)->pump();
+}
+
+void AsyncHttpConnection::on_timeout(void* arg, AsyncClient* client, uint32_t time) {
+    static_cast<AsyncHttpConnection*>(arg)->close();
+}
+
+void AsyncHttpConnection::on_disconnect(void* arg, AsyncClient* client) {
+    static_cast<AsyncHttpConnection*>(arg)->release();
+    delete client;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+
+AsyncHttpServer::AsyncHttpServer(uint16_t port) : server(port), route_count(0), not_found_handler(nullptr), rejected_count(0) {
+    this->server.onClient(on_client, this);
+}
+
+bool AsyncHttpServer::on(const char* path, AsyncHttpHandler handler) {
+    if (this->route_count >= ASYNC_HTTP_MAX_ROUTES) {
+        return false;
+    }
+
+    this->routes[this->route_count++] = { path, handler };
+    return true;
+}
+
+void AsyncHttpServer::on_not_found(AsyncHttpHandler handler) {
+    this->not_found_handler = handler;
+}
+
+void AsyncHttpServer::begin() {
+    this->server.begin();
+}
+
+void AsyncHttpServer::end() {
+    this->server.end();
+}
+
+int AsyncHttpServer::get_connection_count() const {
+    int count = 0;
+    for (const AsyncHttpConnection& connection : this->connections) {
+        count += connection.is_free() ? 0 : 1;
+    }
+
+    return count;
+}
+
+unsigned long AsyncHttpServer::get_rejected_count() const {
+    return this->rejected_count;
+}
+
+void AsyncHttpServer::handle(AsyncHttpConnection& connection) {
+    AsyncHttpHandler handler = this->not_found_handler;
+    for (int index = 0; index < this->route_count; index++) {
+        if (strcmp(this->routes[index].path, connection.path) == 0) {
+            handler = this->routes[index].handler;
+            break;
+        }
+    }
+
+    if (handler != nullptr) {
+        handler(connection);
+    }
+
+    // A handler without response gets one, so the connection does not wait for the timeout
+    if (connection.state == AsyncHttpState::receive_body) {
+        connection.send(handler != nullptr ? 500 : 404, F("text/plain"), handler != nullptr ? "No response" : "Not found");
+    }
+}
+
+void AsyncHttpServer::on_client(void* arg, AsyncClient* client) {
+    AsyncHttpServer* server = static_cast<AsyncHttpServer*>(arg);
+    for (AsyncHttpConnection& connection : server->connections) {
+        if (connection.is_free()) {
+            connection.attach(server, client);
+            return;
+        }
+    }
+
+    server->rejected_count++;
+    client->onDisconnect(on_rejected_disconnect, nullptr);
+    client->close(true);
+}
+
+void AsyncHttpServer::on_rejected_disconnect(void* arg, AsyncClient* client) {
+    delete client;
+}
+
+AsyncHttpServer& get_async_http_server() {
+    static AsyncHttpServer instance(80);
+    return instance;
+}
+
+#endif
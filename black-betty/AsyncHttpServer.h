@@ -0,0 +1,171 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Set to 1 to serve the web interface from the async tcp stack (ESPAsyncTCP library) instead of ESP8266WebServer
+#ifndef WEBSERVER_ASYNC
+#define WEBSERVER_ASYNC 0
+#endif
+
+#if WEBSERVER_ASYNC
+#include <ESPAsyncTCP.h>
+
+constexpr int ASYNC_HTTP_MAX_CONNECTIONS = 4;
+constexpr int ASYNC_HTTP_MAX_ROUTES = 8;
+constexpr int ASYNC_HTTP_MAX_HEADERS = 4;
+
+// Request line, headers and body of one request
+constexpr size_t ASYNC_HTTP_REQUEST_SIZE = 512;
+
+// Status line, headers and body of a generated response, the first bytes are reserved for the head. The body
+// takes the largest /status json (STATUS_JSON_MAX_SIZE). The connections are static, all of them take about
+// 4 x (513 + 1792) bytes = 9.2 KB of RAM
+constexpr size_t ASYNC_HTTP_HEAD_SIZE = 256;
+constexpr size_t ASYNC_HTTP_BODY_SIZE = 1536;
+constexpr size_t ASYNC_HTTP_RESPONSE_SIZE = ASYNC_HTTP_HEAD_SIZE + ASYNC_HTTP_BODY_SIZE;
+
+// Seconds without data before an idle connection is closed
+constexpr uint32_t ASYNC_HTTP_TIMEOUT = 10;
+
+enum class HttpMethod : uint8_t {
+    get,
+    head,
+    post,
+    options,
+    other
+};
+
+enum class AsyncHttpState : uint8_t {
+    free,
+    receive_head,
+    receive_body,
+    sending,
+    closing
+};
+
+class AsyncHttpServer;
+class AsyncHttpConnection;
+
+typedef void (*AsyncHttpHandler)(AsyncHttpConnection& connection);
+
+/*
+    One client connection, it reads one request, the handler writes the response into a fixed buffer (or points
+    to flash content) and the connection sends it as fast as the tcp window allows, then it is closed
+    (Connection: close). Every callback does a bounded amount of work, nothing waits for the network.
+*/
+class AsyncHttpConnection {
+public:
+    AsyncHttpConnection();
+    AsyncHttpConnection(const AsyncHttpConnection&) = delete;
+    AsyncHttpConnection& operator=(const AsyncHttpConnection&) = delete;
+
+    // Request
+    HttpMethod get_method() const;
+    const char* get_path() const;
+    const char* get_body() const;
+    bool get_argument(const char* name, char* output, size_t size) const;
+    bool get_header(const char* name, char* output, size_t size) const;
+
+    // Response, headers are added before the response is sent. The body is collected with write() and sent
+    // with send(), a body that does not fit into the buffer results in a 500
+    void add_header(const __FlashStringHelper* name, const __FlashStringHelper* value);
+    void write(const char* data, size_t size);
+    void send(int code, const __FlashStringHelper* content_type);
+    void send(int code, const __FlashStringHelper* content_type, const char* body);
+    void send_P(int code, const __FlashStringHelper* content_type, PGM_P content, size_t size);
+
+private:
+    friend class AsyncHttpServer;
+
+    struct Header {
+        const __FlashStringHelper* name;
+        const __FlashStringHelper* value;
+    };
+
+    bool is_free() const;
+    void attach(AsyncHttpServer* server, AsyncClient* client);
+    void release();
+    void close();
+
+    void receive(const char* data, size_t size);
+    bool parse_head();
+    void pump();
+
+    static void on_data(void* arg, AsyncClient* client, void* data, size_t size);
+    static void on_ack(void* arg, AsyncClient* client, size_t size, uint32_t time);
+    static void on_poll(void* arg, AsyncClient* client);
+    static void on_timeout(void* arg, AsyncClient* client, uint32_t time);
+    static void on_disconnect(void* arg, AsyncClient* client);
+
+    AsyncHttpServer* server;
+    AsyncClient* client;
+    AsyncHttpState state;
+
+    char request[ASYNC_HTTP_REQUEST_SIZE + 1];
+    size_t request_size;
+    size_t head_size;
+    size_t content_length;
+    HttpMethod method;
+    const char* path;
+    const char* query;
+    const char* header_lines;
+
+    Header headers[ASYNC_HTTP_MAX_HEADERS];
+    int header_count;
+
+    // Generated content is response[response_start..response_end], flash content follows the head
+    char response[ASYNC_HTTP_RESPONSE_SIZE];
+    size_t response_start;
+    size_t response_end;
+    size_t response_sent;
+    bool response_overflow;
+    PGM_P flash_content;
+    size_t flash_size;
+    size_t flash_sent;
+    size_t acked;
+};
+
+/*
+    Minimal http server on ESPAsyncTCP, requests are dispatched by exact path. The connections are a fixed pool,
+    clients beyond ASYNC_HTTP_MAX_CONNECTIONS are closed right away. The callbacks run in the context of the tcp
+    stack, on the ESP8266 that is between two loop() calls, so the handlers can use the same state as the tasks.
+*/
+class AsyncHttpServer {
+public:
+    explicit AsyncHttpServer(uint16_t port);
+    AsyncHttpServer(const AsyncHttpServer&) = delete;
+    AsyncHttpServer& operator=(const AsyncHttpServer&) = delete;
+
+    bool on(const char* path, AsyncHttpHandler handler);
+    void on_not_found(AsyncHttpHandler handler);
+
+    void begin();
+    void end();
+
+    int get_connection_count() const;
+    unsigned long get_rejected_count() const;
+
+private:
+    friend class AsyncHttpConnection;
+
+    struct Route {
+        const char* path;
+        AsyncHttpHandler handler;
+    };
+
+    void handle(AsyncHttpConnection& connection);
+
+    static void on_client(void* arg, AsyncClient* client);
+    static void on_rejected_disconnect(void* arg, AsyncClient* client);
+
+    AsyncServer server;
+    Route routes[ASYNC_HTTP_MAX_ROUTES];
+    int route_count;
+    AsyncHttpHandler not_found_handler;
+    AsyncHttpConnection connections[ASYNC_HTTP_MAX_CONNECTIONS];
+    unsigned long rejected_count;
+};
+
+AsyncHttpServer& get_async_http_server();
+
+#endif
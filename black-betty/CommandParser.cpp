@@ -5,7 +5,10 @@
 #include "util.h"
 #include "Settings.h"
 #include "HeaterPID.h"
+#include "TemperatureSensor.h"
+#include "RelayOutput.h"
 
+// Case insensitive compare of a token with a flash string
 static bool is_token(const char* token, const __FlashStringHelper* value_flash) {
   // Casting to char here enables pointer arimetrics later
   const char* value = reinterpret_cast<const char*>(value_flash);
@@ -17,18 +20,526 @@ static bool is_token(const char* token, const __FlashStringHelper* value_flash)
     }
   }
 
-  return true;
+  return *token == 0x00;
 }
 
-static bool is_token(const char* token, const __FlashStringHelper* value_flash, bool prerequisite) {
-    if (!prerequisite) {
+static void to_lower(char* token) {
+  for (; *token != 0x00; token++) {
+    *token = static_cast<char>(tolower(*token));
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Validators
+static bool validate_numbers(char** argument, int argument_count) {
+    for (int index = 0; index < argument_count; index++) {
+        char* end = nullptr;
+        strtod(argument[index], &end);
+        if (end == argument[index] || *end != 0x00) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool validate_bool(char** argument, int argument_count) {
+    return argument_count > 0 && (is_token(argument[0], F("true")) || is_token(argument[0], F("false")));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Get handlers
+// The values are rendered into a buffer of the worst case size first, the output only gets them if they fit
+constexpr size_t COMMAND_VALUE_SIZE = 96;
+
+static bool copy_value(const char* value, char* output, size_t output_size) {
+    const size_t length = strlen(value);
+    if (length >= output_size) {
         return false;
     }
-    
-    return is_token(token, value_flash);
+
+    memcpy(output, value, length + 1);
+    return true;
+}
+
+static bool copy_double(double value, char* output, size_t output_size) {
+    char buffer[COMMAND_VALUE_SIZE];
+    return copy_value(double_to_string(buffer, value), output, output_size);
+}
+
+// State, rule, completed cycles, elapsed seconds and the measured ultimate gain and period
+static bool get_autotune(char** argument, int argument_count, char* output, size_t output_size) {
+    const PidAutoTune& autotune = get_heater().get_autotune();
+    char value[COMMAND_VALUE_SIZE];
+    char* pos = copy_flash_string(value, PidAutoTune::get_state_name(autotune.get_state()), 16);
+    *(pos++) = ' ';
+    pos = copy_flash_string(pos, PidAutoTune::get_rule_name(autotune.get_rule()), 16);
+    *(pos++) = ' ';
+    pos = json_add(pos, autotune.get_cycle());
+    *(pos++) = ' ';
+    pos = json_add(pos, static_cast<int>(autotune.get_elapsed(millis()) / 1000));
+    *(pos++) = ' ';
+    pos = json_add(pos, autotune.get_ultimate_gain());
+    *(pos++) = ' ';
+    pos = json_add(pos, autotune.get_ultimate_period());
+    *pos = 0x00;
+    return copy_value(value, output, output_size);
+}
+
+static bool get_countdown_mode(char** argument, int argument_count, char* output, size_t output_size) {
+    copy_flash_string(output, get_settings().is_countdown_mode() ? F("true") : F("false"), output_size);
+    return true;
+}
+
+static bool get_debug(char** argument, int argument_count, char* output, size_t output_size) {
+    copy_flash_string(output, get_settings().is_debug() ? F("true") : F("false"), output_size);
+    return true;
+}
+
+static bool get_filter(char** argument, int argument_count, char* output, size_t output_size) {
+    const Settings& settings = get_settings();
+    char value[COMMAND_VALUE_SIZE];
+    char* pos = json_add(value, static_cast<int>(settings.filter_median));
+    *(pos++) = ' ';
+    pos = copy_flash_string(pos, get_lowpass_mode_name(static_cast<LowpassMode>(settings.filter_lowpass)), 16);
+    *(pos++) = ' ';
+    pos = json_add(pos, settings.filter_lowpass_value);
+    *(pos++) = ' ';
+    pos = json_add(pos, settings.filter_kalman_q);
+    *(pos++) = ' ';
+    pos = json_add(pos, settings.filter_kalman_r);
+    *pos = 0x00;
+    return copy_value(value, output, output_size);
+}
+
+static bool get_heater_high(char** argument, int argument_count, char* output, size_t output_size) {
+    return copy_double(get_settings().heater_temperature_high, output, output_size);
+}
+
+static bool get_heater_low(char** argument, int argument_count, char* output, size_t output_size) {
+    return copy_double(get_settings().heater_temperature_low, output, output_size);
+}
+
+static bool get_id(char** argument, int argument_count, char* output, size_t output_size) {
+    strncpy(output, get_settings().device_id, output_size - 1);
+    return true;
 }
 
+static bool get_pid(char** argument, int argument_count, char* output, size_t output_size) {
+    const HeaterPID& heater = get_heater();
+    char value[COMMAND_VALUE_SIZE];
+    char* pos = json_add(value, heater.get_kp());
+    *(pos++) = ' ';
+    pos = json_add(pos, heater.get_ki());
+    *(pos++) = ' ';
+    pos = json_add(pos, heater.get_kd());
+    *pos = 0x00;
+    return copy_value(value, output, output_size);
+}
+
+static bool get_pid_input(char** argument, int argument_count, char* output, size_t output_size) {
+    return copy_double(get_heater().get_input(), output, output_size);
+}
+
+static bool get_pid_kd(char** argument, int argument_count, char* output, size_t output_size) {
+    return copy_double(get_heater().get_kd(), output, output_size);
+}
+
+static bool get_pid_ki(char** argument, int argument_count, char* output, size_t output_size) {
+    return copy_double(get_heater().get_ki(), output, output_size);
+}
+
+static bool get_pid_kp(char** argument, int argument_count, char* output, size_t output_size) {
+    return copy_double(get_heater().get_kp(), output, output_size);
+}
+
+static bool get_pid_output(char** argument, int argument_count, char* output, size_t output_size) {
+    return copy_double(get_heater().get_output(), output, output_size);
+}
+
+static bool get_pid_setpoint(char** argument, int argument_count, char* output, size_t output_size) {
+    return copy_double(get_heater().get_setpoint(), output, output_size);
+}
+
+// Mode, minimum on/off time and the number of switches since boot
+static bool get_relay(char** argument, int argument_count, char* output, size_t output_size) {
+    const Settings& settings = get_settings();
+    char value[COMMAND_VALUE_SIZE];
+    char* pos = copy_flash_string(value, settings.relay_mode == static_cast<uint8_t>(RelayMode::pulse) ? F("pulse") : F("window"), 16);
+    *(pos++) = ' ';
+    pos = json_add(pos, static_cast<int>(settings.relay_min_time));
+    *(pos++) = ' ';
+    pos = json_add(pos, static_cast<int>(get_relay_output().get_switch_count()));
+    *pos = 0x00;
+    return copy_value(value, output, output_size);
+}
 
+// Newest sample (filtered and raw), its age in ms and the number of failed bus transactions
+static bool get_sensor(char** argument, int argument_count, char* output, size_t output_size) {
+    const TemperatureSensor& sensor = get_temperature_sensor();
+    SensorSample sample;
+    if (!sensor.get(0, sample)) {
+        return false;
+    }
+
+    char value[COMMAND_VALUE_SIZE];
+    char* pos = json_add(value, sample.temperature);
+    *(pos++) = ' ';
+    pos = json_add(pos, sample.raw);
+    *(pos++) = ' ';
+    pos = json_add(pos, static_cast<int>(millis() - sample.time));
+    *(pos++) = ' ';
+    pos = json_add(pos, static_cast<int>(sensor.get_error_count()));
+    *pos = 0x00;
+    return copy_value(value, output, output_size);
+}
+
+static bool get_sensor_offset(char** argument, int argument_count, char* output, size_t output_size) {
+    return copy_double(get_settings().temperature_offset, output, output_size);
+}
+
+// Enabled, state and the boiler model: dead time (s), rate (°C/s at full power), loss (1/s) and ambient temperature
+static bool get_warmup(char** argument, int argument_count, char* output, size_t output_size) {
+    const WarmupController& warmup = get_heater().get_warmup();
+    const BoilerModel& model = warmup.get_model();
+    char value[COMMAND_VALUE_SIZE];
+    char* pos = copy_flash_string(value, get_settings().is_warmup() ? F("true") : F("false"), 8);
+    *(pos++) = ' ';
+    pos = copy_flash_string(pos, WarmupController::get_state_name(warmup.get_state()), 16);
+    *(pos++) = ' ';
+    pos = json_add(pos, model.get_dead_time());
+    *(pos++) = ' ';
+    pos = json_add(pos, model.get_rate());
+    *(pos++) = ' ';
+    pos = json_add(pos, model.get_loss());
+    *(pos++) = ' ';
+    pos = json_add(pos, model.get_ambient());
+    *pos = 0x00;
+    return copy_value(value, output, output_size);
+}
+
+static bool get_wifi_ssid(char** argument, int argument_count, char* output, size_t output_size) {
+    strncpy(output, get_settings().wifi_ssid, output_size - 1);
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Set handlers
+static bool set_countdown_mode(char** argument, int argument_count, char* output, size_t output_size) {
+    get_settings().set_countdown_mode(is_token(argument[0], F("true")));
+    return true;
+}
+
+static bool set_debug(char** argument, int argument_count, char* output, size_t output_size) {
+    get_settings().set_debug(is_token(argument[0], F("true")));
+    return true;
+}
+
+static bool set_filter_kalman(char** argument, int argument_count, char* output, size_t output_size) {
+    if (!get_settings().validate_set_filter_kalman(atof(argument[0]), atof(argument[1]))) {
+        return false;
+    }
+
+    get_temperature_sensor().configure_filter();
+    return true;
+}
+
+// The value is only needed (and checked) for ema and biquad
+static bool set_filter_lowpass(char** argument, int argument_count, char* output, size_t output_size) {
+    LowpassMode mode;
+    if (is_token(argument[0], F("none"))) {
+        mode = LowpassMode::none;
+    } else if (is_token(argument[0], F("ema"))) {
+        mode = LowpassMode::ema;
+    } else if (is_token(argument[0], F("biquad"))) {
+        mode = LowpassMode::biquad;
+    } else {
+        return false;
+    }
+
+    const bool has_value = argument_count > 1 && validate_numbers(argument + 1, 1);
+    if ((mode != LowpassMode::none && !has_value) ||
+        !get_settings().validate_set_filter_lowpass(static_cast<uint8_t>(mode), has_value ? atof(argument[1]) : 0.0)) {
+        return false;
+    }
+
+    get_temperature_sensor().configure_filter();
+    return true;
+}
+
+static bool set_filter_median(char** argument, int argument_count, char* output, size_t output_size) {
+    if (!get_settings().validate_set_filter_median(atoi(argument[0]))) {
+        return false;
+    }
+
+    get_temperature_sensor().configure_filter();
+    return true;
+}
+
+static bool set_heater(char** argument, int argument_count, char* output, size_t output_size) {
+    Settings& settings = get_settings();
+    return settings.validate_set_heater_temperature_low(atof(argument[0])) && settings.validate_set_heater_temperature_high(atof(argument[1]));
+}
+
+static bool set_heater_enabled(char** argument, int argument_count, char* output, size_t output_size) {
+    if (is_token(argument[0], F("true"))) {
+        get_heater().enable();
+    } else {
+        get_heater().disable();
+    }
+
+    return true;
+}
+
+static bool set_heater_high(char** argument, int argument_count, char* output, size_t output_size) {
+    return get_settings().validate_set_heater_temperature_high(atof(argument[0]));
+}
+
+static bool set_heater_low(char** argument, int argument_count, char* output, size_t output_size) {
+    return get_settings().validate_set_heater_temperature_low(atof(argument[0]));
+}
+
+static bool set_id(char** argument, int argument_count, char* output, size_t output_size) {
+    return get_settings().validate_set_device_id(argument[0]);
+}
+
+static bool set_pid(char** argument, int argument_count, char* output, size_t output_size) {
+    // Reconfigure pid
+    Settings& settings = get_settings();
+    if (!settings.validate_set_heater_pid(atof(argument[0]), atof(argument[1]), atof(argument[2]))) {
+        return false;
+    }
+
+    get_heater().configure(settings.heater_kp, settings.heater_ki, settings.heater_kd);
+    return true;
+}
+
+static bool set_relay(char** argument, int argument_count, char* output, size_t output_size) {
+    Settings& settings = get_settings();
+    RelayMode mode;
+    if (is_token(argument[0], F("window"))) {
+        mode = RelayMode::window;
+    } else if (is_token(argument[0], F("pulse"))) {
+        mode = RelayMode::pulse;
+    } else {
+        return false;
+    }
+
+    if (argument_count > 1 && (!validate_numbers(argument + 1, 1) || !settings.validate_set_relay_min_time(atoi(argument[1])))) {
+        return false;
+    }
+
+    settings.validate_set_relay_mode(static_cast<uint8_t>(mode));
+    get_relay_output().configure(settings);
+    return true;
+}
+
+static bool set_sensor_offset(char** argument, int argument_count, char* output, size_t output_size) {
+    return get_settings().validate_set_temperature_offset(atof(argument[0]));
+}
+
+static bool set_warmup(char** argument, int argument_count, char* output, size_t output_size) {
+    get_settings().set_warmup(is_token(argument[0], F("true")));
+    return true;
+}
+
+static bool set_wifi(char** argument, int argument_count, char* output, size_t output_size) {
+    return get_settings().validate_set_wifi(argument[0], argument[1], argument[2]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Command tables in PROGMEM, sorted by name for the binary search (checked at compile time)
+static constexpr CommandDescriptor GET_COMMANDS[] PROGMEM = {
+    { "autotune", 0, get_autotune, nullptr, "" },
+    { "countdown_mode", 0, get_countdown_mode, nullptr, "" },
+    { "debug", 0, get_debug, nullptr, "" },
+    { "filter", 0, get_filter, nullptr, "" },
+    { "heater.high", 0, get_heater_high, nullptr, "" },
+    { "heater.low", 0, get_heater_low, nullptr, "" },
+    { "id", 0, get_id, nullptr, "" },
+    { "pid", 0, get_pid, nullptr, "" },
+    { "pid.input", 0, get_pid_input, nullptr, "" },
+    { "pid.kd", 0, get_pid_kd, nullptr, "" },
+    { "pid.ki", 0, get_pid_ki, nullptr, "" },
+    { "pid.kp", 0, get_pid_kp, nullptr, "" },
+    { "pid.output", 0, get_pid_output, nullptr, "" },
+    { "pid.setpoint", 0, get_pid_setpoint, nullptr, "" },
+    { "relay", 0, get_relay, nullptr, "" },
+    { "sensor", 0, get_sensor, nullptr, "" },
+    { "sensor.offset", 0, get_sensor_offset, nullptr, "" },
+    { "warmup", 0, get_warmup, nullptr, "" },
+    { "wifi.ssid", 0, get_wifi_ssid, nullptr, "" },
+};
+
+static constexpr CommandDescriptor SET_COMMANDS[] PROGMEM = {
+    { "countdown_mode", 1, set_countdown_mode, validate_bool, "<true|false>" },
+    { "debug", 1, set_debug, validate_bool, "<true|false>" },
+    { "filter.kalman", 2, set_filter_kalman, validate_numbers, "<q> <r>" },
+    { "filter.lowpass", 1, set_filter_lowpass, nullptr, "<none|ema|biquad> <alpha|cutoff>" },
+    { "filter.median", 1, set_filter_median, validate_numbers, "<1|3|5>" },
+    { "heater", 2, set_heater, validate_numbers, "<low> <high>" },
+    { "heater.enabled", 1, set_heater_enabled, validate_bool, "<true|false>" },
+    { "heater.high", 1, set_heater_high, validate_numbers, "<temperature>" },
+    { "heater.low", 1, set_heater_low, validate_numbers, "<temperature>" },
+    { "id", 1, set_id, nullptr, "<device-id>" },
+    { "pid", 3, set_pid, validate_numbers, "<kp> <ki> <kd>" },
+    { "relay", 1, set_relay, nullptr, "<window|pulse> <min-time>" },
+    { "sensor.offset", 1, set_sensor_offset, validate_numbers, "<offset>" },
+    { "warmup", 1, set_warmup, validate_bool, "<true|false>" },
+    { "wifi", 3, set_wifi, nullptr, "<device-id> <ssid> <password>" },
+};
+
+static bool run_autotune(char** argument, int argument_count, char* output, size_t output_size);
+static bool run_get(char** argument, int argument_count, char* output, size_t output_size);
+static bool run_set(char** argument, int argument_count, char* output, size_t output_size);
+static bool run_save(char** argument, int argument_count, char* output, size_t output_size);
+static bool run_purge(char** argument, int argument_count, char* output, size_t output_size);
+static bool run_restart(char** argument, int argument_count, char* output, size_t output_size);
+static bool run_help(char** argument, int argument_count, char* output, size_t output_size);
+
+static constexpr CommandDescriptor MAIN_COMMANDS[] PROGMEM = {
+    { "autotune", 1, run_autotune, nullptr, "<classic|some_overshoot|no_overshoot|tyreus_luyben|stop>" },
+    { "get", 1, run_get, nullptr, "<name>" },
+    { "help", 0, run_help, nullptr, "" },
+    { "purge", 0, run_purge, nullptr, "" },
+    { "restart", 0, run_restart, nullptr, "" },
+    { "save", 0, run_save, nullptr, "" },
+    { "set", 1, run_set, nullptr, "<name> <arguments>" },
+};
+
+static constexpr int compare_names(const char* a, const char* b) {
+    return *a != *b || *a == 0x00 ? static_cast<unsigned char>(*a) - static_cast<unsigned char>(*b) : compare_names(a + 1, b + 1);
+}
+
+template <size_t N> static constexpr bool is_sorted(const CommandDescriptor (&table)[N], size_t index = 1) {
+    return index >= N || (compare_names(table[index - 1].name, table[index].name) < 0 && is_sorted(table, index + 1));
+}
+
+static_assert(is_sorted(GET_COMMANDS), "GET_COMMANDS must be sorted by name");
+static_assert(is_sorted(SET_COMMANDS), "SET_COMMANDS must be sorted by name");
+static_assert(is_sorted(MAIN_COMMANDS), "MAIN_COMMANDS must be sorted by name");
+
+// Binary search on the names in flash, the found entry is copied to command
+template <size_t N> static bool find_command(const CommandDescriptor (&table)[N], const char* name, CommandDescriptor& command) {
+    size_t low = 0, high = N;
+    while (low < high) {
+        const size_t middle = (low + high) / 2;
+        const int compare = strcmp_P(name, table[middle].name);
+        if (compare == 0) {
+            memcpy_P(&command, &table[middle], sizeof(command));
+            return true;
+        } else if (compare < 0) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+
+    return false;
+}
+
+// Looks up the command named by the first token and runs it with the remaining tokens
+template <size_t N> static bool run_command(const CommandDescriptor (&table)[N], char** token, int token_count, char* output, size_t output_size) {
+    if (token_count < 1) {
+        return false;
+    }
+
+    to_lower(token[0]);
+    CommandDescriptor command;
+    if (!find_command(table, token[0], command) || token_count - 1 < command.arity) {
+        return false;
+    }
+
+    if (command.validator != nullptr && !command.validator(token + 1, command.arity)) {
+        return false;
+    }
+
+    return command.handler(token + 1, token_count - 1, output, output_size);
+}
+
+template <size_t N> static void print_help(const char* prefix, const CommandDescriptor (&table)[N]) {
+    CommandDescriptor command;
+    for (const CommandDescriptor& entry : table) {
+        memcpy_P(&command, &entry, sizeof(command));
+        Serial.printf("  %s%s%s%s\n", prefix, command.name, *command.usage != 0x00 ? " " : "", command.usage);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Main handlers
+static bool run_autotune(char** argument, int argument_count, char* output, size_t output_size) {
+    HeaterPID& heater = get_heater();
+    if (is_token(argument[0], F("stop"))) {
+        heater.stop_autotune();
+        return true;
+    }
+
+    AutoTuneRule rule;
+    if (is_token(argument[0], F("classic"))) {
+        rule = AutoTuneRule::classic;
+    } else if (is_token(argument[0], F("some_overshoot"))) {
+        rule = AutoTuneRule::some_overshoot;
+    } else if (is_token(argument[0], F("no_overshoot"))) {
+        rule = AutoTuneRule::no_overshoot;
+    } else if (is_token(argument[0], F("tyreus_luyben"))) {
+        rule = AutoTuneRule::tyreus_luyben;
+    } else {
+        return false;
+    }
+
+    if (!heater.start_autotune(rule)) {
+        copy_flash_string(output, F("The heater is disabled"), output_size);
+        return false;
+    }
+
+    return true;
+}
+
+static bool run_get(char** argument, int argument_count, char* output, size_t output_size) {
+    return run_command(GET_COMMANDS, argument, argument_count, output, output_size);
+}
+
+static bool run_set(char** argument, int argument_count, char* output, size_t output_size) {
+    return run_command(SET_COMMANDS, argument, argument_count, output, output_size);
+}
+
+static bool run_save(char** argument, int argument_count, char* output, size_t output_size) {
+    Serial.println(F("Saving configuration to eeprom"));
+    get_settings().save();
+    return true;
+}
+
+static bool run_purge(char** argument, int argument_count, char* output, size_t output_size) {
+    Serial.println(F("Purging configuration, resetting to defaults"));
+    get_settings().clear();
+    return true;
+}
+
+static bool run_restart(char** argument, int argument_count, char* output, size_t output_size) {
+    // A save or purge right before the restart may still be pending
+    get_settings().flush();
+    Serial.println(F("Restarting device using watchdog in 4 seconds"));
+
+    wdt_disable();
+    wdt_enable(WDTO_4S);
+    while (1) {}
+    return true;
+}
+
+static bool run_help(char** argument, int argument_count, char* output, size_t output_size) {
+    Serial.println(F("Commands:"));
+    CommandDescriptor command;
+    for (const CommandDescriptor& entry : MAIN_COMMANDS) {
+        memcpy_P(&command, &entry, sizeof(command));
+        if (command.handler != run_get && command.handler != run_set) {
+            Serial.printf("  %s\n", command.name);
+        }
+    }
+
+    print_help("get ", GET_COMMANDS);
+    print_help("set ", SET_COMMANDS);
+    return true;
+}
 
 // Calculates the next security token
 static int next_security_token() {
@@ -73,7 +584,7 @@ void CommandParser::update() {
                 Serial.printf("CommandParser::pollSerial Buffer overflow, the command will be ignored.\n");
             }
             
-            this->serialbuffer[0] = this->serialbuffer[position] = this->serialbuffer[buffersize] = 0x00;
+            memset(this->serialbuffer, 0, sizeof(this->serialbuffer));
             position = 0;
             continue;
         }
@@ -105,19 +616,23 @@ bool CommandParser::execute(const char* command, bool requires_security_token, c
         return false;
     }
 
-    bool success = false;
-   
     if (requires_security_token || is_token(token[0], F("token"))) {
       if (is_token(token[0], F("token")) && token_count > 2) {
         if (this->validate_security_token(atoi(token[1]))) {
-          success = this->main(token + 2, token_count - 2, output, output_size);
+          return this->run(token + 2, token_count - 2, command, output, output_size);
         }
       }
     } else {
-      success = this->main(token, token_count, output, output_size);
+      return this->run(token, token_count, command, output, output_size);
     }
 
-    if (success) {
+    // Missing or invalid token, report the command as failed
+    return this->run(token, 0, command, output, output_size);
+}
+
+// Runs the tokenized command and fills in the default messages
+bool CommandParser::run(char** token, int token_count, const char* command, char* output, size_t output_size) {
+    if (run_command(MAIN_COMMANDS, token, token_count, output, output_size)) {
         if (*output == 0x00) {
             copy_flash_string(output, F("ok"), output_size);
         }
@@ -133,126 +648,118 @@ bool CommandParser::execute(const char* command, bool requires_security_token, c
     return false;
 }
 
-bool CommandParser::main(char** token, const int token_count, char* output, size_t output_size) {
-    if (is_token(token[0], F("get"), token_count > 1)) {
-        return this->get(token + 1, token_count - 1, output, output_size);
-    } else if (is_token(token[0], F("set"), token_count > 1)) {
-        return this->set(token + 1, token_count - 1, output, output_size);
-    } else if (is_token(token[0], F("save"))) {
-        Serial.println(F("Saving configuration to eeprom"));
-        get_settings().save();
-        return true;
-    } else if (is_token(token[0], F("purge"))) {
-        Serial.println(F("Purging configuration, resetting to defaults"));
-        get_settings().clear();
-        return true;
-    } else if (is_token(token[0], F("restart"))) {
-        this->restart();
-        return true;
+// Splits the commands in place at ';' and newlines outside of quotes, returns -1 if there are too many commands
+static int split_commands(char* commands, char** command, int command_count) {
+    int count = 0;
+    bool quoted = false;
+    char* start = commands;
+
+    for (char* pos = commands; ; pos++) {
+        if (*pos == '\"') {
+            quoted = !quoted;
+        } else if (*pos == 0x00 || (!quoted && (*pos == ';' || *pos == '\n' || *pos == '\r'))) {
+            const bool end = *pos == 0x00;
+            *pos = 0x00;
+
+            // Skip empty commands
+            while (*start == ' ') {
+                start++;
+            }
+
+            if (*start != 0x00) {
+                if (count == command_count) {
+                    return -1;
+                }
+
+                command[count++] = start;
+            }
+
+            if (end) {
+                break;
+            }
+
+            start = pos + 1;
+        }
     }
 
-    return false;
+    return count;
 }
 
-bool CommandParser::get(char** token, const int token_count, char* output, size_t output_size) {
-    Settings& settings = get_settings();
-    HeaterPID& heater = get_heater();
+static void add_result(JsonStream& json, bool success, const char* message, bool first) {
+    json.add(first ? F("{") : F(",{"));
+    json.add_property(F("success"), success, true);
+    json.add_property(F("message"), message, false);
+    json.add(F("}"));
+}
 
-    if (token_count < 1) {
+bool CommandParser::execute_batch(char* commands, JsonStream& json) {
+    char* command[COMMAND_BATCH_SIZE + 1];
+    const int command_count = split_commands(commands, command, array_size(command));
+
+    char token_buffer[256];
+    char* token[8];
+    char output[128];
+    output[0] = output[array_size(output) - 1] = 0x00;
+
+    json.add(F("["));
+    if (command_count < 0) {
+        add_result(json, false, "Too many commands", true);
+        json.add(F("]"));
         return false;
     }
 
-    if (is_token(token[0], F("wifi.ssid"))) {
-        strncpy(output, settings.wifi_ssid, output_size);
-        return true;
-    } else if (is_token(token[0], F("id"))) {
-        strncpy(output, settings.device_id, output_size);
-        return true;
-    } else if (is_token(token[0], F("heater.low"), token_count > 1)) {
-      double_to_string(output, settings.heater_temperature_low);
-        return true;
-    } else if (is_token(token[0], F("heater.high"), token_count > 1)) {
-        double_to_string(output, settings.heater_temperature_high);
-        return true;
-    } else if (is_token(token[0], F("pid"))) {
-        char* pos = json_add(output, heater.get_kp());
-        *(pos++) = ' ';
-        pos = json_add(pos, heater.get_ki());
-        *(pos++) = ' ';
-        double_to_string(pos, heater.get_kd());
-    } else if (is_token(token[0], F("pid.kp"))) {
-      double_to_string(output, heater.get_kp());
-        return true;
-    } else if (is_token(token[0], F("pid.ki"))) {
-        double_to_string(output, heater.get_ki());
-        return true;
-    } else if (is_token(token[0], F("pid.kd"))) {
-      double_to_string(output, heater.get_kd());
-        return true;
-    } else if (is_token(token[0], F("pid.input"))) {
-        double_to_string(output, heater.get_input());
-        return true;
-    } else if (is_token(token[0], F("pid.ouput"))) {
-        double_to_string(output, heater.get_output());
-        return true;
-    } else if (is_token(token[0], F("pid.setpoint"))) {
-        double_to_string(output, heater.get_setpoint());
-        return true;
-    } else if (is_token(token[0], F("debug"))) {
-      copy_flash_string(output, settings.is_debug() ? F("true") : F("false"), output_size);
-      return true;
-    } else if (is_token(token[0], F("countdown_mode"))) {
-      copy_flash_string(output, settings.is_countdown_mode() ? F("true") : F("false"), output_size);
-      return true;
+    // The token is validated once for the whole batch
+    int token_count = command_count > 0 ? tokenize(command[0], token_buffer, array_size(token_buffer), token, array_size(token)) : 0;
+    if (token_count != 2 || !is_token(token[0], F("token")) || !this->validate_security_token(atoi(token[1]))) {
+        add_result(json, false, "Invalid security token", true);
+        json.add(F("]"));
+        return false;
     }
 
-    return false;
-}
-
-bool CommandParser::set(char** token, const int token_count, char* output, size_t output_size) {
+    // Keep the state before the batch for the rollback
     Settings& settings = get_settings();
+    HeaterPID& heater = get_heater();
+    const Settings snapshot = settings;
+    const bool heater_enabled = heater.is_enabled();
 
-    if (is_token(token[0], F("wifi"), token_count > 3)) {
-        return settings.validate_set_wifi(token[1], token[2], token[3]);
-    } else if (is_token(token[0], F("id"), token_count > 1)) {
-        return settings.validate_set_device_id(token[1]);
-    } else if (is_token(token[0], F("heater"), token_count > 2)) {
-      return settings.validate_set_heater_temperature_low(atof(token[1])) && settings.validate_set_heater_temperature_high(atof(token[2]));
-    } else if (is_token(token[0], F("heater.low"), token_count > 1)) {
-        return settings.validate_set_heater_temperature_low(atof(token[1]));
-    } else if (is_token(token[0], F("heater.high"), token_count > 1)) {
-        return settings.validate_set_heater_temperature_high(atof(token[1]));
-    } else if (is_token(token[0], F("heater.enabled"), token_count > 1)) {
-        if (is_token(token[1], F("true"))) {
-            get_heater().enable();
-            return true;
-        } else if (is_token(token[1], F("false"))) {
-            get_heater().disable();
-            return true;
+    bool success = true;
+    for (int index = 1; index < command_count; index++) {
+        if (!success) {
+            add_result(json, false, "skipped", index == 1);
+            continue;
         }
-    } else if (is_token(token[0], F("pid"), token_count > 3)) {
-        // Reconfigure pid
-        if (settings.validate_set_heater_pid(atof(token[1]), atof(token[2]), atof(token[3]))) {
-            get_heater().configure(settings.heater_kp, settings.heater_ki, settings.heater_kd);
-            return true;
+
+        token_count = tokenize(command[index], token_buffer, array_size(token_buffer), token, array_size(token));
+        output[0] = 0x00;
+        if (index + 1 < command_count && token_count > 0 && !is_token(token[0], F("get")) && !is_token(token[0], F("set"))) {
+            copy_flash_string(output, F("Only the last command of a batch may be autotune, save, purge, restart or help"), array_size(output));
+            success = false;
+        } else {
+            success = this->run(token, token_count, command[index], output, array_size(output));
         }
-    } else if (is_token(token[0], F("debug"), token_count > 1)) {
-        settings.set_debug(is_token(token[1], F("true")));
-        return true;
-    } else if (is_token(token[0], F("countdown_mode"), token_count > 1)) {
-        settings.set_countdown_mode(is_token(token[1], F("true")));
-        return true;
-    }
 
-    return false;
-}
+        add_result(json, success, output, index == 1);
+    }
 
-void CommandParser::restart() {
-    Serial.println(F("Restarting device using watchdog in 4 seconds"));
+    json.add(F("]"));
+
+    if (!success) {
+        settings = snapshot;
+        heater.configure(settings.heater_kp, settings.heater_ki, settings.heater_kd);
+        get_temperature_sensor().configure_filter();
+        get_relay_output().configure(settings);
+        // Enabling again would start a new warm-up, only a changed state is restored
+        if (heater_enabled != heater.is_enabled()) {
+            if (heater_enabled) {
+                heater.enable();
+            } else {
+                heater.disable();
+            }
+        }
+    }
 
-    wdt_disable();
-    wdt_enable(WDTO_4S);
-    while (1) {}
+    Serial.printf("CommandParser::execute_batch %d commands %s\n", command_count - 1, success ? "applied" : "rolled back");
+    return success && command_count > 1;
 }
 
 CommandParser& get_command_parser() {
@@ -1,6 +1,28 @@
 #pragma once
 
 #include <stddef.h>
+#include <stdint.h>
+
+// Handlers get the arguments after the command name, validators check them before the handler runs
+typedef bool (*CommandHandler)(char** argument, int argument_count, char* output, size_t output_size);
+typedef bool (*CommandValidator)(char** argument, int argument_count);
+
+// The command tables live in PROGMEM with the strings inlined, entries are copied to ram before they are used
+constexpr size_t COMMAND_NAME_SIZE = 16;
+constexpr size_t COMMAND_USAGE_SIZE = 60;
+
+struct CommandDescriptor {
+    char name[COMMAND_NAME_SIZE];  // Lower case, the tables are sorted by name
+    uint8_t arity;                 // Minimum number of arguments
+    CommandHandler handler;
+    CommandValidator validator;    // Optional
+    char usage[COMMAND_USAGE_SIZE];  // Arguments for the help text
+};
+
+// Maximum number of commands in one batch
+constexpr int COMMAND_BATCH_SIZE = 16;
+
+class JsonStream;
 
 class CommandParser
 {
@@ -16,16 +38,17 @@ public:
 
     bool execute(const char* command, bool requires_security_token, char* output, size_t output_size);
 
+    // Executes ';' or newline separated commands, the first one has to be "token <token>". The commands are applied
+    // atomically, if one fails the settings and the heater are restored and the remaining commands are skipped.
+    // Commands other than get and set are only allowed last. Writes a json array with one result per command
+    bool execute_batch(char* commands, JsonStream& json);
+
 private:
+    bool run(char** token, int token_count, const char* command, char* output, size_t output_size);
+
     char serialbuffer[96];
     int security_token[2];
     unsigned long security_token_timeout;
-
-    bool main(char** token, const int token_count, char* output, size_t output_size);
-    bool get(char** token, const int token_count, char* output, size_t output_size);
-    bool set(char** token, const int token_count, char* output, size_t output_size);
-
-    void restart();
 };
 
 CommandParser& get_command_parser();
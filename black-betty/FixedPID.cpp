@@ -0,0 +1,127 @@
+#include "FixedPID.h"
+
+#include <Arduino.h>
+
+// Product of two Q16.16 values, rounded to Q16.16
+static inline int64_t fixed_multiply(fixed_t a, fixed_t b) {
+    return (static_cast<int64_t>(a) * static_cast<int64_t>(b) + (1L << (FIXED_SHIFT - 1))) >> FIXED_SHIFT;
+}
+
+FixedPID::FixedPID(double* input, double* output, double* setpoint, double kp, double ki, double kd, int direction) :
+        display_kp(0.0),
+        display_ki(0.0),
+        display_kd(0.0),
+        kp(0),
+        ki(0),
+        kd(0),
+        input(input),
+        output(output),
+        setpoint(setpoint),
+        last_time(0),
+        sample_time(100),
+        output_sum(0),
+        last_input(0),
+        output_min(0),
+        output_max(0),
+        direction(direction),
+        automatic(false) {
+    this->SetOutputLimits(0.0, 255.0);
+    this->SetTunings(kp, ki, kd);
+    this->last_time = millis() - this->sample_time;
+}
+
+bool FixedPID::Compute() {
+    if (!this->automatic) {
+        return false;
+    }
+
+    const unsigned long now = millis();
+    if (now - this->last_time < this->sample_time) {
+        return false;
+    }
+
+    const fixed_t input = to_fixed(*this->input);
+    const fixed_t error = to_fixed(*this->setpoint) - input;
+    const fixed_t delta_input = input - this->last_input;
+
+    // The integral never leaves the output limits (anti-windup)
+    this->output_sum = this->clamp_output(this->output_sum + fixed_multiply(this->ki, error));
+
+    // Proportional on error, derivative on measurement so a setpoint change causes no kick
+    const int64_t output = fixed_multiply(this->kp, error) + this->output_sum - fixed_multiply(this->kd, delta_input);
+    *this->output = from_fixed(this->clamp_output(output));
+
+    this->last_input = input;
+    this->last_time = now;
+    return true;
+}
+
+void FixedPID::SetTunings(double kp, double ki, double kd) {
+    if (kp < 0.0 || ki < 0.0 || kd < 0.0) {
+        return;
+    }
+
+    this->display_kp = kp;
+    this->display_ki = ki;
+    this->display_kd = kd;
+    this->update_gains();
+}
+
+void FixedPID::SetSampleTime(int sample_time) {
+    if (sample_time > 0) {
+        this->sample_time = static_cast<unsigned long>(sample_time);
+        this->update_gains();
+    }
+}
+
+void FixedPID::SetOutputLimits(double min, double max) {
+    if (min >= max) {
+        return;
+    }
+
+    this->output_min = static_cast<int64_t>(min * static_cast<double>(1L << FIXED_SHIFT));
+    this->output_max = static_cast<int64_t>(max * static_cast<double>(1L << FIXED_SHIFT));
+    if (this->automatic) {
+        *this->output = from_fixed(this->clamp_output(static_cast<int64_t>(*this->output * static_cast<double>(1L << FIXED_SHIFT))));
+        this->output_sum = this->clamp_output(this->output_sum);
+    }
+}
+
+void FixedPID::SetMode(int mode) {
+    const bool automatic = mode == AUTOMATIC;
+    if (automatic && !this->automatic) {
+        this->Initialize();
+    }
+
+    this->automatic = automatic;
+}
+
+void FixedPID::SetControllerDirection(int direction) {
+    this->direction = direction;
+    this->update_gains();
+}
+
+double FixedPID::GetKp() const { return this->display_kp; }
+double FixedPID::GetKi() const { return this->display_ki; }
+double FixedPID::GetKd() const { return this->display_kd; }
+int FixedPID::GetMode() const { return this->automatic ? AUTOMATIC : MANUAL; }
+int FixedPID::GetDirection() const { return this->direction; }
+
+// Bumpless transfer from manual mode
+void FixedPID::Initialize() {
+    this->output_sum = this->clamp_output(static_cast<int64_t>(*this->output * static_cast<double>(1L << FIXED_SHIFT)));
+    this->last_input = to_fixed(*this->input);
+}
+
+// Integral and derivative gains are scaled by the sample time, so Compute() needs no time arithmetic
+void FixedPID::update_gains() {
+    const double sample_time = static_cast<double>(this->sample_time) / 1000.0;
+    const double sign = this->direction == REVERSE ? -1.0 : 1.0;
+    this->kp = to_fixed(sign * this->display_kp);
+    this->ki = to_fixed(sign * this->display_ki * sample_time);
+    this->kd = to_fixed(sign * this->display_kd / sample_time);
+}
+
+int64_t FixedPID::clamp_output(int64_t value) const {
+    return value < this->output_min ? this->output_min : (value > this->output_max ? this->output_max : value);
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <stdint.h>
+
+// Same mode and direction values as the PID library, so HeaterPID can use either implementation
+#ifndef AUTOMATIC
+#define AUTOMATIC 1
+#define MANUAL 0
+#define DIRECT 0
+#define REVERSE 1
+#endif
+
+// Q16.16 fixed point, -32768.0 .. 32767.99998 with a resolution of 0.000015
+typedef int32_t fixed_t;
+constexpr int FIXED_SHIFT = 16;
+
+inline fixed_t to_fixed(double value) {
+    const double scaled = value * static_cast<double>(1L << FIXED_SHIFT);
+    if (scaled >= 2147483647.0) {
+        return INT32_MAX;
+    } else if (scaled <= -2147483648.0) {
+        return INT32_MIN;
+    }
+
+    return static_cast<fixed_t>(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+}
+
+inline double from_fixed(int64_t value) {
+    return static_cast<double>(value) / static_cast<double>(1L << FIXED_SHIFT);
+}
+
+/*
+    Fixed point replacement of the PID library (V1.2, Brett Beauregard) with the same api and the same
+    behaviour: proportional on error, derivative on measurement and the integral clamped to the output
+    limits (anti-windup). The ESP8266 has no FPU, so all arithmetic of Compute() is done in Q16.16 with
+    64 bit products. Only input, setpoint and output are converted from and to double. The integral and
+    the output use 64 bits, so the output limits can span the whole 16 bit window.
+
+    The gains are stored scaled by the sample time like in the original and saturate at 32767, which
+    limits kd to 3276 at the default sample time of 100 ms.
+*/
+class FixedPID {
+public:
+    FixedPID(double* input, double* output, double* setpoint, double kp, double ki, double kd, int direction);
+    FixedPID(const FixedPID&) = delete;
+    FixedPID& operator=(const FixedPID&) = delete;
+
+    void SetMode(int mode);
+    bool Compute();
+    void SetOutputLimits(double min, double max);
+
+    void SetTunings(double kp, double ki, double kd);
+    void SetControllerDirection(int direction);
+    void SetSampleTime(int sample_time);
+
+    double GetKp() const;
+    double GetKi() const;
+    double GetKd() const;
+    int GetMode() const;
+    int GetDirection() const;
+
+private:
+    void Initialize();
+    void update_gains();
+    int64_t clamp_output(int64_t value) const;
+
+    double display_kp;
+    double display_ki;
+    double display_kd;
+
+    fixed_t kp;
+    fixed_t ki;
+    fixed_t kd;
+
+    double* input;
+    double* output;
+    double* setpoint;
+
+    unsigned long last_time;
+    unsigned long sample_time;
+    int64_t output_sum;
+    fixed_t last_input;
+    int64_t output_min;
+    int64_t output_max;
+    int direction;
+    bool automatic;
+};
@@ -4,14 +4,19 @@
 #include <Arduino.h>
 
 #include "Settings.h"
+#include "Status.h"
+#include "RelayOutput.h"
+#include "TemperatureSensor.h"
 
 HeaterPID::HeaterPID() : input(0),
                          output(0),
                          setpoint(0),
                          window(100),
-                         active(false),
+                         warmup_pending(true),
                          pid(&input, &output, &setpoint, 0.0, 0.0, 0.0, DIRECT) {
     const Settings &settings = get_settings();
+    // The pid computes once per sensor conversion
+    this->pid.SetSampleTime(static_cast<int>(SENSOR_CONVERSION_TIME));
     this->configure(settings.heater_kp, settings.heater_ki, settings.heater_kd);
     this->setpoint = settings.heater_temperature_low;
     this->window = settings.heater_window;
@@ -24,29 +29,136 @@ double HeaterPID::get_input() const { return this->input; }
 double HeaterPID::get_output() const { return this->output; }
 double HeaterPID::get_setpoint() const { return this->setpoint; }
 
-void HeaterPID::compute(double input) {
+bool HeaterPID::compute(const SensorSample& sample) {
+    RelayOutput& relay = get_relay_output();
+
     // If the PID is disabled, the digital state is off
     if (this->pid.GetMode() == MANUAL) {
-        this->active = false;
-        return;
+        relay.publish(0, static_cast<unsigned long>(this->window));
+        return true;
     }
 
-    // Compute the current PID
-    this->input = input;
-    this->pid.Compute();
+    // The tuning owns the output until it is done
+    if (this->autotune.is_running()) {
+        this->input = sample.temperature;
+
+        // Same cut-off as the pid, a borked sensor would keep the relay oscillating around a wrong temperature
+        if (sample.temperature < 5.0) {
+            Serial.printf("HeaterPID::compute Temperature %.1f too low, tuning aborted\n", sample.temperature);
+            this->autotune.fail();
+            this->finish_autotune();
+            relay.publish(0, static_cast<unsigned long>(this->window));
+            return true;
+        }
+
+        this->output = this->autotune.next(sample.temperature, sample.time);
+        if (!this->autotune.is_running()) {
+            this->finish_autotune();
+        }
+
+        relay.publish(static_cast<unsigned long>(this->output), static_cast<unsigned long>(this->window));
+        return true;
+    }
+
+    // The warm-up runs when the heater starts or the setpoint is raised and the temperature is far below it
+    if (this->warmup_pending) {
+        this->warmup_pending = false;
+        if (get_settings().is_warmup() && this->warmup.start(sample.temperature, this->setpoint, sample.time)) {
+            Serial.printf("HeaterPID::compute Warm-up from %.1f to %.1f\n", sample.temperature, this->setpoint);
+        }
+    }
 
-    int elapsed = static_cast<int>(millis() % static_cast<unsigned long>(this->window));
-    this->active = elapsed < static_cast<int>(this->output);
+    if (this->warmup.is_active()) {
+        this->input = sample.temperature;
+        this->output = this->warmup.next(sample.temperature, this->setpoint, sample.time) * static_cast<double>(this->window);
+        if (!this->warmup.is_active()) {
+            this->resume(this->warmup.get_model().get_holding_power(this->setpoint) * static_cast<double>(this->window));
+        }
+
+        const unsigned long on_time = sample.temperature < 5.0 ? 0 : static_cast<unsigned long>(this->output);
+        relay.publish(on_time, static_cast<unsigned long>(this->window));
+        return true;
+    }
+
+    // Compute the current PID, a sample that arrives early (task jitter) is kept for the next run
+    this->input = sample.temperature;
+    if (!this->pid.Compute()) {
+        return false;
+    }
 
     // Disable the heater if the temperature is lower than 5° and assume that the temperature sensor is borked
-    if (input < 5.0) {
-        this->active = false;
+    const unsigned long on_time = sample.temperature < 5.0 || this->output <= 0.0 ? 0 : static_cast<unsigned long>(this->output);
+    relay.publish(on_time, static_cast<unsigned long>(this->window));
+    return true;
+}
+
+void HeaterPID::suspend() {
+    get_relay_output().publish(0, static_cast<unsigned long>(this->window));
+}
+
+bool HeaterPID::start_autotune(AutoTuneRule rule) {
+    if (!this->is_enabled()) {
+        return false;
+    }
+
+    this->warmup.stop();
+    this->autotune.start(rule, this->setpoint, static_cast<double>(this->window), millis());
+    return true;
+}
+
+void HeaterPID::stop_autotune() {
+    if (this->autotune.is_running()) {
+        this->autotune.stop();
+        this->finish_autotune();
     }
 }
 
+const PidAutoTune& HeaterPID::get_autotune() const {
+    return this->autotune;
+}
+
+// Applies the tuned gains and hands back to the pid, which starts from the average output of the tuning
+void HeaterPID::finish_autotune() {
+    if (this->autotune.get_state() == AutoTuneState::done) {
+        const PidAutoTune& result = this->autotune;
+        if (get_settings().validate_set_heater_pid(result.get_kp(), result.get_ki(), result.get_kd())) {
+            this->configure(result.get_kp(), result.get_ki(), result.get_kd());
+            Serial.printf("HeaterPID::finish_autotune Ku %.2f Tu %.1f s: kp %.3f ki %.4f kd %.3f\n", result.get_ultimate_gain(),
+                result.get_ultimate_period(), result.get_kp(), result.get_ki(), result.get_kd());
+        } else {
+            Serial.printf("HeaterPID::finish_autotune Gains out of range: kp %.3f ki %.4f kd %.3f\n", result.get_kp(), result.get_ki(), result.get_kd());
+            this->autotune.fail();
+        }
+    }
+
+    this->resume(this->autotune.get_state() == AutoTuneState::done ? this->autotune.get_average_output() : 0.0);
+}
+
+// Hands back to the pid, which continues bumpless from the given output
+void HeaterPID::resume(double output) {
+    this->output = output;
+    this->pid.SetMode(MANUAL);
+    this->pid.SetMode(AUTOMATIC);
+}
+
+void HeaterPID::identify(const StatusHistoryItem& slot) {
+    // Slots before the first sensor sample have no temperature
+    if (slot.samples == 0 || slot.temperature.min <= 0) {
+        return;
+    }
+
+    const double samples = static_cast<double>(slot.samples);
+    this->warmup.identify(slot.temperature.sum / samples / 1000.0, slot.heater.sum / samples / 1000.0);
+}
+
+const WarmupController& HeaterPID::get_warmup() const {
+    return this->warmup;
+}
+
 void HeaterPID::set_setpoint(double setpoint) {
     // Limit setpoint to hard coded range
     setpoint = setpoint < 20.0 ? 20.0 : (setpoint > 150.0 ? 150.0 : setpoint);
+    this->warmup_pending = this->warmup_pending || setpoint > this->setpoint;
     this->setpoint = setpoint;
 }
 
@@ -69,7 +181,7 @@ void HeaterPID::configure(double kp, double ki, double kd) {
 }
 
 bool HeaterPID::is_active() const {
-  return this->active;
+  return get_relay_output().is_active();
 }
 
 bool HeaterPID::is_enabled() const {
@@ -77,11 +189,15 @@ bool HeaterPID::is_enabled() const {
 }
 
 void HeaterPID::enable() {
+    this->warmup_pending = true;
     this->pid.SetMode(AUTOMATIC);
 }
 
 void HeaterPID::disable() {
+    this->autotune.stop();
+    this->warmup.stop();
     this->pid.SetMode(MANUAL);
+    get_relay_output().publish(0, static_cast<unsigned long>(this->window));
 }
 
 HeaterPID &get_heater() {
@@ -1,6 +1,23 @@
 #pragma once
 
+// Set to 1 to use the in-tree fixed point pid instead of the PID library, the ESP8266 has no FPU
+#ifndef HEATER_PID_FIXED_POINT
+#define HEATER_PID_FIXED_POINT 0
+#endif
+
+#if HEATER_PID_FIXED_POINT
+#include "FixedPID.h"
+typedef FixedPID HeaterPIDEngine;
+#else
 #include <PID_v1.h>
+typedef PID HeaterPIDEngine;
+#endif
+
+#include "PidAutoTune.h"
+#include "WarmupController.h"
+
+struct SensorSample;
+struct StatusHistoryItem;
 
 /*
     Class for managing the heater pid
@@ -24,11 +41,25 @@ public:
     double get_window() const;
     void set_window(int window);
 
-    void compute(double input);
+    // Computes the pid for a new sensor sample, false if the pid is not due yet and the sample should be retried
+    bool compute(const SensorSample& sample);
+
+    // Switches the relay off until the next computed sample, used while the sensor delivers no samples
+    void suspend();
+
+    // Relay feedback tuning around the current setpoint, the gains are applied (not saved) when it is done.
+    // False if the heater is disabled
+    bool start_autotune(AutoTuneRule rule);
+    void stop_autotune();
+    const PidAutoTune& get_autotune() const;
+
+    // Feeds a closed history slot to the boiler model of the warm-up
+    void identify(const StatusHistoryItem& slot);
+    const WarmupController& get_warmup() const;
 
     void configure(double kp, double ki, double kd);
 
-    // Should the heating switch turned on?
+    // Is the heating switch turned on? The relay itself is switched by the RelayOutput interrupt
     bool is_active() const;
 
     // Is the complete pid enabled oder disabled?
@@ -37,12 +68,17 @@ public:
     void disable();
 
 private:
-    PID pid;
+    void finish_autotune();
+    void resume(double output);
+
+    HeaterPIDEngine pid;
+    PidAutoTune autotune;
+    WarmupController warmup;
+    bool warmup_pending;
     double setpoint;
     double input;
     double output;
     int window;
-    bool active;
 };
 
 HeaterPID& get_heater();
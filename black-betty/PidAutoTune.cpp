@@ -0,0 +1,161 @@
+#include "PidAutoTune.h"
+
+#include <math.h>
+#include <Arduino.h>
+
+// Proportional gain (factor of Ku), integral and derivative time (factors of Tu) of the rules
+struct AutoTuneFactors {
+    double kp;
+    double ti;
+    double td;
+};
+
+static const AutoTuneFactors RULE_FACTORS[] = {
+    { 0.6, 0.5, 0.125 },            // classic
+    { 0.33, 0.5, 0.33 },            // some_overshoot
+    { 0.2, 0.5, 0.33 },             // no_overshoot
+    { 1.0 / 2.2, 2.2, 1.0 / 6.3 },  // tyreus_luyben
+};
+
+PidAutoTune::PidAutoTune() : state(AutoTuneState::idle), rule(AutoTuneRule::classic), setpoint(0.0), output_max(0.0),
+                             heating(false), start_time(0), last_time(0), cycle(0), cycle_start(0), cycle_max(0.0),
+                             cycle_min(0.0), cycle_energy(0.0), period_sum(0), amplitude_sum(0.0), energy_sum(0.0),
+                             ultimate_gain(0.0), ultimate_period(0.0), kp(0.0), ki(0.0), kd(0.0) {
+}
+
+void PidAutoTune::start(AutoTuneRule rule, double setpoint, double output_max, unsigned long now) {
+    this->state = AutoTuneState::running;
+    this->rule = rule;
+    this->setpoint = setpoint;
+    this->output_max = output_max;
+    this->heating = true;
+    this->start_time = now;
+    this->last_time = now;
+    this->cycle = 0;
+    this->cycle_start = 0;
+    this->cycle_max = setpoint;
+    this->cycle_min = setpoint;
+    this->cycle_energy = 0.0;
+    this->period_sum = 0;
+    this->amplitude_sum = 0.0;
+    this->energy_sum = 0.0;
+}
+
+void PidAutoTune::stop() {
+    if (this->state == AutoTuneState::running) {
+        this->state = AutoTuneState::idle;
+    }
+}
+
+void PidAutoTune::fail() {
+    this->state = AutoTuneState::failed;
+}
+
+double PidAutoTune::next(double temperature, unsigned long time) {
+    if (this->state != AutoTuneState::running) {
+        return 0.0;
+    }
+
+    if (temperature > this->setpoint + AUTOTUNE_MAX_OVERSHOOT) {
+        Serial.printf("PidAutoTune::next Temperature %.1f overshoots the setpoint %.1f, tuning failed\n", temperature, this->setpoint);
+        this->state = AutoTuneState::failed;
+        return 0.0;
+    }
+
+    if (time - this->start_time > AUTOTUNE_TIMEOUT) {
+        Serial.printf("PidAutoTune::next No oscillation after %lu s, tuning failed\n", (time - this->start_time) / 1000);
+        this->state = AutoTuneState::failed;
+        return 0.0;
+    }
+
+    this->cycle_energy += (this->heating ? this->output_max : 0.0) * static_cast<double>(time - this->last_time);
+    this->last_time = time;
+    this->cycle_max = temperature > this->cycle_max ? temperature : this->cycle_max;
+    this->cycle_min = temperature < this->cycle_min ? temperature : this->cycle_min;
+
+    // A cycle starts whenever the heater switches on
+    if (this->heating && temperature > this->setpoint + AUTOTUNE_HYSTERESIS) {
+        this->heating = false;
+    } else if (!this->heating && temperature < this->setpoint - AUTOTUNE_HYSTERESIS) {
+        this->heating = true;
+        if (this->cycle_start != 0) {
+            this->finish_cycle(time);
+        }
+
+        this->cycle_start = time;
+        this->cycle_max = temperature;
+        this->cycle_min = temperature;
+        this->cycle_energy = 0.0;
+    }
+
+    return this->state == AutoTuneState::running && this->heating ? this->output_max : 0.0;
+}
+
+void PidAutoTune::finish_cycle(unsigned long time) {
+    if (this->cycle > 0) {
+        this->period_sum += time - this->cycle_start;
+        this->amplitude_sum += (this->cycle_max - this->cycle_min) / 2.0;
+        this->energy_sum += this->cycle_energy;
+    }
+
+    if (++this->cycle >= AUTOTUNE_CYCLES) {
+        this->compute();
+    }
+}
+
+void PidAutoTune::compute() {
+    const double cycles = static_cast<double>(AUTOTUNE_CYCLES - 1);
+    const double amplitude = this->amplitude_sum / cycles;
+    if (amplitude <= AUTOTUNE_HYSTERESIS || this->period_sum == 0) {
+        Serial.printf("PidAutoTune::compute Oscillation too small (%.3f), tuning failed\n", amplitude);
+        this->state = AutoTuneState::failed;
+        return;
+    }
+
+    // Describing function of a relay with hysteresis
+    const double relay_amplitude = this->output_max / 2.0;
+    this->ultimate_gain = 4.0 * relay_amplitude / (M_PI * sqrt(amplitude * amplitude - AUTOTUNE_HYSTERESIS * AUTOTUNE_HYSTERESIS));
+    this->ultimate_period = static_cast<double>(this->period_sum) / cycles / 1000.0;
+
+    const AutoTuneFactors& factors = RULE_FACTORS[static_cast<uint8_t>(this->rule)];
+    this->kp = factors.kp * this->ultimate_gain;
+    this->ki = this->kp / (factors.ti * this->ultimate_period);
+    this->kd = this->kp * factors.td * this->ultimate_period;
+    this->state = AutoTuneState::done;
+}
+
+AutoTuneState PidAutoTune::get_state() const { return this->state; }
+AutoTuneRule PidAutoTune::get_rule() const { return this->rule; }
+bool PidAutoTune::is_running() const { return this->state == AutoTuneState::running; }
+int PidAutoTune::get_cycle() const { return this->cycle; }
+double PidAutoTune::get_ultimate_gain() const { return this->ultimate_gain; }
+double PidAutoTune::get_ultimate_period() const { return this->ultimate_period; }
+double PidAutoTune::get_kp() const { return this->kp; }
+double PidAutoTune::get_ki() const { return this->ki; }
+double PidAutoTune::get_kd() const { return this->kd; }
+
+unsigned long PidAutoTune::get_elapsed(unsigned long now) const {
+    return this->state == AutoTuneState::idle ? 0 : (this->state == AutoTuneState::running ? now : this->last_time) - this->start_time;
+}
+
+double PidAutoTune::get_average_output() const {
+    return this->period_sum > 0 ? this->energy_sum / static_cast<double>(this->period_sum) : 0.0;
+}
+
+const __FlashStringHelper* PidAutoTune::get_state_name(AutoTuneState state) {
+    switch (state) {
+        case AutoTuneState::running: return F("running");
+        case AutoTuneState::done: return F("done");
+        case AutoTuneState::failed: return F("failed");
+        default: return F("idle");
+    }
+}
+
+const __FlashStringHelper* PidAutoTune::get_rule_name(AutoTuneRule rule) {
+    switch (rule) {
+        case AutoTuneRule::some_overshoot: return F("some_overshoot");
+        case AutoTuneRule::no_overshoot: return F("no_overshoot");
+        case AutoTuneRule::tyreus_luyben: return F("tyreus_luyben");
+        default: return F("classic");
+    }
+}
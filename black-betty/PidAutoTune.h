@@ -0,0 +1,104 @@
+#pragma once
+
+#include <stdint.h>
+
+class __FlashStringHelper;
+
+// Band around the setpoint the relay switches at, keeps sensor noise from toggling the relay
+constexpr double AUTOTUNE_HYSTERESIS = 0.1;
+
+// Measured oscillations, the first one starts from wherever the temperature was and is not used
+constexpr int AUTOTUNE_CYCLES = 4;
+
+// The tuning fails if it takes longer (ms) or the temperature runs away above the setpoint
+constexpr unsigned long AUTOTUNE_TIMEOUT = 45UL * 60UL * 1000UL;
+constexpr double AUTOTUNE_MAX_OVERSHOOT = 20.0;
+
+enum class AutoTuneState : uint8_t {
+    idle,
+    running,
+    done,
+    failed
+};
+
+// Tuning rules for the ultimate gain and period
+enum class AutoTuneRule : uint8_t {
+    classic,         // Ziegler-Nichols
+    some_overshoot,
+    no_overshoot,
+    tyreus_luyben
+};
+
+/*
+    Relay feedback auto tuning (Astrom-Hagglund). The output switches between full and no power whenever the
+    temperature crosses the setpoint (with hysteresis), which makes the heater oscillate at its ultimate period.
+    From the amplitude a of the oscillation and the relay amplitude d the ultimate gain is
+    Ku = 4 d / (pi sqrt(a^2 - hysteresis^2)), the period Tu comes from the sample times. The gains follow from
+    Ku and Tu by the selected rule.
+*/
+class PidAutoTune {
+public:
+    PidAutoTune();
+    PidAutoTune(const PidAutoTune&) = delete;
+    PidAutoTune& operator=(const PidAutoTune&) = delete;
+
+    void start(AutoTuneRule rule, double setpoint, double output_max, unsigned long now);
+    void stop();
+
+    // Marks the tuning as failed, used when it is aborted or the gains are not accepted
+    void fail();
+
+    // Feeds the next sample, returns the output for the heater while running
+    double next(double temperature, unsigned long time);
+
+    AutoTuneState get_state() const;
+    AutoTuneRule get_rule() const;
+    bool is_running() const;
+
+    // Completed cycles (of AUTOTUNE_CYCLES) and the time since the start in ms
+    int get_cycle() const;
+    unsigned long get_elapsed(unsigned long now) const;
+
+    // Result, valid when done
+    double get_ultimate_gain() const;
+    double get_ultimate_period() const;
+    double get_kp() const;
+    double get_ki() const;
+    double get_kd() const;
+
+    // Average output of the measured cycles, the pid continues from there
+    double get_average_output() const;
+
+    static const __FlashStringHelper* get_state_name(AutoTuneState state);
+    static const __FlashStringHelper* get_rule_name(AutoTuneRule rule);
+
+private:
+    void finish_cycle(unsigned long time);
+    void compute();
+
+    AutoTuneState state;
+    AutoTuneRule rule;
+    double setpoint;
+    double output_max;
+    bool heating;
+    unsigned long start_time;
+    unsigned long last_time;
+
+    // Current cycle, it starts when the heater switches on
+    int cycle;
+    unsigned long cycle_start;
+    double cycle_max;
+    double cycle_min;
+    double cycle_energy;
+
+    // Sums of the measured cycles
+    unsigned long period_sum;
+    double amplitude_sum;
+    double energy_sum;
+
+    double ultimate_gain;
+    double ultimate_period;
+    double kp;
+    double ki;
+    double kd;
+};
@@ -0,0 +1,120 @@
+#include "RelayOutput.h"
+
+#include <Arduino.h>
+
+#include "Settings.h"
+
+// The interrupt handler can not use the singleton accessor (guard variable), so keep a plain pointer
+static RelayOutput* relay_output_instance = nullptr;
+
+static void IRAM_ATTR on_relay_timer() {
+    relay_output_instance->tick();
+}
+
+RelayOutput::RelayOutput() : slot(0), active(false), mode(RelayMode::window), min_cycles(1), switch_count(0),
+                             position(0), held_cycles(0), accumulator(0), pin(0) {
+}
+
+void RelayOutput::begin(uint8_t pin) {
+    this->pin = pin;
+    digitalWrite(this->pin, LOW);
+
+    // 80 MHz / 16 = 5 ticks per micro second
+    relay_output_instance = this;
+    timer1_isr_init();
+    timer1_attachInterrupt(on_relay_timer);
+    timer1_enable(TIM_DIV16, TIM_EDGE, TIM_LOOP);
+    timer1_write(RELAY_TICK_US * 5);
+}
+
+void RelayOutput::configure(const Settings& settings) {
+    const unsigned long cycles = settings.relay_min_time / (RELAY_HALF_CYCLE_TICKS * RELAY_TICK_US / 1000);
+
+    // The interrupt works on the same state, a tick in between would mix the old and the new configuration
+    noInterrupts();
+    this->min_cycles = static_cast<uint16_t>(cycles < 1 ? 1 : cycles);
+    this->accumulator = 0;
+    this->held_cycles = 0;
+    this->position = 0;
+    this->mode = static_cast<RelayMode>(settings.relay_mode);
+    interrupts();
+}
+
+void RelayOutput::publish(unsigned long on_time, unsigned long window) {
+    window = window > UINT16_MAX ? UINT16_MAX : window;
+    on_time = on_time > window ? window : on_time;
+    this->slot = (static_cast<uint32_t>(on_time) << 16) | static_cast<uint32_t>(window);
+}
+
+bool RelayOutput::is_active() const {
+    return this->active;
+}
+
+unsigned long RelayOutput::get_switch_count() const {
+    return this->switch_count;
+}
+
+void IRAM_ATTR RelayOutput::tick() {
+    const uint32_t slot = this->slot;
+    const uint16_t window = static_cast<uint16_t>(slot & 0xFFFF);
+    const uint16_t on_time = static_cast<uint16_t>(slot >> 16);
+
+    const bool active = this->mode == RelayMode::pulse ? this->next_pulse(on_time, window) : this->next_window(on_time, window);
+    if (active != this->active) {
+        this->active = active;
+        this->switch_count++;
+        digitalWrite(this->pin, active ? HIGH : LOW);
+    }
+}
+
+bool IRAM_ATTR RelayOutput::next_window(uint16_t on_time, uint16_t window) {
+    if (window == 0) {
+        this->position = 0;
+    } else if (++this->position >= window) {
+        this->position = 0;
+    }
+
+    return this->position < on_time;
+}
+
+// Integer only, the interrupt must not use the software floating point
+bool IRAM_ATTR RelayOutput::next_pulse(uint16_t on_time, uint16_t window) {
+    if (on_time == 0 || window == 0) {
+        this->position = 0;
+        this->held_cycles = 0;
+        this->accumulator = 0;
+        return false;
+    }
+
+    // The state only changes on half cycle boundaries
+    if (++this->position < RELAY_HALF_CYCLE_TICKS) {
+        return this->active;
+    }
+    this->position = 0;
+
+    // Every half cycle earns the duty and an active one spends a full half cycle. The limit keeps a changed duty
+    // from paying off an old debt for a long time
+    const int32_t limit = static_cast<int32_t>(window) * (this->min_cycles + 1);
+    this->accumulator += static_cast<int32_t>(on_time) - (this->active ? static_cast<int32_t>(window) : 0);
+    this->accumulator = this->accumulator > limit ? limit : (this->accumulator < -limit ? -limit : this->accumulator);
+
+    if (this->held_cycles < UINT16_MAX) {
+        this->held_cycles++;
+    }
+
+    if (this->held_cycles < this->min_cycles) {
+        return this->active;
+    }
+
+    const bool active = this->accumulator > 0;
+    if (active != this->active) {
+        this->held_cycles = 0;
+    }
+
+    return active;
+}
+
+RelayOutput& get_relay_output() {
+    static RelayOutput instance;
+    return instance;
+}
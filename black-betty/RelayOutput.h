@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+
+// Resolution of the time proportional output in micros
+constexpr unsigned long RELAY_TICK_US = 1000;
+
+// Mains frequency, the pulse mode switches on half cycle boundaries
+#ifndef RELAY_MAINS_FREQUENCY
+#define RELAY_MAINS_FREQUENCY 50
+#endif
+
+constexpr unsigned long RELAY_HALF_CYCLE_TICKS = 1000000 / (2 * RELAY_MAINS_FREQUENCY) / RELAY_TICK_US;
+
+// Longest minimum on/off time of the pulse mode in ms
+constexpr unsigned long RELAY_MAX_MIN_TIME = 5000;
+
+class Settings;
+
+enum class RelayMode : uint8_t {
+    window,
+    pulse
+};
+
+/*
+    Time proportional relay output driven by the timer1 interrupt, so the relay timing does not depend on
+    how long the main loop is busy. The heater pid publishes on time and window (both ms) into a single
+    32 bit slot, which is written atomically. The interrupt is the only reader and the pid the only
+    writer, so no locking is needed.
+
+    RelayMode::window switches on at the start of every window for the on time. RelayMode::pulse spreads the
+    same energy with a sigma-delta modulator in whole mains half cycles: every half cycle adds the duty to an
+    accumulator, the relay is on while the accumulator is positive and keeps every state for at least the
+    minimum on/off time. An on time of 0 switches off right away.
+*/
+class RelayOutput {
+public:
+    RelayOutput();
+    RelayOutput(const RelayOutput&) = delete;
+    RelayOutput& operator=(const RelayOutput&) = delete;
+
+    // Configures the pin and starts the timer interrupt
+    void begin(uint8_t pin);
+
+    // Applies mode and minimum on/off time of the settings, the interrupt is masked while the state is reset
+    void configure(const Settings& settings);
+
+    // Publish the on time of the relay within the window. Only the heater pid may call this
+    void publish(unsigned long on_time, unsigned long window);
+
+    // The current relay state as set by the interrupt
+    bool is_active() const;
+
+    // Number of relay switches (on and off) since boot
+    unsigned long get_switch_count() const;
+
+    // Called from the timer interrupt every RELAY_TICK_US
+    void tick();
+
+private:
+    bool next_window(uint16_t on_time, uint16_t window);
+    bool next_pulse(uint16_t on_time, uint16_t window);
+
+    volatile uint32_t slot;
+    volatile bool active;
+    volatile RelayMode mode;
+    volatile uint16_t min_cycles;
+    volatile uint32_t switch_count;
+    uint16_t position;
+    uint16_t held_cycles;
+    int32_t accumulator;
+    uint8_t pin;
+};
+
+RelayOutput& get_relay_output();
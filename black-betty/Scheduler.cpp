@@ -0,0 +1,172 @@
+#include "Scheduler.h"
+
+#include <Arduino.h>
+
+// Wrap around safe compare of two micros timestamps
+static bool is_due(unsigned long deadline, unsigned long now) {
+    return static_cast<long>(now - deadline) >= 0;
+}
+
+Scheduler::Scheduler() : count(0), busy_time(0) {
+    memset(this->tasks, 0, sizeof(this->tasks));
+    memset(this->heap, 0, sizeof(this->heap));
+}
+
+bool Scheduler::add(TaskFunction function, unsigned long interval_ms, uint8_t priority, LoopStage stage) {
+    if (this->count >= SCHEDULER_MAX_TASKS || function == nullptr || interval_ms == 0) {
+        return false;
+    }
+
+    const uint8_t task = static_cast<uint8_t>(this->count);
+    this->tasks[task].function = function;
+    this->tasks[task].interval = interval_ms * 1000;
+    this->tasks[task].deadline = micros();
+    this->tasks[task].priority = priority;
+    this->tasks[task].stage = stage;
+    this->tasks[task].missed = 0;
+    this->tasks[task].max_lateness = 0;
+    this->push(task);
+    return true;
+}
+
+void Scheduler::run() {
+    Status& status = get_status();
+    const unsigned long start = micros();
+    bool executed = false;
+
+    for (;;) {
+        // Pick the most important due task, the heap only needs to be searched as long as the deadlines are due
+        const unsigned long now = micros();
+        const int index = this->find_due(0, now, -1);
+        if (index < 0) {
+            break;
+        }
+
+        ScheduledTask& task = this->tasks[this->remove(index)];
+        const unsigned long lateness = now - task.deadline;
+        if (lateness > task.max_lateness) {
+            task.max_lateness = lateness;
+        }
+
+        task.function();
+        status.record_stage(task.stage, now);
+        executed = true;
+
+        // Keep the phase of the task. Every release that passed while waiting is a missed deadline
+        task.deadline += task.interval;
+        while (is_due(task.deadline, now)) {
+            task.deadline += task.interval;
+            task.missed++;
+        }
+
+        this->push(static_cast<uint8_t>(&task - this->tasks));
+    }
+
+    if (executed) {
+        this->busy_time = status.record_stage(STAGE_LOOP, start) - start;
+    }
+
+    // Sleep until the next deadline. delay() yields to the wifi stack, the sub millisecond rest is busy waited
+    if (this->count > 0) {
+        const long remaining = static_cast<long>(this->tasks[this->heap[0]].deadline - micros());
+        if (remaining > 0) {
+            delay(static_cast<unsigned long>(remaining) / 1000);
+            delayMicroseconds(static_cast<unsigned int>(remaining % 1000));
+        } else {
+            yield();
+        }
+    }
+}
+
+unsigned long Scheduler::get_busy_time() const {
+    return this->busy_time;
+}
+
+unsigned long Scheduler::get_missed(LoopStage stage) const {
+    unsigned long missed = 0;
+    for (int task = 0; task < this->count; task++) {
+        if (this->tasks[task].stage == stage) {
+            missed += this->tasks[task].missed;
+        }
+    }
+
+    return missed;
+}
+
+bool Scheduler::is_before(int left, int right) const {
+    const ScheduledTask& a = this->tasks[this->heap[left]];
+    const ScheduledTask& b = this->tasks[this->heap[right]];
+    const long difference = static_cast<long>(a.deadline - b.deadline);
+    return difference < 0 || (difference == 0 && a.priority < b.priority);
+}
+
+void Scheduler::sift_up(int index) {
+    while (index > 0) {
+        const int parent = (index - 1) / 2;
+        if (!this->is_before(index, parent)) {
+            break;
+        }
+
+        const uint8_t swap = this->heap[index];
+        this->heap[index] = this->heap[parent];
+        this->heap[parent] = swap;
+        index = parent;
+    }
+}
+
+void Scheduler::sift_down(int index) {
+    for (;;) {
+        const int left = index * 2 + 1;
+        const int right = left + 1;
+        int smallest = index;
+        if (left < this->count && this->is_before(left, smallest)) {
+            smallest = left;
+        }
+        if (right < this->count && this->is_before(right, smallest)) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            break;
+        }
+
+        const uint8_t swap = this->heap[index];
+        this->heap[index] = this->heap[smallest];
+        this->heap[smallest] = swap;
+        index = smallest;
+    }
+}
+
+void Scheduler::push(uint8_t task) {
+    this->heap[this->count] = task;
+    this->sift_up(this->count++);
+}
+
+uint8_t Scheduler::remove(int index) {
+    const uint8_t task = this->heap[index];
+    this->heap[index] = this->heap[--this->count];
+    if (index < this->count) {
+        this->sift_down(index);
+        this->sift_up(index);
+    }
+
+    return task;
+}
+
+// The due tasks form a subtree at the root of the heap, search it for the highest priority
+int Scheduler::find_due(int index, unsigned long now, int best) const {
+    if (index >= this->count || !is_due(this->tasks[this->heap[index]].deadline, now)) {
+        return best;
+    }
+
+    if (best < 0 || this->tasks[this->heap[index]].priority < this->tasks[this->heap[best]].priority) {
+        best = index;
+    }
+
+    best = this->find_due(index * 2 + 1, now, best);
+    return this->find_due(index * 2 + 2, now, best);
+}
+
+Scheduler& get_scheduler() {
+    static Scheduler instance;
+    return instance;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Status.h"
+
+// Tasks of the main loop plus headroom for new ones
+constexpr int SCHEDULER_MAX_TASKS = 12;
+
+typedef void (*TaskFunction)();
+
+struct ScheduledTask {
+    TaskFunction function;
+    unsigned long interval;  // micros
+    unsigned long deadline;  // micros, wraps together with micros()
+    uint8_t priority;        // 0 is the most important
+    LoopStage stage;
+    unsigned long missed;    // Number of deadlines that passed without running the task
+    unsigned long max_lateness;
+};
+
+/*
+    Cooperative deadline scheduler replacing the polled timers of the main loop. The tasks are kept in a
+    min-heap ordered by their next deadline. From all due tasks the one with the highest priority runs
+    first, so a slow web request never delays the heater when both are due. Between the tasks the
+    scheduler sleeps exactly until the next deadline instead of a fixed delay.
+*/
+class Scheduler {
+public:
+    Scheduler();
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    // Adds a periodic task, the first run is due immediately. Returns false if there is no free slot
+    bool add(TaskFunction function, unsigned long interval_ms, uint8_t priority, LoopStage stage);
+
+    // Runs all due tasks and sleeps until the next deadline. Call this from loop()
+    void run();
+
+    // Busy time of the last run in micros
+    unsigned long get_busy_time() const;
+    unsigned long get_missed(LoopStage stage) const;
+
+private:
+    ScheduledTask tasks[SCHEDULER_MAX_TASKS];
+    uint8_t heap[SCHEDULER_MAX_TASKS];
+    int count;
+    unsigned long busy_time;
+
+    bool is_before(int left, int right) const;
+    void sift_up(int index);
+    void sift_down(int index);
+    void push(uint8_t task);
+    uint8_t remove(int index);
+    int find_due(int index, unsigned long now, int best) const;
+};
+
+Scheduler& get_scheduler();
@@ -0,0 +1,166 @@
+#include "SensorFilter.h"
+
+#include <math.h>
+#include <Arduino.h>
+
+#include "Settings.h"
+#include "TemperatureSensor.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Median
+MedianFilter::MedianFilter() : size(1), count(0), index(0) {
+}
+
+void MedianFilter::configure(int size) {
+    this->size = size < 1 ? 1 : (size > FILTER_MEDIAN_MAX ? FILTER_MEDIAN_MAX : size);
+    this->reset();
+}
+
+void MedianFilter::reset() {
+    this->count = 0;
+    this->index = 0;
+}
+
+double MedianFilter::next(double value) {
+    if (this->size == 1) {
+        return value;
+    }
+
+    this->ringbuffer[this->index] = value;
+    this->index = (this->index + 1) % this->size;
+    this->count = this->count < this->size ? this->count + 1 : this->size;
+
+    // Insertion sort of at most five values
+    double sorted[FILTER_MEDIAN_MAX];
+    for (int position = 0; position < this->count; position++) {
+        const double current = this->ringbuffer[position];
+        int insert = position;
+        for (; insert > 0 && sorted[insert - 1] > current; insert--) {
+            sorted[insert] = sorted[insert - 1];
+        }
+        sorted[insert] = current;
+    }
+
+    return sorted[this->count / 2];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Low pass
+LowpassFilter::LowpassFilter() : mode(LowpassMode::none), primed(false),
+                                 b0(1.0), b1(0.0), b2(0.0), a1(0.0), a2(0.0),
+                                 x1(0.0), x2(0.0), y1(0.0), y2(0.0) {
+}
+
+void LowpassFilter::configure(LowpassMode mode, double value, double sample_time) {
+    this->mode = mode;
+    this->b0 = 1.0;
+    this->b1 = this->b2 = this->a1 = this->a2 = 0.0;
+
+    if (mode == LowpassMode::ema) {
+        this->b0 = value;
+    } else if (mode == LowpassMode::biquad) {
+        // Bilinear transform of the butterworth low pass (q = 1/sqrt(2))
+        const double k = tan(M_PI * value * sample_time);
+        const double norm = 1.0 / (1.0 + M_SQRT2 * k + k * k);
+        this->b0 = k * k * norm;
+        this->b1 = 2.0 * this->b0;
+        this->b2 = this->b0;
+        this->a1 = 2.0 * (k * k - 1.0) * norm;
+        this->a2 = (1.0 - M_SQRT2 * k + k * k) * norm;
+    }
+
+    this->reset();
+}
+
+void LowpassFilter::reset() {
+    this->primed = false;
+}
+
+double LowpassFilter::next(double value) {
+    if (this->mode == LowpassMode::none) {
+        return value;
+    }
+
+    // Start in the steady state of the first sample
+    if (!this->primed) {
+        this->primed = true;
+        this->x1 = this->x2 = this->y1 = this->y2 = value;
+        return value;
+    }
+
+    if (this->mode == LowpassMode::ema) {
+        this->y1 += this->b0 * (value - this->y1);
+        return this->y1;
+    }
+
+    const double output = this->b0 * value + this->b1 * this->x1 + this->b2 * this->x2 - this->a1 * this->y1 - this->a2 * this->y2;
+    this->x2 = this->x1;
+    this->x1 = value;
+    this->y2 = this->y1;
+    this->y1 = output;
+    return output;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Kalman
+KalmanFilter::KalmanFilter() : q(0.0), r(1.0), primed(false), estimate(0.0), variance(0.0) {
+}
+
+void KalmanFilter::configure(double q, double r) {
+    this->q = q;
+    this->r = r;
+    this->reset();
+}
+
+void KalmanFilter::reset() {
+    this->primed = false;
+}
+
+double KalmanFilter::next(double value) {
+    if (this->q <= 0.0) {
+        return value;
+    }
+
+    if (!this->primed) {
+        this->primed = true;
+        this->estimate = value;
+        this->variance = this->r;
+        return value;
+    }
+
+    // Predict (the temperature drifts by q) and correct with the measurement
+    this->variance += this->q;
+    const double gain = this->variance / (this->variance + this->r);
+    this->estimate += gain * (value - this->estimate);
+    this->variance *= 1.0 - gain;
+    return this->estimate;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Pipeline
+SensorFilter::SensorFilter() {
+}
+
+void SensorFilter::configure(const Settings& settings) {
+    this->median.configure(settings.filter_median);
+    this->lowpass.configure(static_cast<LowpassMode>(settings.filter_lowpass), settings.filter_lowpass_value, SENSOR_CONVERSION_TIME / 1000.0);
+    this->kalman.configure(settings.filter_kalman_q, settings.filter_kalman_r);
+}
+
+void SensorFilter::reset() {
+    this->median.reset();
+    this->lowpass.reset();
+    this->kalman.reset();
+}
+
+double SensorFilter::next(double value) {
+    return this->kalman.next(this->lowpass.next(this->median.next(value)));
+}
+
+const __FlashStringHelper* get_lowpass_mode_name(LowpassMode mode) {
+    switch (mode) {
+        case LowpassMode::ema: return F("ema");
+        case LowpassMode::biquad: return F("biquad");
+        default: return F("none");
+    }
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdint.h>
+
+class Settings;
+class __FlashStringHelper;
+
+// Longest median window, the window is odd so the median is a sample
+constexpr int FILTER_MEDIAN_MAX = 5;
+
+// Limits of the configuration, the biquad cutoff has to stay below the nyquist frequency of the sensor
+constexpr double FILTER_BIQUAD_MIN_CUTOFF = 0.01;
+constexpr double FILTER_BIQUAD_MAX_CUTOFF = 2.0;
+constexpr double FILTER_KALMAN_MAX = 100.0;
+
+enum class LowpassMode : uint8_t {
+    none,
+    ema,
+    biquad
+};
+
+// Median of the last 1, 3 or 5 samples, removes single spikes without smearing them into the following samples
+class MedianFilter {
+public:
+    MedianFilter();
+    MedianFilter(const MedianFilter&) = delete;
+    MedianFilter& operator=(const MedianFilter&) = delete;
+
+    void configure(int size);
+    void reset();
+    double next(double value);
+
+private:
+    double ringbuffer[FILTER_MEDIAN_MAX];
+    int size;
+    int count;
+    int index;
+};
+
+// Exponential moving average (value = smoothing factor 0..1) or second order butterworth (value = cutoff in Hz)
+class LowpassFilter {
+public:
+    LowpassFilter();
+    LowpassFilter(const LowpassFilter&) = delete;
+    LowpassFilter& operator=(const LowpassFilter&) = delete;
+
+    void configure(LowpassMode mode, double value, double sample_time);
+    void reset();
+    double next(double value);
+
+private:
+    LowpassMode mode;
+    bool primed;
+    double b0, b1, b2, a1, a2;
+    double x1, x2, y1, y2;
+};
+
+// Kalman filter for a slowly drifting temperature: q is the variance the temperature drifts per sample, r the
+// variance of the sensor noise. q = 0 disables the filter
+class KalmanFilter {
+public:
+    KalmanFilter();
+    KalmanFilter(const KalmanFilter&) = delete;
+    KalmanFilter& operator=(const KalmanFilter&) = delete;
+
+    void configure(double q, double r);
+    void reset();
+    double next(double value);
+
+private:
+    double q;
+    double r;
+    bool primed;
+    double estimate;
+    double variance;
+};
+
+/*
+    Signal conditioning between the sensor and the pid: median spike rejection, low pass and kalman smoothing, in
+    that order. Every stage is configured from the settings and passes the samples through when it is disabled.
+    The filters start from the first sample after a (re)configuration, so there is no settling from zero.
+*/
+class SensorFilter {
+public:
+    SensorFilter();
+    SensorFilter(const SensorFilter&) = delete;
+    SensorFilter& operator=(const SensorFilter&) = delete;
+
+    void configure(const Settings& settings);
+    void reset();
+    double next(double value);
+
+private:
+    MedianFilter median;
+    LowpassFilter lowpass;
+    KalmanFilter kalman;
+};
+
+const __FlashStringHelper* get_lowpass_mode_name(LowpassMode mode);
@@ -4,11 +4,17 @@
 #include <EEPROM.h>
 
 #include "util.h"
+#include "SettingsJournal.h"
+#include "SettingsMigration.h"
+#include "SensorFilter.h"
+#include "RelayOutput.h"
 
 constexpr int ADDRESS_OFFSET = 32;
 
+static_assert(sizeof(SettingsV1) <= SETTINGS_EEPROM_SIZE, "The version 1 blob has to be readable from the EEPROM");
+
 Settings::Settings() : magic(0xB1ACBE71), // The magic number identifies the settings on the eeprom
-                       version(1),
+                       version(SETTINGS_SCHEMA_VERSION),
                        relay_pin(15),
                        heater_toggle_pin(12),
                        display_clock_pin(0),
@@ -19,7 +25,15 @@ Settings::Settings() : magic(0xB1ACBE71), // The magic number identifies the set
                        heater_ki(2),
                        heater_kd(1),
                        heater_temperature_low(104.0),
-                       heater_temperature_high(135.0)
+                       heater_temperature_high(135.0),
+                       temperature_offset(0.0),
+                       filter_median(1),
+                       filter_lowpass(static_cast<uint8_t>(LowpassMode::none)),
+                       filter_lowpass_value(0.0),
+                       filter_kalman_q(0.0),
+                       filter_kalman_r(0.01),
+                       relay_mode(static_cast<uint8_t>(RelayMode::window)),
+                       relay_min_time(200)
 {
     // Zero all string to ensure they are always the same in every settings instance
     memset(this->device_id, 0, sizeof(this->device_id));
@@ -94,6 +108,76 @@ bool Settings::validate_set_heater_window(int value) {
     return true;
 }
 
+bool Settings::validate_set_temperature_offset(double value) {
+    if (value < -10.0 || value > 10.0) {
+        return false;
+    }
+
+    this->temperature_offset = value;
+    return true;
+}
+
+bool Settings::validate_set_filter_median(int size) {
+    if (size < 1 || size > FILTER_MEDIAN_MAX || size % 2 == 0) {
+        return false;
+    }
+
+    this->filter_median = static_cast<uint8_t>(size);
+    return true;
+}
+
+bool Settings::validate_set_filter_lowpass(uint8_t mode, double value) {
+    switch (static_cast<LowpassMode>(mode)) {
+        case LowpassMode::none:
+            value = 0.0;
+            break;
+        case LowpassMode::ema:
+            if (value <= 0.0 || value > 1.0) {
+                return false;
+            }
+            break;
+        case LowpassMode::biquad:
+            if (value < FILTER_BIQUAD_MIN_CUTOFF || value > FILTER_BIQUAD_MAX_CUTOFF) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+
+    this->filter_lowpass = mode;
+    this->filter_lowpass_value = value;
+    return true;
+}
+
+bool Settings::validate_set_filter_kalman(double q, double r) {
+    if (q < 0.0 || q > FILTER_KALMAN_MAX || r <= 0.0 || r > FILTER_KALMAN_MAX) {
+        return false;
+    }
+
+    this->filter_kalman_q = q;
+    this->filter_kalman_r = r;
+    return true;
+}
+
+bool Settings::validate_set_relay_mode(uint8_t mode) {
+    if (mode > static_cast<uint8_t>(RelayMode::pulse)) {
+        return false;
+    }
+
+    this->relay_mode = mode;
+    return true;
+}
+
+bool Settings::validate_set_relay_min_time(int value) {
+    if (value < 0 || value > static_cast<int>(RELAY_MAX_MIN_TIME)) {
+        return false;
+    }
+
+    this->relay_min_time = static_cast<uint16_t>(value);
+    return true;
+}
+
 bool Settings::is_debug() const {
   return (this->flags & SettingsFlags::FLAG_DEBUG) == SettingsFlags::FLAG_DEBUG;
 }
@@ -108,48 +192,106 @@ void Settings::set_countdown_mode(bool enable) {
   this->flags = (this->flags & ~SettingsFlags::FLAG_COUNTDOWN_MODE) | (enable ? SettingsFlags::FLAG_COUNTDOWN_MODE : 0);
 }
 
+bool Settings::is_warmup() const {
+  return (this->flags & SettingsFlags::FLAG_WARMUP) == SettingsFlags::FLAG_WARMUP;
+}
+void Settings::set_warmup(bool enable) {
+  this->flags = (this->flags & ~SettingsFlags::FLAG_WARMUP) | (enable ? SettingsFlags::FLAG_WARMUP : 0);
+}
+
 void Settings::load()
 {
-    // Load the data from eprom into memory (including offset bytes)
+    // The journal is preferred, the eeprom blob is the format of older firmwares
+    if (get_settings_journal().load(*this)) {
+        Serial.printf("Settings::load Settings version %d loaded from journal\n", this->version);
+        this->upgrade();
+        return;
+    }
+
+    // Load the data from eprom into memory (including offset bytes). Boards without a journal region store field
+    // records there, older firmwares the version 1 blob
     Settings loaded;
-    EEPROM.begin(ADDRESS_OFFSET + sizeof(*this));
-    EEPROM.get<Settings>(ADDRESS_OFFSET, loaded);
+    SettingsV1 blob;
+    EEPROM.begin(ADDRESS_OFFSET + SETTINGS_EEPROM_SIZE);
+    const bool records = read_settings_records(loaded, EEPROM.getConstDataPtr() + ADDRESS_OFFSET, SETTINGS_EEPROM_SIZE);
+    EEPROM.get<SettingsV1>(ADDRESS_OFFSET, blob);
     EEPROM.end();
 
-    if (loaded.magic != this->magic)
+    if (records)
     {
-        Serial.println(F("Settings::load Magic word does not match, using defaults"));
+        Serial.printf("Settings::load Settings version %d loaded from eeprom\n", loaded.version);
+        memcpy(this, &loaded, sizeof(*this));
+        this->upgrade();
         return;
     }
 
-    if (loaded.version > this->version)
+    if (blob.magic != this->magic)
     {
-        Serial.println(F("Settings::load Stored version is higher that current"));
+        Serial.println(F("Settings::load Magic word does not match, using defaults"));
         return;
     }
 
-    if (loaded.version == this->version)
+    if (blob.version == 1)
     {
-        Serial.println(F("Settings::load Settings loaded"));
-        memcpy(this, &loaded, sizeof(*this));
+        Serial.println(F("Settings::load Version 1 settings loaded"));
+        import_settings_v1(*this, blob);
+        this->upgrade();
         return;
     }
 
     Serial.println(F("Settings::load Unable to load settings, using default"));
 }
 
+// Upgrades older settings and stores the result, so the upgrade runs only once
+void Settings::upgrade()
+{
+    if (this->version == SETTINGS_SCHEMA_VERSION) {
+        return;
+    }
+
+    const uint8_t version = this->version;
+    if (!migrate_settings(*this)) {
+        Serial.printf("Settings::upgrade Settings version %d is newer than %d, unknown fields are ignored\n", version, SETTINGS_SCHEMA_VERSION);
+        return;
+    }
+
+    Serial.printf("Settings::upgrade Upgraded settings from version %d to %d\n", version, SETTINGS_SCHEMA_VERSION);
+    this->save();
+}
+
 void Settings::save() const
 {
-    // Not so good because it will write all bytes all the time
-    EEPROM.begin(ADDRESS_OFFSET + sizeof(*this));
-    EEPROM.put<Settings>(ADDRESS_OFFSET, *this);
+    // Queues only the changed fields, they are written by the background task (see SettingsJournal::update)
+    SettingsJournal& journal = get_settings_journal();
+    if (journal.is_available()) {
+        journal.request_save(*this);
+        return;
+    }
+
+    // Not so good because it will write all bytes all the time. The fields are tagged like in the journal, so
+    // newer firmwares can upgrade them
+    EEPROM.begin(ADDRESS_OFFSET + SETTINGS_EEPROM_SIZE);
+    write_settings_records(*this, EEPROM.getDataPtr() + ADDRESS_OFFSET, SETTINGS_EEPROM_SIZE);
     EEPROM.end();
 }
 
+void Settings::flush() const
+{
+    get_settings_journal().flush();
+}
+
 void Settings::clear()
 {
     Settings cleared;
     memcpy(this, &cleared, sizeof(*this));
+
+    // Erase the whole journal, older records still contain the wifi password
+    SettingsJournal& journal = get_settings_journal();
+    if (journal.is_available()) {
+        journal.request_reset(*this);
+        return;
+    }
+
     this->save();
 }
 
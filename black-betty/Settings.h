@@ -2,9 +2,13 @@
 
 #include <stdint.h>
 
+// Version of the stored settings layout, see SettingsMigration.h
+constexpr uint8_t SETTINGS_SCHEMA_VERSION = 4;
+
 enum SettingsFlags {
   FLAG_DEBUG = 0x01, // Device debug mode. This allows CORS requests to the device
-  FLAG_COUNTDOWN_MODE = 0x02 // Puts the device in countdown mode, this showns a counter when pressing the high temperature button instead of changing the setpoint
+  FLAG_COUNTDOWN_MODE = 0x02, // Puts the device in countdown mode, this showns a counter when pressing the high temperature button instead of changing the setpoint
+  FLAG_WARMUP = 0x04 // Heats up by the boiler model before the pid takes over, see WarmupController
 };
 
 /** Class for managing the variables in the project. This also supports serializing/storing/loading */
@@ -12,15 +16,21 @@ class Settings
 {
 public:
     Settings();
-    Settings(const Settings&) = delete;
-    Settings& operator=(const Settings&) = delete;
 
-    // Loads the settings from the EEPROM
+    // Plain values, copied for the rollback of a command batch and by the journal
+    Settings(const Settings&) = default;
+    Settings& operator=(const Settings&) = default;
+
+    // Loads the settings from the journal (or the EEPROM of older firmwares) and upgrades them to the current version
     void load();
 
-    // Saves the settings to the EEPROM
+    // Saves the settings to the flash journal, the write happens in the background. Boards without a journal
+    // region write them to the EEPROM right away
     void save() const;
 
+    // Waits until a pending save is written
+    void flush() const;
+
     // Use to wipe out passwords etc.
     void clear();
 
@@ -30,6 +40,12 @@ public:
     bool validate_set_heater_temperature_high(double value);
     bool validate_set_heater_pid(double kp, double ki, double kd);
     bool validate_set_heater_window(int value);
+    bool validate_set_temperature_offset(double value);
+    bool validate_set_filter_median(int size);
+    bool validate_set_filter_lowpass(uint8_t mode, double value);
+    bool validate_set_filter_kalman(double q, double r);
+    bool validate_set_relay_mode(uint8_t mode);
+    bool validate_set_relay_min_time(int value);
 
     bool is_debug() const;
     void set_debug(bool enable);
@@ -37,6 +53,9 @@ public:
     bool is_countdown_mode() const;
     void set_countdown_mode(bool enable);
 
+    bool is_warmup() const;
+    void set_warmup(bool enable);
+
     uint32_t magic;
     uint16_t heater_window;
     uint8_t version;
@@ -53,6 +72,17 @@ public:
     double heater_kd;
     double heater_temperature_low;
     double heater_temperature_high;
+    double temperature_offset;  // Calibration of the sensor, added to every reading
+    uint8_t filter_median;  // Median window of the sensor filter, 1 disables it
+    uint8_t filter_lowpass;  // LowpassMode of the sensor filter
+    double filter_lowpass_value;  // Smoothing factor of the ema or cutoff (Hz) of the biquad
+    double filter_kalman_q;  // Drift and noise variance of the kalman filter, q = 0 disables it
+    double filter_kalman_r;
+    uint8_t relay_mode;  // RelayMode of the relay output
+    uint16_t relay_min_time;  // Minimum on/off time (ms) of the pulse mode
+
+private:
+    void upgrade();
 };
 
 // Use this function to get the settings, there should be (outside of this class) only one settings instance
@@ -0,0 +1,372 @@
+#include "SettingsJournal.h"
+
+#include <Arduino.h>
+#include <flash_hal.h>
+
+#include "util.h"
+
+// Sector header: magic and sequence
+constexpr uint32_t HEADER_SIZE = 8;
+
+struct SettingsFieldDescriptor {
+    uint8_t tag;
+    uint8_t size;
+    uint16_t offset;
+};
+
+#define SETTINGS_FIELD(tag, field) { tag, sizeof(Settings::field), offsetof(Settings, field) }
+
+static constexpr SettingsFieldDescriptor FIELDS[] = {
+    SETTINGS_FIELD(FIELD_SCHEMA_VERSION, version),
+    SETTINGS_FIELD(FIELD_HEATER_WINDOW, heater_window),
+    SETTINGS_FIELD(FIELD_RELAY_PIN, relay_pin),
+    SETTINGS_FIELD(FIELD_HEATER_TOGGLE_PIN, heater_toggle_pin),
+    SETTINGS_FIELD(FIELD_DISPLAY_CLOCK_PIN, display_clock_pin),
+    SETTINGS_FIELD(FIELD_DISPLAY_DIO_PIN, display_dio_pin),
+    SETTINGS_FIELD(FIELD_FLAGS, flags),
+    SETTINGS_FIELD(FIELD_DEVICE_ID, device_id),
+    SETTINGS_FIELD(FIELD_WIFI_SSID, wifi_ssid),
+    SETTINGS_FIELD(FIELD_WIFI_PASSWORD, wifi_password),
+    SETTINGS_FIELD(FIELD_HEATER_KP, heater_kp),
+    SETTINGS_FIELD(FIELD_HEATER_KI, heater_ki),
+    SETTINGS_FIELD(FIELD_HEATER_KD, heater_kd),
+    SETTINGS_FIELD(FIELD_HEATER_TEMPERATURE_LOW, heater_temperature_low),
+    SETTINGS_FIELD(FIELD_HEATER_TEMPERATURE_HIGH, heater_temperature_high),
+    SETTINGS_FIELD(FIELD_TEMPERATURE_OFFSET, temperature_offset),
+    SETTINGS_FIELD(FIELD_FILTER_MEDIAN, filter_median),
+    SETTINGS_FIELD(FIELD_FILTER_LOWPASS, filter_lowpass),
+    SETTINGS_FIELD(FIELD_FILTER_LOWPASS_VALUE, filter_lowpass_value),
+    SETTINGS_FIELD(FIELD_FILTER_KALMAN_Q, filter_kalman_q),
+    SETTINGS_FIELD(FIELD_FILTER_KALMAN_R, filter_kalman_r),
+    SETTINGS_FIELD(FIELD_RELAY_MODE, relay_mode),
+    SETTINGS_FIELD(FIELD_RELAY_MIN_TIME, relay_min_time),
+};
+
+static const SettingsFieldDescriptor* find_field(uint8_t tag) {
+    for (const SettingsFieldDescriptor& field : FIELDS) {
+        if (field.tag == tag) {
+            return &field;
+        }
+    }
+
+    return nullptr;
+}
+
+static constexpr uint32_t get_padded_size(size_t size) {
+    return static_cast<uint32_t>((size + 3) & ~static_cast<size_t>(3));
+}
+
+// Size of a snapshot, a record of every field
+static constexpr uint32_t get_snapshot_size(size_t index = 0) {
+    return index == array_size(FIELDS) ? 0 : 4 + get_padded_size(FIELDS[index].size) + get_snapshot_size(index + 1);
+}
+
+static_assert(4 + get_snapshot_size() <= SETTINGS_EEPROM_SIZE, "The settings records do not fit into the EEPROM");
+
+static uint16_t get_record_crc(uint8_t tag, const uint8_t* value, size_t size) {
+    const uint8_t header[2] = { tag, static_cast<uint8_t>(size) };
+    return crc16(value, size, crc16(header, 2));
+}
+
+SettingsJournal::SettingsJournal() :
+        sector(-1),
+        sequence(0),
+        position(0),
+        state(JOURNAL_IDLE),
+        step(0),
+        state_start(0),
+        save_count(0) {
+    memset(this->persisted, 0, sizeof(this->persisted));
+    memset(this->pending, 0, sizeof(this->pending));
+}
+
+bool SettingsJournal::is_available() const {
+    return FS_PHYS_SIZE >= SETTINGS_JOURNAL_SECTORS * SETTINGS_JOURNAL_SECTOR_SIZE;
+}
+
+bool SettingsJournal::load(Settings& settings) {
+    if (!this->is_available()) {
+        return false;
+    }
+
+    // Find the valid sector with the highest sequence
+    this->sector = -1;
+    for (int sector = 0; sector < SETTINGS_JOURNAL_SECTORS; sector++) {
+        uint32_t header[2];
+        if (!ESP.flashRead(this->get_address(sector, 0), header, sizeof(header)) || header[0] != SETTINGS_JOURNAL_MAGIC) {
+            continue;
+        }
+
+        if (this->sector < 0 || header[1] > this->sequence) {
+            this->sector = sector;
+            this->sequence = header[1];
+        }
+    }
+
+    if (this->sector < 0) {
+        return false;
+    }
+
+    // Replay snapshot and changes on top of the defaults, journals without a version record are version 1
+    Settings loaded;
+    loaded.version = 1;
+    uint8_t* data = reinterpret_cast<uint8_t*>(&loaded);
+    uint32_t value[SETTINGS_JOURNAL_MAX_FIELD_SIZE / 4];
+    uint8_t tag;
+    size_t size;
+
+    this->position = HEADER_SIZE;
+    while (this->read_record(this->position, tag, value, size)) {
+        // Unknown tags are skipped, they were written by a newer firmware
+        const SettingsFieldDescriptor* field = find_field(tag);
+        if (field != nullptr && field->size == size) {
+            memcpy(data + field->offset, value, size);
+        }
+
+        this->position += 4 + get_padded_size(size);
+    }
+
+    // Partially written bits can not be overwritten, a broken record forces a new sector on the next save
+    if (this->position < SETTINGS_JOURNAL_SECTOR_SIZE) {
+        uint32_t header;
+        ESP.flashRead(this->get_address(this->sector, this->position), &header, sizeof(header));
+        if (header != UINT32_MAX) {
+            this->position = SETTINGS_JOURNAL_SECTOR_SIZE;
+        }
+    }
+
+    settings = loaded;
+    memcpy(this->persisted, &loaded, sizeof(this->persisted));
+    return true;
+}
+
+void SettingsJournal::request_save(const Settings& settings) {
+    if (!this->is_available()) {
+        return;
+    }
+
+    memcpy(this->pending, &settings, sizeof(this->pending));
+    if (this->state == JOURNAL_IDLE) {
+        this->set_state(this->sector < 0 ? JOURNAL_ERASE : JOURNAL_APPEND);
+    }
+}
+
+void SettingsJournal::request_reset(const Settings& settings) {
+    if (!this->is_available()) {
+        return;
+    }
+
+    memcpy(this->pending, &settings, sizeof(this->pending));
+    this->set_state(JOURNAL_ERASE_ALL);
+}
+
+bool SettingsJournal::update(bool allow_erase) {
+    const uint32_t first = FS_PHYS_ADDR / SETTINGS_JOURNAL_SECTOR_SIZE;
+
+    switch (this->state) {
+        case JOURNAL_IDLE:
+            return false;
+
+        case JOURNAL_ERASE_ALL:
+            if (this->is_erase_allowed(allow_erase)) {
+                ESP.flashEraseSector(first + this->step);
+                if (++this->step == SETTINGS_JOURNAL_SECTORS) {
+                    this->sector = -1;
+                    this->sequence = 0;
+                    this->set_state(JOURNAL_ERASE);
+                }
+            }
+            return true;
+
+        case JOURNAL_ERASE:
+            if (this->is_erase_allowed(allow_erase)) {
+                // The sequence is only increased once the new sector is complete, see finish_snapshot
+                this->sector = this->sector < 0 ? 0 : (this->sector + 1) % SETTINGS_JOURNAL_SECTORS;
+                this->position = HEADER_SIZE;
+                ESP.flashEraseSector(first + this->sector);
+                this->set_state(JOURNAL_SNAPSHOT);
+            }
+            return true;
+
+        case JOURNAL_SNAPSHOT: {
+            // The persisted image follows the written fields, settings changed meanwhile are appended afterwards
+            const SettingsFieldDescriptor& field = FIELDS[this->step];
+            this->append(field.tag, this->pending + field.offset, field.size);
+            memcpy(this->persisted + field.offset, this->pending + field.offset, field.size);
+            if (++this->step == static_cast<int>(array_size(FIELDS))) {
+                this->finish_snapshot();
+                this->set_state(JOURNAL_APPEND);
+            }
+            return true;
+        }
+
+        case JOURNAL_APPEND: {
+            // Collect the size of all changed fields, a full sector starts the next one with a snapshot
+            uint32_t size = 0;
+            for (const SettingsFieldDescriptor& field : FIELDS) {
+                if (memcmp(this->pending + field.offset, this->persisted + field.offset, field.size) != 0) {
+                    size += 4 + get_padded_size(field.size);
+                }
+            }
+
+            if (size == 0) {
+                this->save_count++;
+                this->set_state(JOURNAL_IDLE);
+                return false;
+            }
+
+            if (this->position + size > SETTINGS_JOURNAL_SECTOR_SIZE) {
+                this->set_state(JOURNAL_ERASE);
+                return true;
+            }
+
+            // Writing a few records takes only micro seconds
+            for (const SettingsFieldDescriptor& field : FIELDS) {
+                if (memcmp(this->pending + field.offset, this->persisted + field.offset, field.size) != 0) {
+                    this->append(field.tag, this->pending + field.offset, field.size);
+                    memcpy(this->persisted + field.offset, this->pending + field.offset, field.size);
+                }
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SettingsJournal::flush() {
+    while (this->update(true)) {
+        yield();
+    }
+}
+
+bool SettingsJournal::is_pending() const {
+    return this->state != JOURNAL_IDLE;
+}
+
+unsigned long SettingsJournal::get_save_count() const {
+    return this->save_count;
+}
+
+bool SettingsJournal::is_erase_allowed(bool allow_erase) const {
+    return allow_erase || millis() - this->state_start >= SETTINGS_JOURNAL_ERASE_MAX_WAIT;
+}
+
+void SettingsJournal::set_state(JournalState state) {
+    this->state = state;
+    this->step = 0;
+    this->state_start = millis();
+}
+
+// The sequence goes first, the magic validates the sector
+void SettingsJournal::finish_snapshot() {
+    const uint32_t sequence = this->sequence + 1;
+    const uint32_t header[2] = { SETTINGS_JOURNAL_MAGIC, sequence };
+    ESP.flashWrite(this->get_address(this->sector, 4), header + 1, 4);
+    ESP.flashWrite(this->get_address(this->sector, 0), header, 4);
+    this->sequence = sequence;
+}
+
+bool SettingsJournal::append(uint8_t tag, const uint8_t* value, size_t size) {
+    uint32_t record[1 + SETTINGS_JOURNAL_MAX_FIELD_SIZE / 4];
+    const uint32_t padded_size = get_padded_size(size);
+    if (size > SETTINGS_JOURNAL_MAX_FIELD_SIZE || this->position + 4 + padded_size > SETTINGS_JOURNAL_SECTOR_SIZE) {
+        return false;
+    }
+
+    memset(record, 0, sizeof(record));
+    record[0] = static_cast<uint32_t>(tag) | (static_cast<uint32_t>(size) << 8) | (static_cast<uint32_t>(get_record_crc(tag, value, size)) << 16);
+    memcpy(record + 1, value, size);
+    if (!ESP.flashWrite(this->get_address(this->sector, this->position), record, 4 + padded_size)) {
+        return false;
+    }
+
+    this->position += 4 + padded_size;
+    return true;
+}
+
+bool SettingsJournal::read_record(uint32_t offset, uint8_t& tag, uint32_t* value, size_t& size) const {
+    uint32_t header;
+    if (offset + 4 > SETTINGS_JOURNAL_SECTOR_SIZE || !ESP.flashRead(this->get_address(this->sector, offset), &header, sizeof(header))) {
+        return false;
+    }
+
+    tag = static_cast<uint8_t>(header);
+    size = static_cast<uint8_t>(header >> 8);
+    if (tag == FIELD_ERASED || size > SETTINGS_JOURNAL_MAX_FIELD_SIZE || offset + 4 + get_padded_size(size) > SETTINGS_JOURNAL_SECTOR_SIZE) {
+        return false;
+    }
+
+    if (size > 0 && !ESP.flashRead(this->get_address(this->sector, offset + 4), value, get_padded_size(size))) {
+        return false;
+    }
+
+    return static_cast<uint16_t>(header >> 16) == get_record_crc(tag, reinterpret_cast<const uint8_t*>(value), size);
+}
+
+uint32_t SettingsJournal::get_address(int sector, uint32_t offset) const {
+    return FS_PHYS_ADDR + static_cast<uint32_t>(sector) * SETTINGS_JOURNAL_SECTOR_SIZE + offset;
+}
+
+bool write_settings_records(const Settings& settings, uint8_t* buffer, size_t size) {
+    if (4 + get_snapshot_size() > size) {
+        return false;
+    }
+
+    memset(buffer, FIELD_ERASED, size);
+    memcpy(buffer, &SETTINGS_EEPROM_MAGIC, 4);
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(&settings);
+    uint8_t* pos = buffer + 4;
+    for (const SettingsFieldDescriptor& field : FIELDS) {
+        const uint32_t header = static_cast<uint32_t>(field.tag) | (static_cast<uint32_t>(field.size) << 8) |
+            (static_cast<uint32_t>(get_record_crc(field.tag, data + field.offset, field.size)) << 16);
+        memcpy(pos, &header, 4);
+        memset(pos + 4, 0, get_padded_size(field.size));
+        memcpy(pos + 4, data + field.offset, field.size);
+        pos += 4 + get_padded_size(field.size);
+    }
+
+    return true;
+}
+
+bool read_settings_records(Settings& settings, const uint8_t* buffer, size_t size) {
+    uint32_t magic = 0;
+    if (size >= 4) {
+        memcpy(&magic, buffer, 4);
+    }
+
+    if (magic != SETTINGS_EEPROM_MAGIC) {
+        return false;
+    }
+
+    // Like the journal: records without a version record are version 1, unknown tags are skipped and the replay
+    // stops at the first erased or broken record
+    Settings loaded;
+    loaded.version = 1;
+    uint8_t* data = reinterpret_cast<uint8_t*>(&loaded);
+    for (size_t offset = 4; offset + 4 <= size; ) {
+        uint32_t header;
+        memcpy(&header, buffer + offset, 4);
+        const uint8_t tag = static_cast<uint8_t>(header);
+        const size_t record_size = static_cast<uint8_t>(header >> 8);
+        if (tag == FIELD_ERASED || offset + 4 + get_padded_size(record_size) > size ||
+                static_cast<uint16_t>(header >> 16) != get_record_crc(tag, buffer + offset + 4, record_size)) {
+            break;
+        }
+
+        const SettingsFieldDescriptor* field = find_field(tag);
+        if (field != nullptr && field->size == record_size) {
+            memcpy(data + field->offset, buffer + offset + 4, record_size);
+        }
+
+        offset += 4 + get_padded_size(record_size);
+    }
+
+    settings = loaded;
+    return true;
+}
+
+SettingsJournal& get_settings_journal() {
+    static SettingsJournal instance;
+    return instance;
+}
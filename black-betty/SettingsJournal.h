@@ -0,0 +1,127 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "Settings.h"
+
+// The journal uses the first sectors of the flash file system region (flash_hal.h), the project has no file system
+constexpr int SETTINGS_JOURNAL_SECTORS = 4;
+constexpr uint32_t SETTINGS_JOURNAL_SECTOR_SIZE = 4096;
+constexpr uint32_t SETTINGS_JOURNAL_MAGIC = 0xB1AC10C0;
+constexpr size_t SETTINGS_JOURNAL_MAX_FIELD_SIZE = 32;
+
+// Boards without a journal region keep the same records in the EEPROM, behind their own magic
+constexpr uint32_t SETTINGS_EEPROM_MAGIC = 0xB1AC1EE0;
+constexpr size_t SETTINGS_EEPROM_SIZE = 512;
+
+// A sector erase stalls the cpu for tens of milliseconds, it waits at most this long (ms) for the relay to be off
+constexpr unsigned long SETTINGS_JOURNAL_ERASE_MAX_WAIT = 10000;
+
+// Tags of the journal records, the values are stored on flash and must never change
+enum SettingsField : uint8_t {
+    FIELD_HEATER_WINDOW = 1,
+    FIELD_RELAY_PIN = 2,
+    FIELD_HEATER_TOGGLE_PIN = 3,
+    FIELD_DISPLAY_CLOCK_PIN = 4,
+    FIELD_DISPLAY_DIO_PIN = 5,
+    FIELD_FLAGS = 6,
+    FIELD_DEVICE_ID = 7,
+    FIELD_WIFI_SSID = 8,
+    FIELD_WIFI_PASSWORD = 9,
+    FIELD_HEATER_KP = 10,
+    FIELD_HEATER_KI = 11,
+    FIELD_HEATER_KD = 12,
+    FIELD_HEATER_TEMPERATURE_LOW = 13,
+    FIELD_HEATER_TEMPERATURE_HIGH = 14,
+    FIELD_SCHEMA_VERSION = 15,
+    FIELD_TEMPERATURE_OFFSET = 16,
+    FIELD_FILTER_MEDIAN = 17,
+    FIELD_FILTER_LOWPASS = 18,
+    FIELD_FILTER_LOWPASS_VALUE = 19,
+    FIELD_FILTER_KALMAN_Q = 20,
+    FIELD_FILTER_KALMAN_R = 21,
+    FIELD_RELAY_MODE = 22,
+    FIELD_RELAY_MIN_TIME = 23,
+    FIELD_ERASED = 0xFF
+};
+
+enum JournalState {
+    JOURNAL_IDLE,
+    JOURNAL_ERASE_ALL,  // Erasing all sectors for a reset
+    JOURNAL_ERASE,      // Erasing the next sector
+    JOURNAL_SNAPSHOT,   // Writing the snapshot into the new sector, one field per step
+    JOURNAL_APPEND      // Appending the changed fields
+};
+
+/*
+    Log structured settings storage with wear leveling. Every sector starts with a snapshot of all fields, a save
+    appends only the changed fields as CRC protected records (4 byte header: tag, length, crc16 followed by the
+    4 byte padded value). When the active sector is full the next one is erased and starts with a new snapshot,
+    so only every few hundred saves cost a sector erase and the erases rotate over all sectors.
+
+    The sector header (magic, sequence) is written after the snapshot, so a sector only becomes valid once its
+    snapshot is complete. Loading replays the valid sector with the highest sequence and stops at the first
+    erased or broken record, a torn write loses only the last save.
+
+    Saving is asynchronous: request_save copies the settings into a shadow copy and update() writes it in small
+    steps from a low priority task. A step is either one sector erase or a few record writes, the erase waits
+    until the caller allows it (relay off) so the heater is not stalled while it heats.
+*/
+class SettingsJournal {
+public:
+    SettingsJournal();
+    SettingsJournal(const SettingsJournal&) = delete;
+    SettingsJournal& operator=(const SettingsJournal&) = delete;
+
+    // Is the flash region large enough for the journal?
+    bool is_available() const;
+
+    // Replays the newest sector into the settings, returns false if there is no valid sector
+    bool load(Settings& settings);
+
+    // Queues the settings, only the fields that changed since the last load/save are written
+    void request_save(const Settings& settings);
+
+    // Queues an erase of all sectors followed by a snapshot, old values (e.g. passwords) are gone afterwards
+    void request_reset(const Settings& settings);
+
+    // Runs the next step, a sector is only erased if allowed or after waiting too long. Returns true while busy
+    bool update(bool allow_erase);
+
+    // Runs all pending steps at once (e.g. before a restart)
+    void flush();
+
+    bool is_pending() const;
+    unsigned long get_save_count() const;
+
+private:
+    bool is_erase_allowed(bool allow_erase) const;
+    void set_state(JournalState state);
+    void finish_snapshot();
+    bool append(uint8_t tag, const uint8_t* value, size_t size);
+    bool read_record(uint32_t offset, uint8_t& tag, uint32_t* value, size_t& size) const;
+    uint32_t get_address(int sector, uint32_t offset) const;
+
+    int sector;         // Active sector, -1 if there is none
+    uint32_t sequence;  // Sequence of the active sector
+    uint32_t position;  // Next free offset in the active sector
+
+    JournalState state;
+    int step;                    // Sector (erase all) or field (snapshot) of the current state
+    unsigned long state_start;   // millis() when the state was entered
+    unsigned long save_count;    // Completed saves since boot
+
+    // Image of the fields stored on flash to find the changed fields and the shadow copy to be stored
+    uint8_t persisted[sizeof(Settings)];
+    uint8_t pending[sizeof(Settings)];
+};
+
+// Writes the magic and a record of every field (the records of a journal snapshot) to the buffer, the rest of the
+// buffer is marked as erased. Returns false if the buffer is too small
+bool write_settings_records(const Settings& settings, uint8_t* buffer, size_t size);
+
+// Replays the records of the buffer on top of the settings, returns false if it has no valid magic
+bool read_settings_records(Settings& settings, const uint8_t* buffer, size_t size);
+
+SettingsJournal& get_settings_journal();
@@ -0,0 +1,73 @@
+#include "SettingsMigration.h"
+
+#include <Arduino.h>
+
+#include "util.h"
+#include "SensorFilter.h"
+#include "RelayOutput.h"
+
+typedef void (*SettingsUpgrade)(Settings& settings);
+
+// Version 2 added the temperature offset
+static void upgrade_1_to_2(Settings& settings) {
+    settings.temperature_offset = 0.0;
+}
+
+// Version 3 added the sensor filter, older devices start with all stages disabled
+static void upgrade_2_to_3(Settings& settings) {
+    settings.filter_median = 1;
+    settings.filter_lowpass = static_cast<uint8_t>(LowpassMode::none);
+    settings.filter_lowpass_value = 0.0;
+    settings.filter_kalman_q = 0.0;
+    settings.filter_kalman_r = 0.01;
+}
+
+// Version 4 added the relay mode, older devices keep the window mode
+static void upgrade_3_to_4(Settings& settings) {
+    settings.relay_mode = static_cast<uint8_t>(RelayMode::window);
+    settings.relay_min_time = 200;
+}
+
+// UPGRADES[n] upgrades version n + 1 to n + 2, every step runs once so the load time does not depend on the data
+static const SettingsUpgrade UPGRADES[] = {
+    upgrade_1_to_2,
+    upgrade_2_to_3,
+    upgrade_3_to_4,
+};
+
+static_assert(array_size(UPGRADES) == SETTINGS_SCHEMA_VERSION - 1, "Every schema version needs an upgrade function");
+
+void import_settings_v1(Settings& settings, const SettingsV1& blob) {
+    settings.heater_window = blob.heater_window;
+    settings.version = 1;
+    settings.relay_pin = blob.relay_pin;
+    settings.heater_toggle_pin = blob.heater_toggle_pin;
+    settings.display_clock_pin = blob.display_clock_pin;
+    settings.display_dio_pin = blob.display_dio_pin;
+    settings.flags = blob.flags;
+    memcpy(settings.device_id, blob.device_id, sizeof(settings.device_id));
+    memcpy(settings.wifi_ssid, blob.wifi_ssid, sizeof(settings.wifi_ssid));
+    memcpy(settings.wifi_password, blob.wifi_password, sizeof(settings.wifi_password));
+    settings.heater_kp = blob.heater_kp;
+    settings.heater_ki = blob.heater_ki;
+    settings.heater_kd = blob.heater_kd;
+    settings.heater_temperature_low = blob.heater_temperature_low;
+    settings.heater_temperature_high = blob.heater_temperature_high;
+
+    // Never trust the strings to be terminated
+    settings.device_id[sizeof(settings.device_id) - 1] = 0x00;
+    settings.wifi_ssid[sizeof(settings.wifi_ssid) - 1] = 0x00;
+    settings.wifi_password[sizeof(settings.wifi_password) - 1] = 0x00;
+}
+
+bool migrate_settings(Settings& settings) {
+    if (settings.version == 0 || settings.version > SETTINGS_SCHEMA_VERSION) {
+        return false;
+    }
+
+    for (; settings.version < SETTINGS_SCHEMA_VERSION; settings.version++) {
+        UPGRADES[settings.version - 1](settings);
+    }
+
+    return true;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Settings.h"
+
+/*
+    Upgrades of stored settings. Version 1 is the EEPROM blob of the first firmwares and journals without a
+    schema version record, version 2 added the temperature offset, version 3 the sensor filter and version 4
+    the relay mode. A change of the layout gets a new version, a new journal tag (SettingsJournal.h) and an
+    upgrade function in SettingsMigration.cpp, fields keep their tag forever so older data can always be
+    replayed.
+*/
+
+// Frozen layout of the version 1 EEPROM blob, never change it
+struct SettingsV1 {
+    uint32_t magic;
+    uint16_t heater_window;
+    uint8_t version;
+    uint8_t relay_pin;
+    uint8_t heater_toggle_pin;
+    uint8_t display_clock_pin;
+    uint8_t display_dio_pin;
+    uint8_t flags;
+    char device_id[16];
+    char wifi_ssid[32];
+    char wifi_password[32];
+    double heater_kp;
+    double heater_ki;
+    double heater_kd;
+    double heater_temperature_low;
+    double heater_temperature_high;
+};
+
+// Copies the fields of a version 1 blob, the result still has to be migrated
+void import_settings_v1(Settings& settings, const SettingsV1& blob);
+
+// Upgrades the settings from their version to SETTINGS_SCHEMA_VERSION. Settings of a newer firmware are kept as
+// they are (the known tags are still valid) and false is returned
+bool migrate_settings(Settings& settings);
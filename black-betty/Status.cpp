@@ -5,58 +5,131 @@
 #include "HeaterPID.h"
 
 ///////////////////////////////////////////////////////////////////////////////
-// Simple Timer
-SimpleTimer::SimpleTimer(unsigned long window) : window(window), nextTick(0) {
+// Latency Histogram
+LatencyHistogram::LatencyHistogram() {
+    this->reset();
 }
 
-bool SimpleTimer::next() {
-    unsigned long now = millis();
-    if (now < this->nextTick) {
-        return false;
+void LatencyHistogram::add(unsigned long duration) {
+    int bucket = 0;
+    for (unsigned long limit = LATENCY_FIRST_BUCKET; bucket < LATENCY_BUCKETS - 1 && duration >= limit; limit <<= 1) {
+        bucket++;
     }
 
-    if (this->nextTick == 0) {
-        this->nextTick = now + this->window;
-        return true;
+    this->buckets[bucket]++;
+    this->count++;
+    if (duration > this->max) {
+        this->max = duration;
     }
+}
 
-    do {
-        this->nextTick += this->window;
-    } while (now >= this->nextTick);
+void LatencyHistogram::reset() {
+    this->count = 0;
+    this->max = 0;
+    memset(this->buckets, 0, sizeof(this->buckets));
+}
 
-    return true;
+unsigned long LatencyHistogram::get_bucket_limit(int index) {
+    return LATENCY_FIRST_BUCKET << index;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// Stat Counter
-StatCounter::StatCounter() : current(0.0), min(1.0), max(-1.0), sum(0.0) {
+// StatusHistory
+StatusHistoryItem::StatusHistoryItem() : sequence(0), samples(0) {
 }
 
-bool StatCounter::is_empty() const {
-    return this->min == 1.0 && this->max == -1.0;
+///////////////////////////////////////////////////////////////////////////////
+// Compact history
+static int16_t to_compact(double value, double scale) {
+    const double scaled = value * scale;
+    return static_cast<int16_t>(scaled < -32768.0 ? -32768.0 : (scaled > 32767.0 ? 32767.0 : scaled));
 }
 
-void StatCounter::next(double value) {
-    this->current = value;
-    if (this->is_empty()) {
-        this->min = value;
-        this->max = value;
-        this->sum = value;
-    } else {
-        if (value < min) { this->min = value; }
-        if (value > max) { this->max = value; }
-        this->sum += value;
+void CompactCounter::set(const MilliCounter& counter, int samples, double scale) {
+    if (samples <= 0 || counter.is_empty()) {
+        this->min = this->max = this->average = 0;
+        return;
     }
+
+    // The scales are given for whole units
+    scale /= 1000.0;
+    this->min = to_compact(static_cast<double>(counter.min), scale);
+    this->max = to_compact(static_cast<double>(counter.max), scale);
+    this->average = to_compact(static_cast<double>(counter.sum) / static_cast<double>(samples), scale);
 }
 
-void StatCounter::reset() {
-    this->min = 1.0;
-    this->max = -1.0;
+void CompactCounter::merge(const CompactCounter& other, uint16_t samples, uint16_t other_samples) {
+    if (other_samples == 0) {
+        return;
+    }
+
+    if (samples == 0) {
+        *this = other;
+        return;
+    }
+
+    if (other.min < this->min) { this->min = other.min; }
+    if (other.max > this->max) { this->max = other.max; }
+    const int32_t total = static_cast<int32_t>(samples) + static_cast<int32_t>(other_samples);
+    this->average = static_cast<int16_t>((static_cast<int32_t>(this->average) * samples + static_cast<int32_t>(other.average) * other_samples) / total);
 }
 
-///////////////////////////////////////////////////////////////////////////////
-// StatusHistory
-StatusHistoryItem::StatusHistoryItem() : samples(0) {
+void CompactHistoryItem::set(const StatusHistoryItem& item) {
+    this->samples = static_cast<uint16_t>(item.samples);
+    this->temperature.set(item.temperature, item.samples, COMPACT_SCALE_TEMPERATURE);
+    this->output.set(item.output, item.samples, COMPACT_SCALE_OUTPUT);
+    this->heater.set(item.heater, item.samples, COMPACT_SCALE_HEATER);
+    this->health.set(item.health, item.samples, COMPACT_SCALE_HEALTH);
+}
+
+void CompactHistoryItem::clear() {
+    memset(this, 0, sizeof(*this));
+}
+
+void CompactHistoryItem::merge(const CompactHistoryItem& other) {
+    this->temperature.merge(other.temperature, this->samples, other.samples);
+    this->output.merge(other.output, this->samples, other.samples);
+    this->heater.merge(other.heater, this->samples, other.samples);
+    this->health.merge(other.health, this->samples, other.samples);
+
+    const uint32_t samples = static_cast<uint32_t>(this->samples) + other.samples;
+    this->samples = static_cast<uint16_t>(samples > UINT16_MAX ? UINT16_MAX : samples);
+}
+
+HistoryTier::HistoryTier() : index(0), sequence(0), merged(0) {
+    memset(this->ringbuffer, 0, sizeof(this->ringbuffer));
+}
+
+bool HistoryTier::add(const CompactHistoryItem& item, int factor) {
+    this->ringbuffer[this->index].merge(item);
+    if (++this->merged < factor) {
+        return false;
+    }
+
+    this->merged = 0;
+    this->index = (this->index + 1) % HISTORY_TIER_SIZE;
+    this->ringbuffer[this->index].clear();
+    this->sequence++;
+    return true;
+}
+
+const CompactHistoryItem& HistoryTier::get(int index) const {
+    return this->ringbuffer[(HISTORY_TIER_SIZE + this->index - index) % HISTORY_TIER_SIZE];
+}
+
+int HistoryTier::get_sequence(int index) const {
+    return this->sequence - index;
+}
+
+int HistoryTier::get_count(int since) const {
+    // Only slots that were opened since boot are reported
+    const int available = this->sequence < HISTORY_TIER_SIZE ? this->sequence + 1 : HISTORY_TIER_SIZE;
+    if (since > this->sequence || since < 0) {
+        return available;
+    }
+
+    const int count = this->sequence - since + 1;
+    return count < available ? count : available;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -66,16 +139,11 @@ Status::Status() :
         heater_mode(HeaterMode::off),
         countdown_start(0),
         is_heater_toggle_active(false),
+        relay_switches(0),
         display_temperature(0),
         display_heater_active(false),
         history_index(0),
-        history_next_slot(millis() + HISTORY_SLOT_TIME),
- 
-        console_timer(15),
-        heater_timer(25),
-        webserver_timer(50),
-        display_timer(30),
-        alive_timer(10000) {
+        history_next_slot(millis() + HISTORY_SLOT_TIME) {
 }
 
 int Status::next_sequence = 0;
@@ -94,6 +162,19 @@ const StatusHistoryItem& Status::get_history(int index) const {
     return this->history_ringbuffer[(HISTORY_SIZE + this->history_index - index) % HISTORY_SIZE];
 }
 
+int Status::get_history_count(int since) const {
+    if (since > this->get_history(0).sequence) {
+        return HISTORY_SIZE;
+    }
+
+    int count = 1;
+    while (count < HISTORY_SIZE && this->get_history(count).sequence >= since) {
+        count++;
+    }
+
+    return count;
+}
+
 void Status::update_history(double temperature, double output, bool heater, unsigned long healthtime) {
     unsigned long now = millis();
 
@@ -105,6 +186,14 @@ void Status::update_history(double temperature, double output, bool heater, unsi
     // Calculate the current index of the ringbuffer and reset the data if it changes
     while (this->history_next_slot < now) {
       this->history_next_slot += HISTORY_SLOT_TIME;
+
+        // Roll the closed slot up into the coarse tiers, a tier passes its slot on when it is complete
+        CompactHistoryItem compact;
+        compact.set(this->history_ringbuffer[this->history_index]);
+        for (int tier = 0; tier < HISTORY_TIER_COUNT && this->history_tiers[tier].add(compact, HISTORY_TIER_FACTOR[tier]); tier++) {
+            compact = this->history_tiers[tier].get(1);
+        }
+
         this->history_index = (this->history_index + 1) % HISTORY_SIZE;
         StatusHistoryItem& item = this->history_ringbuffer[this->history_index];
         item.temperature.reset();
@@ -116,13 +205,26 @@ void Status::update_history(double temperature, double output, bool heater, unsi
     }
 
     StatusHistoryItem& item = this->history_ringbuffer[this->history_index];
-    item.temperature.next(temperature);
-    item.output.next(output);
-    item.heater.next(heater ? 1.0 : 0.0);
-    item.health.next(static_cast<double>(healthtime));
+    item.temperature.next(to_milli(temperature));
+    item.output.next(to_milli(output));
+    item.heater.next(heater ? 1000 : 0);
+    item.health.next(static_cast<int32_t>(healthtime) * 1000);
     item.samples++;
 }
 
+const HistoryTier& Status::get_history_tier(int tier) const {
+    return this->history_tiers[tier];
+}
+
+int Status::get_history_tier_slot_time(int tier) {
+    int slot_time = HISTORY_SLOT_TIME;
+    for (int index = 0; index <= tier; index++) {
+        slot_time *= HISTORY_TIER_FACTOR[index];
+    }
+
+    return slot_time;
+}
+
 int Status::update_countdown() {
     if (this->countdown_start == 0) {
         this->countdown_start = millis() + 5000;
@@ -131,6 +233,33 @@ int Status::update_countdown() {
     return static_cast<int>(millis() - this->countdown_start);
 }
 
+unsigned long Status::record_stage(LoopStage stage, unsigned long start) {
+    unsigned long now = micros();
+    this->stage_latency[stage].add(now - start);
+    return now;
+}
+
+const LatencyHistogram& Status::get_stage_latency(LoopStage stage) const {
+    return this->stage_latency[stage];
+}
+
+const __FlashStringHelper* Status::get_stage_name(LoopStage stage) {
+    switch (stage) {
+        case STAGE_CONSOLE: return F("console");
+        case STAGE_SENSOR: return F("sensor");
+        case STAGE_HEATER: return F("heater");
+        case STAGE_DISPLAY: return F("display");
+        case STAGE_WEBSERVER: return F("webserver");
+        case STAGE_ALIVE: return F("alive");
+        case STAGE_HISTORY: return F("history");
+        case STAGE_SETTINGS: return F("settings");
+        case STAGE_LOOP: return F("loop");
+        case STAGE_COUNT: break;
+    }
+
+    return F("invalid");
+}
+
 const char* Status::get_heater_mode() const {
     switch (this->heater_mode) {
         case HeaterMode::off: return "off";
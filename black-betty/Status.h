@@ -1,38 +1,105 @@
 #pragma once
 
+#include <stdint.h>
+
+class __FlashStringHelper;
+
 constexpr int HISTORY_SIZE = 5;
 constexpr int HISTORY_SLOT_TIME = 1000;
 
-class SimpleTimer {
+// Coarse history tiers the closed 1 s slots are rolled up into: 60 x 10 s (10 minutes) and 60 x 1 minute (1 hour)
+constexpr int HISTORY_TIER_COUNT = 2;
+constexpr int HISTORY_TIER_SIZE = 60;
+constexpr int HISTORY_TIER_FACTOR[HISTORY_TIER_COUNT] = { 10, 6 };
+
+// Fixed point scales of the compact history values (int16). The output is the on time in ms, at 2 ms resolution
+// it holds the longest heater window the settings accept (65534 ms)
+constexpr double COMPACT_SCALE_TEMPERATURE = 100.0;
+constexpr double COMPACT_SCALE_OUTPUT = 0.5;
+constexpr double COMPACT_SCALE_HEATER = 10000.0;
+constexpr double COMPACT_SCALE_HEALTH = 10.0;
+
+// Latency histogram buckets in microseconds: <16, <32, <64, ... <16384, >=16384
+constexpr int LATENCY_BUCKETS = 12;
+constexpr unsigned long LATENCY_FIRST_BUCKET = 16;
+
+// Current, min, max and sum of the samples of one history slot. The value type is either double or int32_t milli
+// units, the latter avoids software floating point on the ESP8266 for every sample. The milli units are summed up
+// as int64_t, a second of output samples at the 5 ms sample rate reaches 200 x 65534000 (longest heater window)
+template <typename T, typename S = T> class BasicStatCounter {
 public:
-    SimpleTimer(unsigned long window);
-    SimpleTimer(const SimpleTimer &) = delete;
-    SimpleTimer &operator=(const SimpleTimer &) = delete;
+    BasicStatCounter() : current(0), min(1), max(-1), sum(0) {}
+    BasicStatCounter(const BasicStatCounter &) = delete;
+    BasicStatCounter &operator=(const BasicStatCounter &) = delete;
+
+    bool is_empty() const {
+        return this->min == 1 && this->max == -1;
+    }
+
+    void next(T value) {
+        this->current = value;
+        if (this->is_empty()) {
+            this->min = value;
+            this->max = value;
+            this->sum = value;
+        } else {
+            if (value < this->min) { this->min = value; }
+            if (value > this->max) { this->max = value; }
+            this->sum += value;
+        }
+    }
+
+    void reset() {
+        this->min = 1;
+        this->max = -1;
+    }
+
+    T current;
+    T min;
+    T max;
+    S sum;
+};
 
-    bool next();
+typedef BasicStatCounter<double> StatCounter;
+typedef BasicStatCounter<int32_t, int64_t> MilliCounter;
 
-private:
-    unsigned long window;
-    unsigned long nextTick;
+// Conversion to milli units, rounded to the nearest milli unit
+inline int32_t to_milli(double value) {
+    return static_cast<int32_t>(value < 0.0 ? value * 1000.0 - 0.5 : value * 1000.0 + 0.5);
+}
+
+enum HeaterMode { off, low, high };
+
+// The measured stages of the main loop, STAGE_LOOP is the busy time of one scheduler run
+enum LoopStage {
+    STAGE_CONSOLE,
+    STAGE_SENSOR,
+    STAGE_HEATER,
+    STAGE_DISPLAY,
+    STAGE_WEBSERVER,
+    STAGE_ALIVE,
+    STAGE_HISTORY,
+    STAGE_SETTINGS,
+    STAGE_LOOP,
+    STAGE_COUNT
 };
 
-class StatCounter {
+// Fixed size log2 histogram of stage durations, counting since boot
+class LatencyHistogram {
 public:
-    StatCounter();
-    StatCounter(const StatCounter &) = delete;
-    StatCounter &operator=(const StatCounter &) = delete;
+    LatencyHistogram();
+    LatencyHistogram(const LatencyHistogram &) = delete;
+    LatencyHistogram &operator=(const LatencyHistogram &) = delete;
 
-    bool is_empty() const;
-    void next(double value);
+    void add(unsigned long duration);
     void reset();
 
-    double current;
-    double min;
-    double max;
-    double sum;
-};
+    static unsigned long get_bucket_limit(int index);
 
-enum HeaterMode { off, low, high };
+    unsigned long count;
+    unsigned long max;
+    unsigned long buckets[LATENCY_BUCKETS];
+};
 
 struct StatusHistoryItem {
     StatusHistoryItem();
@@ -41,10 +108,56 @@ struct StatusHistoryItem {
 
     int sequence;
     int samples;
-    StatCounter temperature;
-    StatCounter output;
-    StatCounter heater;
-    StatCounter health;
+    MilliCounter temperature;
+    MilliCounter output;
+    MilliCounter heater;
+    MilliCounter health;
+};
+
+// Min, max and average of a MilliCounter as int16 fixed point, used by the coarse history tiers
+struct CompactCounter {
+    int16_t min;
+    int16_t max;
+    int16_t average;
+
+    void set(const MilliCounter& counter, int samples, double scale);
+    void merge(const CompactCounter& other, uint16_t samples, uint16_t other_samples);
+};
+
+struct CompactHistoryItem {
+    uint16_t samples;
+    CompactCounter temperature;
+    CompactCounter output;
+    CompactCounter heater;
+    CompactCounter health;
+
+    void set(const StatusHistoryItem& item);
+    void clear();
+    void merge(const CompactHistoryItem& other);
+};
+
+static_assert(sizeof(CompactHistoryItem) == 26, "CompactHistoryItem should be packed without padding");
+
+// Ring of compact history items. Each slot merges a fixed number of closed slots of the finer ring
+class HistoryTier {
+public:
+    HistoryTier();
+    HistoryTier(const HistoryTier &) = delete;
+    HistoryTier &operator=(const HistoryTier &) = delete;
+
+    // Merges a closed slot of the finer ring, returns true if this closed the current slot of this tier
+    bool add(const CompactHistoryItem& item, int factor);
+
+    // Newest first, the slot at index 0 is still filling up
+    const CompactHistoryItem& get(int index) const;
+    int get_sequence(int index) const;
+    int get_count(int since) const;
+
+private:
+    CompactHistoryItem ringbuffer[HISTORY_TIER_SIZE];
+    int index;
+    int sequence;
+    int merged;
 };
 
 class Status {
@@ -57,27 +170,39 @@ public:
     HeaterMode heater_mode;
     unsigned long countdown_start;
     bool is_heater_toggle_active;
-
-    SimpleTimer console_timer;
-    SimpleTimer heater_timer;
-    SimpleTimer webserver_timer;
-    SimpleTimer display_timer;
-    SimpleTimer alive_timer;
+    unsigned long relay_switches;
 
     bool display_needs_update(int temperature, bool heater_active);
     void update_history(double temperature, double output, bool heater, unsigned long healthtime);
     const StatusHistoryItem& get_history(int index) const;
+
+    // Number of history slots (newest first) with a sequence >= since. The current slot is always included since
+    // it is still filling up. If since is ahead of the device (e.g. after a restart) the complete history is returned
+    int get_history_count(int since) const;
+
+    // Coarse history tiers (0: 10 s slots, 1: 1 minute slots)
+    const HistoryTier& get_history_tier(int tier) const;
+    static int get_history_tier_slot_time(int tier);
+
     const char* get_heater_mode() const;
     void sendStatus() const;
 
     int update_countdown();
 
+    // Adds the time since start (micros) to the stage histogram and returns the current micros
+    unsigned long record_stage(LoopStage stage, unsigned long start);
+    const LatencyHistogram& get_stage_latency(LoopStage stage) const;
+    static const __FlashStringHelper* get_stage_name(LoopStage stage);
+
 private:
     static int next_sequence;
     // Members for processing the history
     int history_index;
     unsigned long history_next_slot;
     StatusHistoryItem history_ringbuffer[HISTORY_SIZE];
+    HistoryTier history_tiers[HISTORY_TIER_COUNT];
+
+    LatencyHistogram stage_latency[STAGE_COUNT];
 
     // Members for checking if the display has changed
     int display_temperature;
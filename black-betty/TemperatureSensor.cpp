@@ -0,0 +1,122 @@
+#include "TemperatureSensor.h"
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "Settings.h"
+
+TemperatureSensor::TemperatureSensor() : sequence(0), next_poll(0), error_count(0) {
+}
+
+bool TemperatureSensor::begin() {
+    this->configure_filter();
+    Wire.begin();
+
+    uint8_t id = 0;
+    if (!this->read_register(ADT7410_REGISTER_ID, &id, 1) || (id & ADT7410_ID_MASK) != ADT7410_ID) {
+        Serial.printf("TemperatureSensor::begin No ADT7410 found (id 0x%02x)\n", id);
+        this->error_count++;
+        return false;
+    }
+
+    // Continuous mode is the default, the first conversion is ready one conversion time later
+    if (!this->write_register(ADT7410_REGISTER_CONFIG, ADT7410_CONFIG_16_BIT)) {
+        this->error_count++;
+        return false;
+    }
+
+    this->next_poll = millis() + SENSOR_CONVERSION_TIME;
+    return true;
+}
+
+bool TemperatureSensor::update() {
+    const unsigned long now = millis();
+    if (static_cast<long>(now - this->next_poll) < 0) {
+        return false;
+    }
+
+    // Not ready yet, the next run polls again
+    uint8_t status;
+    if (!this->read_register(ADT7410_REGISTER_STATUS, &status, 1)) {
+        this->error_count++;
+        this->next_poll = now + SENSOR_CONVERSION_TIME;
+        return false;
+    }
+
+    if ((status & ADT7410_STATUS_NOT_READY) != 0) {
+        return false;
+    }
+
+    // Reading the temperature clears the ready bit until the next conversion finished
+    uint8_t data[2];
+    this->next_poll = now + SENSOR_CONVERSION_TIME;
+    if (!this->read_register(ADT7410_REGISTER_TEMPERATURE, data, 2)) {
+        this->error_count++;
+        return false;
+    }
+
+    const int16_t raw = static_cast<int16_t>((static_cast<uint16_t>(data[0]) << 8) | data[1]);
+    this->publish(static_cast<double>(raw) / 128.0 + get_settings().temperature_offset);
+    return true;
+}
+
+void TemperatureSensor::configure_filter() {
+    this->filter.configure(get_settings());
+}
+
+bool TemperatureSensor::get(int index, SensorSample& sample) const {
+    if (index < 0 || index >= this->get_count()) {
+        return false;
+    }
+
+    sample = this->queue[(this->sequence - 1 - static_cast<uint32_t>(index)) % SENSOR_QUEUE_SIZE];
+    return true;
+}
+
+int TemperatureSensor::get_count() const {
+    return this->sequence < SENSOR_QUEUE_SIZE ? static_cast<int>(this->sequence) : SENSOR_QUEUE_SIZE;
+}
+
+bool TemperatureSensor::is_lost() const {
+    SensorSample sample;
+    return !this->get(0, sample) || millis() - sample.time > SENSOR_TIMEOUT;
+}
+
+unsigned long TemperatureSensor::get_error_count() const {
+    return this->error_count;
+}
+
+bool TemperatureSensor::write_register(uint8_t reg, uint8_t value) {
+    Wire.beginTransmission(ADT7410_ADDRESS);
+    Wire.write(reg);
+    Wire.write(value);
+    return Wire.endTransmission() == 0;
+}
+
+// Sets the register pointer and reads with a repeated start
+bool TemperatureSensor::read_register(uint8_t reg, uint8_t* output, uint8_t size) {
+    Wire.beginTransmission(ADT7410_ADDRESS);
+    Wire.write(reg);
+    if (Wire.endTransmission(false) != 0 || Wire.requestFrom(ADT7410_ADDRESS, size) != size) {
+        return false;
+    }
+
+    for (uint8_t index = 0; index < size; index++) {
+        output[index] = static_cast<uint8_t>(Wire.read());
+    }
+
+    return true;
+}
+
+void TemperatureSensor::publish(double raw) {
+    SensorSample& sample = this->queue[this->sequence % SENSOR_QUEUE_SIZE];
+    sample.sequence = ++this->sequence;
+    sample.time = millis();
+    sample.temperature = this->filter.next(raw);
+    sample.raw = raw;
+}
+
+TemperatureSensor& get_temperature_sensor() {
+    static TemperatureSensor instance;
+    return instance;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "SensorFilter.h"
+
+constexpr uint8_t ADT7410_ADDRESS = 0x48;
+
+// Registers of the ADT7410 and the bits used by the firmware
+constexpr uint8_t ADT7410_REGISTER_TEMPERATURE = 0x00;
+constexpr uint8_t ADT7410_REGISTER_STATUS = 0x02;
+constexpr uint8_t ADT7410_REGISTER_CONFIG = 0x03;
+constexpr uint8_t ADT7410_REGISTER_ID = 0x0B;
+constexpr uint8_t ADT7410_STATUS_NOT_READY = 0x80;
+constexpr uint8_t ADT7410_CONFIG_16_BIT = 0x80;
+constexpr uint8_t ADT7410_ID_MASK = 0xF8;
+constexpr uint8_t ADT7410_ID = 0xC8;
+
+// The ADT7410 converts every 240 ms in continuous mode
+constexpr unsigned long SENSOR_CONVERSION_TIME = 240;
+
+// Without a sample for this long the sensor is considered lost and the heater is switched off
+constexpr unsigned long SENSOR_TIMEOUT = 1000;
+
+// Samples kept for the consumers, about two seconds
+constexpr int SENSOR_QUEUE_SIZE = 8;
+
+struct SensorSample {
+    uint32_t sequence;
+    unsigned long time;
+    double temperature;  // Filtered, including the offset
+    double raw;  // Unfiltered, including the offset
+};
+
+/*
+    Acquisition of the ADT7410 in continuous mode. The INT and CT pins of the sensor only signal limit
+    crossings, so the conversion is tracked by time: the sensor is left alone until a conversion is due and then
+    the ready bit of the status register is polled. Each finished conversion is read once and published with the
+    time it was read into a small queue, the heater and the history take their samples from there. The samples
+    pass the SensorFilter on the way.
+*/
+class TemperatureSensor {
+public:
+    TemperatureSensor();
+    TemperatureSensor(const TemperatureSensor&) = delete;
+    TemperatureSensor& operator=(const TemperatureSensor&) = delete;
+
+    // Configures continuous 16 bit conversions, false if the sensor does not answer
+    bool begin();
+
+    // Reads the next conversion if it is due, returns true if a sample was published
+    bool update();
+
+    // Applies the filter settings, the filter restarts with the next sample
+    void configure_filter();
+
+    // Newest first, index 0 is the last published sample. False if there is no such sample
+    bool get(int index, SensorSample& sample) const;
+    int get_count() const;
+
+    // No sample for SENSOR_TIMEOUT (or none at all yet)
+    bool is_lost() const;
+
+    unsigned long get_error_count() const;
+
+private:
+    bool write_register(uint8_t reg, uint8_t value);
+    bool read_register(uint8_t reg, uint8_t* output, uint8_t size);
+    void publish(double raw);
+
+    SensorFilter filter;
+    SensorSample queue[SENSOR_QUEUE_SIZE];
+    uint32_t sequence;
+    unsigned long next_poll;
+    unsigned long error_count;
+};
+
+TemperatureSensor& get_temperature_sensor();
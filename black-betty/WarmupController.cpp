@@ -0,0 +1,252 @@
+#include "WarmupController.h"
+
+#include <math.h>
+#include <string.h>
+#include <Arduino.h>
+
+constexpr int DUTY_SLOTS = WARMUP_MAX_DEAD_TIME + 1;
+
+BoilerModel::BoilerModel() : slot(0), last_temperature(0.0), last_duty(0.0), ambient(WARMUP_DEFAULT_AMBIENT), step_start(-1),
+                             step_origin(0.0), step_temperature(0.0), step_integral(0.0), dead_time(0.0), hold(0), sum_uu(0.0), sum_ux(0.0),
+                             sum_xx(0.0), sum_uy(0.0), sum_xy(0.0), rate(0.0), loss(0.0) {
+    memset(this->duty, 0, sizeof(this->duty));
+    memset(this->step_sums, 0, sizeof(this->step_sums));
+}
+
+void BoilerModel::identify(double temperature, double duty) {
+    // The boiler is at ambient temperature in the first slot after a cold boot
+    if (this->slot == 0) {
+        this->ambient = temperature < WARMUP_MAX_AMBIENT ? temperature : WARMUP_DEFAULT_AMBIENT;
+    } else {
+        this->identify_dead_time(temperature, duty);
+        this->identify_rate(temperature, temperature - this->last_temperature);
+    }
+
+    this->duty[this->slot % DUTY_SLOTS] = static_cast<uint8_t>(duty * 255.0 + 0.5);
+    this->last_temperature = temperature;
+    this->last_duty = duty;
+    this->slot++;
+}
+
+// Determinant of the 3x3 matrix with the given columns
+static double determinant(const double* a, const double* b, const double* c) {
+    return a[0] * (b[1] * c[2] - b[2] * c[1]) - b[0] * (a[1] * c[2] - a[2] * c[1]) + c[0] * (a[1] * b[2] - a[2] * b[1]);
+}
+
+// Least squares of the integrated model over the step, the dead time is the ratio of two of its coefficients.
+// The heater switched on within the slot before the first full one, its duty tells when. Slot averages are
+// half a slot late
+void BoilerModel::identify_dead_time(double temperature, double duty) {
+    if (duty < 0.95) {
+        this->step_start = -1;
+        return;
+    }
+
+    if (this->step_start < 0) {
+        if (this->last_duty < 0.5 || this->slot == 1) {
+            this->step_start = this->slot;
+            this->step_origin = this->slot - this->last_duty;
+            this->step_temperature = this->last_temperature;
+            this->step_integral = 0.0;
+            memset(this->step_sums, 0, sizeof(this->step_sums));
+        }
+
+        return;
+    }
+
+    this->step_integral += (temperature + this->last_temperature) / 2.0 - this->ambient;
+    const int elapsed = this->slot - this->step_start;
+    if (elapsed < WARMUP_STEP_SETTLE) {
+        return;
+    }
+
+    // Normal equations of y = a t - b - c I in the order t, -1, -I: the matrix columns and the right side
+    const double t = this->slot + 0.5 - this->step_origin;
+    const double integral = this->step_integral;
+    const double y = temperature - this->step_temperature;
+    double* sums = this->step_sums;
+    sums[0] += t * t;
+    sums[1] -= t;
+    sums[2] -= t * integral;
+    sums[3] += 1.0;
+    sums[4] += integral;
+    sums[5] += integral * integral;
+    sums[6] += t * y;
+    sums[7] -= y;
+    sums[8] -= integral * y;
+    if (elapsed - WARMUP_STEP_SETTLE + 1 < WARMUP_STEP_MIN_SLOTS) {
+        return;
+    }
+
+    const double column_t[] = { sums[0], sums[1], sums[2] };
+    const double column_one[] = { sums[1], sums[3], sums[4] };
+    const double column_integral[] = { sums[2], sums[4], sums[5] };
+    const double right[] = { sums[6], sums[7], sums[8] };
+    const double matrix = determinant(column_t, column_one, column_integral);
+    if (matrix == 0.0) {
+        return;
+    }
+
+    const double a = determinant(right, column_one, column_integral) / matrix;
+    const double b = determinant(column_t, right, column_integral) / matrix;
+    const double dead_time = a > 0.0 ? b / a : 0.0;
+    if (dead_time > 0.0 && dead_time <= WARMUP_MAX_DEAD_TIME) {
+        this->dead_time = dead_time;
+    }
+}
+
+// Least squares of slope = rate * u - loss * x with exponential forgetting. After a jump of the delayed heater
+// power the plate still has to follow, these slots are left out
+void BoilerModel::identify_rate(double temperature, double slope) {
+    const int delay = static_cast<int>(this->dead_time + 0.5);
+    if (delay == 0 || delay >= this->slot) {
+        return;
+    }
+
+    const double u = this->duty[(this->slot - delay) % DUTY_SLOTS] / 255.0;
+    const double previous_u = this->duty[(this->slot - delay - 1) % DUTY_SLOTS] / 255.0;
+    if (fabs(u - previous_u) > 0.5) {
+        this->hold = delay;
+    }
+
+    if (this->hold > 0) {
+        this->hold--;
+        return;
+    }
+
+    const double x = (temperature + this->last_temperature) / 2.0 - this->ambient;
+    this->sum_uu = this->sum_uu * WARMUP_FORGETTING + u * u;
+    this->sum_ux = this->sum_ux * WARMUP_FORGETTING + u * x;
+    this->sum_xx = this->sum_xx * WARMUP_FORGETTING + x * x;
+    this->sum_uy = this->sum_uy * WARMUP_FORGETTING + u * slope;
+    this->sum_xy = this->sum_xy * WARMUP_FORGETTING + x * slope;
+
+    // Without enough variation of power and temperature only the rate is fitted
+    const double determinant = this->sum_uu * this->sum_xx - this->sum_ux * this->sum_ux;
+    if (determinant > 1e-4 * this->sum_uu * this->sum_xx) {
+        this->rate = (this->sum_uy * this->sum_xx - this->sum_ux * this->sum_xy) / determinant;
+        this->loss = (this->sum_ux * this->sum_uy - this->sum_uu * this->sum_xy) / determinant;
+    } else if (this->sum_uu > 0.0) {
+        this->rate = (this->sum_uy + this->loss * this->sum_ux) / this->sum_uu;
+    }
+
+    this->rate = this->rate > 0.0 ? this->rate : 0.0;
+    this->loss = this->loss > 0.0 ? this->loss : 0.0;
+}
+
+bool BoilerModel::is_identified() const {
+    return this->dead_time > 0.0 && this->rate > 0.0;
+}
+
+double BoilerModel::get_dead_time() const { return this->dead_time; }
+double BoilerModel::get_rate() const { return this->rate; }
+double BoilerModel::get_loss() const { return this->loss; }
+double BoilerModel::get_ambient() const { return this->ambient; }
+
+// The heater keeps acting for the dead time, the boiler approaches its full power temperature meanwhile
+double BoilerModel::predict_peak(double temperature) const {
+    if (this->loss <= 0.0) {
+        return temperature + this->rate * this->dead_time;
+    }
+
+    const double full_power = this->ambient + this->rate / this->loss;
+    return full_power + (temperature - full_power) * exp(-this->loss * this->dead_time);
+}
+
+double BoilerModel::get_holding_power(double temperature) const {
+    if (this->rate <= 0.0) {
+        return 0.0;
+    }
+
+    const double power = this->loss * (temperature - this->ambient) / this->rate;
+    return power < 0.0 ? 0.0 : (power > 1.0 ? 1.0 : power);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// WarmupController
+WarmupController::WarmupController() : state(WarmupState::idle), start_time(0), coast_time(0), peak(0.0), peak_time(0) {
+}
+
+bool WarmupController::start(double temperature, double setpoint, unsigned long now) {
+    if (temperature > setpoint - WARMUP_MIN_DISTANCE) {
+        return false;
+    }
+
+    this->state = WarmupState::heating;
+    this->start_time = now;
+    return true;
+}
+
+void WarmupController::stop() {
+    this->state = WarmupState::idle;
+}
+
+double WarmupController::next(double temperature, double setpoint, unsigned long time) {
+    if (this->state == WarmupState::heating) {
+        if (time - this->start_time > WARMUP_TIMEOUT || temperature >= setpoint) {
+            this->state = WarmupState::idle;
+            return 0.0;
+        }
+
+        // Without a model there is no prediction, the pid takes over with some distance
+        if (!this->model.is_identified()) {
+            if (temperature >= setpoint - WARMUP_MIN_DISTANCE) {
+                this->state = WarmupState::idle;
+                return 0.0;
+            }
+
+            return 1.0;
+        }
+
+        if (this->model.predict_peak(temperature) < setpoint) {
+            return 1.0;
+        }
+
+        this->state = WarmupState::coasting;
+        this->coast_time = time;
+        this->peak = temperature;
+        this->peak_time = time;
+    }
+
+    if (this->state != WarmupState::coasting) {
+        return 0.0;
+    }
+
+    // The heat on its way keeps the temperature rising for at least the dead time, the plate may add to it
+    if (temperature > this->peak + WARMUP_PEAK_THRESHOLD) {
+        this->peak = temperature;
+        this->peak_time = time;
+    }
+
+    const bool peaked = time - this->coast_time >= static_cast<unsigned long>(this->model.get_dead_time() * 1000.0) &&
+        time - this->peak_time >= WARMUP_PEAK_TIME;
+    if (temperature >= setpoint || peaked || time - this->start_time > WARMUP_TIMEOUT) {
+        this->state = WarmupState::idle;
+    }
+
+    return 0.0;
+}
+
+bool WarmupController::is_active() const {
+    return this->state != WarmupState::idle;
+}
+
+WarmupState WarmupController::get_state() const {
+    return this->state;
+}
+
+void WarmupController::identify(double temperature, double duty) {
+    this->model.identify(temperature, duty);
+}
+
+const BoilerModel& WarmupController::get_model() const {
+    return this->model;
+}
+
+const __FlashStringHelper* WarmupController::get_state_name(WarmupState state) {
+    switch (state) {
+        case WarmupState::heating: return F("heating");
+        case WarmupState::coasting: return F("coasting");
+        default: return F("idle");
+    }
+}
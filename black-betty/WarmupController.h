@@ -0,0 +1,137 @@
+#pragma once
+
+#include <stdint.h>
+
+class __FlashStringHelper;
+
+// The warm-up runs if the temperature is at least this far (°C) below the setpoint when the heater starts or the
+// setpoint is raised
+constexpr double WARMUP_MIN_DISTANCE = 5.0;
+
+// Longest dead time (s) the model can identify, the heater duty of as many history slots is kept
+constexpr int WARMUP_MAX_DEAD_TIME = 30;
+
+// Slots of a full power step before the dead time is fitted, the plate has settled after them
+constexpr int WARMUP_STEP_SETTLE = 30;
+constexpr int WARMUP_STEP_MIN_SLOTS = 8;
+
+// Forgetting factor of the least squares per slot, about 10 minutes of memory
+constexpr double WARMUP_FORGETTING = 0.998;
+
+// Ambient temperature if the heater was already warm at boot
+constexpr double WARMUP_DEFAULT_AMBIENT = 20.0;
+constexpr double WARMUP_MAX_AMBIENT = 40.0;
+
+// The coasting ends when the temperature did not rise (by more than the threshold, °C) for this time (ms)
+constexpr unsigned long WARMUP_PEAK_TIME = 2000;
+constexpr double WARMUP_PEAK_THRESHOLD = 0.02;
+
+// A warm-up that takes longer (ms) is handed over to the pid
+constexpr unsigned long WARMUP_TIMEOUT = 15UL * 60UL * 1000UL;
+
+/*
+    First order plus dead time model of the boiler: dT/dt = rate * u(t - dead time) - loss * (T - ambient), where
+    u is the relative heater power. It is identified from the closed 1 s history slots (average temperature and
+    heater on time): the ambient temperature from the first slot, the dead time by least squares of the
+    integrated model over a full power step and rate and loss by least squares of the slope on the delayed
+    heater power and the temperature.
+*/
+class BoilerModel {
+public:
+    BoilerModel();
+    BoilerModel(const BoilerModel&) = delete;
+    BoilerModel& operator=(const BoilerModel&) = delete;
+
+    // Adds the next history slot, duty is the relative time the heater was on
+    void identify(double temperature, double duty);
+
+    // Dead time and rate are known, the loss may still be 0
+    bool is_identified() const;
+
+    double get_dead_time() const;  // s
+    double get_rate() const;       // °C/s at full power
+    double get_loss() const;       // 1/s
+    double get_ambient() const;    // °C
+
+    // Temperature the boiler peaks at if the heater is switched off now after running at full power
+    double predict_peak(double temperature) const;
+
+    // Relative heater power that holds the temperature
+    double get_holding_power(double temperature) const;
+
+private:
+    void identify_dead_time(double temperature, double duty);
+    void identify_rate(double temperature, double slope);
+
+    int slot;
+    double last_temperature;
+    double last_duty;
+    double ambient;
+    uint8_t duty[WARMUP_MAX_DEAD_TIME + 1];
+
+    // Full power step, step_start is the first full slot (-1 if there is none) and step_origin the time (in
+    // slots) the heater switched on. Over the step T - T0 = rate * t - rate * dead time - loss * I, where t is
+    // the time since the origin and I the integral of the temperature above ambient
+    int step_start;
+    double step_origin;
+    double step_temperature;
+    double step_integral;
+    double step_sums[9];
+    double dead_time;
+
+    // Slots left out of the least squares after a jump of the heater power
+    int hold;
+
+    // Weighted sums of the least squares, u is the delayed heater power and x the temperature above ambient
+    double sum_uu;
+    double sum_ux;
+    double sum_xx;
+    double sum_uy;
+    double sum_xy;
+    double rate;
+    double loss;
+};
+
+enum class WarmupState : uint8_t {
+    idle,
+    heating,
+    coasting
+};
+
+/*
+    Warm-up of the heater by the boiler model. The heater runs at full power until the predicted peak after
+    switching off reaches the setpoint, coasts until the temperature peaked (at least for the dead time) and
+    then hands over to the pid, which starts from the power that holds the setpoint. Until the model is
+    identified the warm-up only runs at full power and hands over WARMUP_MIN_DISTANCE below the setpoint.
+*/
+class WarmupController {
+public:
+    WarmupController();
+    WarmupController(const WarmupController&) = delete;
+    WarmupController& operator=(const WarmupController&) = delete;
+
+    // Starts the warm-up if the temperature is far enough below the setpoint
+    bool start(double temperature, double setpoint, unsigned long now);
+    void stop();
+
+    // Feeds the next sample, returns the relative heater power. The warm-up is done when it is no longer active
+    double next(double temperature, double setpoint, unsigned long time);
+
+    bool is_active() const;
+    WarmupState get_state() const;
+
+    void identify(double temperature, double duty);
+    const BoilerModel& get_model() const;
+
+    static const __FlashStringHelper* get_state_name(WarmupState state);
+
+private:
+    BoilerModel model;
+    WarmupState state;
+    unsigned long start_time;
+    unsigned long coast_time;
+
+    // Highest temperature while coasting and when it was reached
+    double peak;
+    unsigned long peak_time;
+};
@@ -8,67 +8,188 @@
 
 #include "util.h"
 #include "Settings.h"
+#include "SettingsJournal.h"
 #include "Status.h"
+#include "Scheduler.h"
 #include "HeaterPID.h"
+#include "TemperatureSensor.h"
 #include "CommandParser.h"
 
 // The server itself needs to be a global variable for some reasons
 ESP8266WebServer server(80);
 
-WebServer::WebServer() {
+#if !WEBSERVER_ASYNC
+// Streams of /events, they stay open after the request was handled. The frame is rendered once for all of them
+static WiFiClient event_clients[EVENT_MAX_CLIENTS];
+static char event_frame[EVENT_FRAME_SIZE];
+static size_t event_frame_size = 0;
+
+// A frame that does not fit into the buffer ends up with a size beyond it and is not sent
+static void append_event_frame(const char* data, size_t size) {
+    if (event_frame_size + size <= EVENT_FRAME_SIZE) {
+        memcpy(event_frame + event_frame_size, data, size);
+    }
+    event_frame_size += size;
+}
+#endif
+
+WebServer::WebServer() :
+        ssid(nullptr),
+        password(nullptr),
+        wifi_state(WifiState::idle),
+        state_start(0),
+        retry_delay(WIFI_RETRY_MIN_DELAY),
+        connect_count(0),
+        routes_registered(false)
+#if !WEBSERVER_ASYNC
+        , event_sequence(-1)
+        , event_heater_mode(HeaterMode::off)
+#endif
+{
 }
 
-bool WebServer::connect(const char* hostname, const char* ssid, const char* password, int timeout) {
+bool WebServer::begin(const char* hostname, const char* ssid, const char* password) {
     if (ssid == nullptr || *ssid == 0x00 || password == nullptr || *password == 0x00) {
         Serial.println(F("No ssid/password set, webserver will not be started"));
         return false;
     }
 
-    // Set the timeout from relative to absolute
-    int start = millis();
-    timeout += start;
+    this->ssid = ssid;
+    this->password = password;
 
-    // Change the wifi to client only mode (avoid creating a public access point)
+    // Change the wifi to client only mode (avoid creating a public access point), reconnects are done by update_connection
     WiFi.mode(WIFI_STA, false);
-
-    // Begin with the WiFi
+    WiFi.setAutoReconnect(false);
     WiFi.hostname(hostname);
-    WiFi.begin(ssid, password);
-    
-    for (wl_status_t status = WL_DISCONNECTED; status != WL_CONNECTED; status = WiFi.status()) {
-        if (status == WL_NO_SSID_AVAIL) {
-            Serial.println(F("WebServer::connect Unable to connect, ssid not found"));
-            return false;
-        }
+    this->start_attempt();
+    return true;
+}
 
-        if (timeout < millis()) {
-            Serial.println(F("WebServer::connect Unable to connect to wlan, timed out"));
-            return false;
-        }
-        
-        delay(1000);
+void WebServer::serve() {
+    this->update_connection();
+#if !WEBSERVER_ASYNC
+    if (this->wifi_state == WifiState::connected) {
+      server.handleClient();
+      this->push_events();
     }
+#endif
+}
+
+WifiState WebServer::get_wifi_state() const {
+    return this->wifi_state;
+}
+
+unsigned long WebServer::get_connect_count() const {
+    return this->connect_count;
+}
 
-    // Setup server
+///////////////////////////////////////////////////////////////////////////////////
+// Connection state machine, every step returns immediately so the control loop keeps running
+
+void WebServer::update_connection() {
+    const wl_status_t status = WiFi.status();
+    const unsigned long elapsed = millis() - this->state_start;
+
+    switch (this->wifi_state) {
+        case WifiState::idle:
+            break;
+
+        case WifiState::connecting:
+            if (status == WL_CONNECTED) {
+                // Handlers are chained by server.on, so they are only added once and survive a reconnect
+                if (!this->routes_registered) {
+                    register_routes();
+                    this->routes_registered = true;
+                }
+                start_server();
+
+                char ip[20];
+                this->get_ip(ip, array_size(ip));
+                Serial.printf("Connected with ip %s in %lu ms\n", ip, elapsed);
+
+                this->connect_count++;
+                this->retry_delay = WIFI_RETRY_MIN_DELAY;
+                this->set_wifi_state(WifiState::connected);
+            } else if (status == WL_NO_SSID_AVAIL || status == WL_CONNECT_FAILED || status == WL_WRONG_PASSWORD || elapsed >= WIFI_CONNECT_TIMEOUT) {
+                Serial.printf("WebServer::update_connection Unable to connect (status %d), retry in %lu ms\n", status, this->retry_delay);
+                WiFi.disconnect();
+                this->set_wifi_state(WifiState::waiting);
+            }
+            break;
+
+        case WifiState::connected:
+            if (status != WL_CONNECTED) {
+                Serial.println(F("WebServer::update_connection Connection lost, reconnecting"));
+                stop_server();
+                this->start_attempt();
+            }
+            break;
+
+        case WifiState::waiting:
+            if (elapsed >= this->retry_delay) {
+                this->retry_delay = this->retry_delay * 2 < WIFI_RETRY_MAX_DELAY ? this->retry_delay * 2 : WIFI_RETRY_MAX_DELAY;
+                this->start_attempt();
+            }
+            break;
+    }
+}
+
+// The async backend serves the routes of the web interface but /events (the interface polls /status instead) and
+// /history, whose tiers do not fit into the response buffer
+void WebServer::register_routes() {
+#if WEBSERVER_ASYNC
+    AsyncHttpServer& async_server = get_async_http_server();
+    async_server.on("/", on_async_index);
+    async_server.on("/status", on_async_status);
+    async_server.on("/status.bin", on_async_status_binary);
+    async_server.on("/command", on_async_command);
+    async_server.on("/batch", on_async_batch);
+#else
+    const char* headers[] = { "If-None-Match", "Accept-Encoding" };
+    server.collectHeaders(headers, array_size(headers));
     server.on("/", on_serve_index);
     server.on("/status", on_serve_status);
+    server.on("/status.bin", on_serve_status_binary);
+    server.on("/history", on_serve_history);
+    server.on("/metrics", on_serve_metrics);
     server.on("/command", on_serve_command);
+    server.on("/batch", on_serve_batch);
+    server.on("/events", on_serve_events);
     server.onNotFound(on_serve_not_found);
+#endif
+}
+
+void WebServer::start_server() {
+#if WEBSERVER_ASYNC
+    get_async_http_server().begin();
+#else
     server.begin();
+#endif
+}
 
-    char ip[20];
-    this->get_ip(ip, array_size(ip));
-    Serial.printf("Connected with ip %s in %d ms\n", ip, (millis() - start));
+void WebServer::stop_server() {
+#if WEBSERVER_ASYNC
+    get_async_http_server().end();
+#else
+    server.close();
+    for (WiFiClient& client : event_clients) {
+        client.stop();
+    }
+#endif
+}
 
-    return true;
+void WebServer::start_attempt() {
+    WiFi.begin(this->ssid, this->password);
+    this->set_wifi_state(WifiState::connecting);
 }
 
-void WebServer::serve() {
-    if (WiFi.status() == WL_CONNECTED) {
-      server.handleClient();
-    }
+void WebServer::set_wifi_state(WifiState state) {
+    this->wifi_state = state;
+    this->state_start = millis();
 }
 
+///////////////////////////////////////////////////////////////////////////////////
+
 void WebServer::get_ip(char* output, size_t size) const {
     output[0] = output[size - 1] = 0x00;
     if (WiFi.status() == WL_CONNECTED) {
@@ -79,8 +200,36 @@ void WebServer::get_ip(char* output, size_t size) const {
     }
 }
 
+// The page is only stored gzip compressed, a client has to accept gzip unless it rules it out with q=0
+static bool accepts_gzip(const char* accept_encoding) {
+    const char* gzip = strstr(accept_encoding, "gzip");
+    if (gzip == nullptr) {
+        return false;
+    }
+
+    const char* quality = strstr(gzip, "q=");
+    const char* next = strchr(gzip, ',');
+    return quality == nullptr || (next != nullptr && quality > next) || atof(quality + 2) > 0.0;
+}
+
+// The page only changes with the firmware, browsers revalidate it with the etag and get a 304 without content
 void WebServer::on_serve_index() {
-    server.send(200, F("text/html; charset=utf-8"), WebServer::webpage_index_content);
+    const String etag(WebServer::webpage_index_etag);
+    server.sendHeader(F("ETag"), etag);
+    server.sendHeader(F("Cache-Control"), F("no-cache"));
+    server.sendHeader(F("Vary"), F("Accept-Encoding"));
+    if (server.header(F("If-None-Match")) == etag) {
+        server.send(304);
+        return;
+    }
+
+    if (!accepts_gzip(server.header(F("Accept-Encoding")).c_str())) {
+        server.send(406, "text/plain", "The page is only available gzip compressed");
+        return;
+    }
+
+    server.sendHeader(F("Content-Encoding"), F("gzip"));
+    server.send_P(200, PSTR("text/html; charset=utf-8"), reinterpret_cast<PGM_P>(WebServer::webpage_index_content), WebServer::webpage_index_size);
 }
 
 void WebServer::on_serve_status() {
@@ -91,13 +240,67 @@ void WebServer::on_serve_status() {
       server.sendHeader(F("Access-Control-Allow-Origin"), F("*")); // DEBUG, DEBUG, DEBUG!
     }
 
-    char buffer[2048];
-    buffer[0] = buffer[array_size(buffer) - 1] = 0x00;
- 
-    // Extracting the json creation to another method will allow the stack to discard json helper structures when calling send
-    create_status_json(buffer, array_size(buffer));
-    Serial.printf("WebServer::on_serve_status -> Buffer usage: %d / %d\n", strlen(buffer), array_size(buffer));
-    server.send(200, F("application/json"), buffer);
+    // The json is streamed chunked, so the memory usage does not depend on the history size
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, F("application/json"), emptyString);
+
+    JsonStream json(WebServer::stream_buffer, array_size(WebServer::stream_buffer), send_chunk);
+    create_status_json(json, get_since_argument());
+    json.flush();
+    server.sendContent(emptyString);
+}
+
+void WebServer::on_serve_status_binary() {
+    const Settings& settings = get_settings();
+
+    // Only allow CORS in debug mode
+    if (settings.is_debug()) {
+      server.sendHeader(F("Access-Control-Allow-Origin"), F("*"));
+    }
+
+    uint8_t buffer[STATUS_BINARY_HEADER_SIZE + HISTORY_SIZE * STATUS_BINARY_ITEM_SIZE];
+    size_t size = create_status_binary(buffer, array_size(buffer), get_since_argument());
+    server.send(200, "application/octet-stream", reinterpret_cast<const char*>(buffer), size);
+}
+
+void WebServer::on_serve_history() {
+    const Settings& settings = get_settings();
+
+    // Only allow CORS in debug mode
+    if (settings.is_debug()) {
+      server.sendHeader(F("Access-Control-Allow-Origin"), F("*"));
+    }
+
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, F("application/json"), emptyString);
+
+    // The tier selects the 1 s ring (0) or one of the coarse tiers (1: 10 s, 2: 1 minute)
+    JsonStream json(WebServer::stream_buffer, array_size(WebServer::stream_buffer), send_chunk);
+    const int tier = get_tier_argument();
+    if (tier > 0) {
+        create_history_tier_json(json, tier - 1, get_since_argument());
+    } else {
+        create_history_json(json, get_since_argument());
+    }
+    json.flush();
+    server.sendContent(emptyString);
+}
+
+void WebServer::on_serve_metrics() {
+    const Settings& settings = get_settings();
+
+    // Only allow CORS in debug mode
+    if (settings.is_debug()) {
+      server.sendHeader(F("Access-Control-Allow-Origin"), F("*"));
+    }
+
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, F("application/json"), emptyString);
+
+    JsonStream json(WebServer::stream_buffer, array_size(WebServer::stream_buffer), send_chunk);
+    create_metrics_json(json);
+    json.flush();
+    server.sendContent(emptyString);
 }
 
 void WebServer::on_serve_command() {
@@ -121,101 +324,510 @@ void WebServer::on_serve_command() {
     command[0] = command[array_size(command) - 1] = 0x00;
     strncpy(command, server.arg("plain").c_str(), array_size(command) - 1);
 
-    char output[128];
-    output[0] = output[array_size(output) - 1] = 0x00;
-    
-    Serial.println(F("Executing web command:"));
-    Serial.println(command);
-    bool success = get_command_parser().execute(command, true, output, array_size(output));
-    
-    // Build json from result (reuse command buffer)
-    char* pos = command;
-    pos = json_add(pos, F("{"));
-    pos = json_add_property(pos, F("success"), success, true);
-    pos = json_add_property(pos, F("message"), output, false);
-    pos = json_add(pos, F("}"));
-    *pos = 0x00;
-
-    Serial.println(command);
-    
+    const bool success = execute_command_json(command);
     server.send(success ? 200 : 400, "application/json", command);
     Serial.println("send done");
 }
 
+void WebServer::on_serve_batch() {
+    const Settings& settings = get_settings();
+
+    // Only allow CORS in debug mode
+    if (settings.is_debug()) {
+        server.sendHeader(F("Access-Control-Allow-Origin"), F("*"));
+        server.sendHeader(F("Access-Control-Allow-Allow-Method"), F("POST, OPTIONS"));
+        server.sendHeader(F("Access-Control-Allow-Headers"), F("X-Requested-With, Content-Type"));
+    }
+
+    if (server.method() == HTTPMethod::HTTP_OPTIONS) {
+        server.send(204);
+        return;
+    }
+
+    char commands[512];
+    commands[0] = commands[array_size(commands) - 1] = 0x00;
+    strncpy(commands, server.arg("plain").c_str(), array_size(commands) - 1);
+
+    // The results are streamed while the commands run, so the status code can not depend on them. The batch was
+    // applied if every result reports success
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, F("application/json"), emptyString);
+
+    JsonStream json(WebServer::stream_buffer, array_size(WebServer::stream_buffer), send_chunk);
+    get_command_parser().execute_batch(commands, json);
+    json.flush();
+    server.sendContent(emptyString);
+}
+
+#if !WEBSERVER_ASYNC
+void WebServer::on_serve_events() {
+    int slot = -1;
+    for (int index = 0; index < EVENT_MAX_CLIENTS && slot < 0; index++) {
+        slot = event_clients[index].connected() ? -1 : index;
+    }
+
+    if (slot < 0) {
+        server.send(503, "text/plain", "Too many event clients");
+        return;
+    }
+
+    // The head is written directly and the connection is kept, the server finishes the request without closing it
+    WiFiClient& client = server.client();
+    client.setNoDelay(true);
+    const char head[] = "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\nConnection: keep-alive\r\n";
+    const char cors[] = "Access-Control-Allow-Origin: *\r\n";
+    client.write(reinterpret_cast<const uint8_t*>(head), strlen(head));
+    if (get_settings().is_debug()) {
+        client.write(reinterpret_cast<const uint8_t*>(cors), strlen(cors));
+    }
+    client.write(reinterpret_cast<const uint8_t*>("\r\n"), 2);
+    event_clients[slot] = client;
+
+    // The next frame carries the complete history for the new client
+    get_webserver().event_sequence = -1;
+}
+#endif
+
 void WebServer::on_serve_not_found() {
     server.send(404, "text/plain", "Not found");
 }
 
-void WebServer::create_status_json(char* output, size_t size) {
+void WebServer::create_status_json(JsonStream& json, int since) {
     const Settings& settings = get_settings();
     const Status& status = get_status();
     const HeaterPID& heater = get_heater();
+    const PidAutoTune& autotune = heater.get_autotune();
+    const WarmupController& warmup = heater.get_warmup();
+    const SettingsJournal& journal = get_settings_journal();
     int token = get_command_parser().get_security_token();
 
-    char* pos = output;
-    pos = json_add(pos, F("{"));
-    pos = json_add_property(pos, F("id"), settings.device_id, true);
-    pos = json_add_property(pos, F("token"), token, true);
-    pos = json_add_property(pos, F("isDebug"), settings.is_debug(), true);
-    pos = json_add_property(pos, F("isCountdownMode"), settings.is_countdown_mode(), false);
-    pos = json_add(pos, F(",\"temperature\":{"));
-    pos = json_add_property(pos, F("current"), status.temperature, true);
-    pos = json_add_property(pos, F("target"), heater.get_setpoint(), true);
-    pos = json_add_property(pos, F("low"), settings.heater_temperature_low, true);
-    pos = json_add_property(pos, F("high"), settings.heater_temperature_high, false);
-    pos = json_add(pos, F("},\"pid\":{"));
-    pos = json_add_property(pos, F("kp"), heater.get_kp(), true);
-    pos = json_add_property(pos, F("ki"), heater.get_ki(), true);
-    pos = json_add_property(pos, F("kd"), heater.get_kd(), true);
-    pos = json_add_property(pos, F("input"), heater.get_input(), true);
-    pos = json_add_property(pos, F("output"), heater.get_output(), true);
-    pos = json_add_property(pos, F("setpoint"), heater.get_setpoint(), false);
-    pos = json_add(pos, F("},\"heater\":{"));
-    pos = json_add_property(pos, F("mode"), status.get_heater_mode(), true);
-    pos = json_add_property(pos, F("active"), heater.is_active(), false);
-   
-    pos = json_add(pos, F("},\"history\": {"));
-    pos = json_add_property(pos, F("window"), HISTORY_SLOT_TIME, true);
+    json.add(F("{"));
+    json.add_property(F("id"), settings.device_id, true);
+    json.add_property(F("token"), token, true);
+    json.add_property(F("isDebug"), settings.is_debug(), true);
+    json.add_property(F("isCountdownMode"), settings.is_countdown_mode(), false);
+    json.add(F(",\"temperature\":{"));
+    json.add_property(F("current"), status.temperature, true);
+    json.add_property(F("target"), heater.get_setpoint(), true);
+    json.add_property(F("low"), settings.heater_temperature_low, true);
+    json.add_property(F("high"), settings.heater_temperature_high, false);
+    json.add(F("},\"pid\":{"));
+    json.add_property(F("kp"), heater.get_kp(), true);
+    json.add_property(F("ki"), heater.get_ki(), true);
+    json.add_property(F("kd"), heater.get_kd(), true);
+    json.add_property(F("input"), heater.get_input(), true);
+    json.add_property(F("output"), heater.get_output(), true);
+    json.add_property(F("setpoint"), heater.get_setpoint(), false);
+    json.add(F("},\"heater\":{"));
+    json.add_property(F("mode"), status.get_heater_mode(), true);
+    json.add_property(F("active"), heater.is_active(), true);
+    json.add_property(F("switches"), static_cast<int>(status.relay_switches), false);
+    json.add(F("},\"autotune\":{\"state\":\""));
+    json.add(PidAutoTune::get_state_name(autotune.get_state()));
+    json.add(F("\",\"rule\":\""));
+    json.add(PidAutoTune::get_rule_name(autotune.get_rule()));
+    json.add(F("\","));
+    json.add_property(F("cycle"), autotune.get_cycle(), true);
+    json.add_property(F("cycles"), AUTOTUNE_CYCLES, true);
+    json.add_property(F("elapsed"), static_cast<int>(autotune.get_elapsed(millis()) / 1000), true);
+    json.add_property(F("ku"), autotune.get_ultimate_gain(), true);
+    json.add_property(F("tu"), autotune.get_ultimate_period(), false);
+    json.add(F("},\"warmup\":{\"state\":\""));
+    json.add(WarmupController::get_state_name(warmup.get_state()));
+    json.add(F("\","));
+    json.add_property(F("enabled"), settings.is_warmup(), true);
+    json.add_property(F("deadTime"), warmup.get_model().get_dead_time(), true);
+    json.add_property(F("rate"), warmup.get_model().get_rate(), true);
+    json.add_property(F("loss"), warmup.get_model().get_loss(), true);
+    json.add_property(F("ambient"), warmup.get_model().get_ambient(), false);
+    json.add(F("},\"settings\":{"));
+    json.add_property(F("pending"), journal.is_pending(), true);
+    json.add_property(F("saves"), static_cast<int>(journal.get_save_count()), false);
+
+    json.add(F("},\"history\": "));
+    create_history_json(json, since);
+    json.add(F("}"));
+}
+
+void WebServer::create_history_json(JsonStream& json, int since) {
+    const Status& status = get_status();
+    const int count = status.get_history_count(since);
+
+    json.add(F("{"));
+    json.add_property(F("window"), HISTORY_SLOT_TIME, true);
     
-    pos = json_add(pos, F("\"sequence\":["));
-    for (int index = 0; index < HISTORY_SIZE; index++) {
-      pos = json_add_array_item(pos, status.get_history(index).sequence, index == 0);
+    json.add(F("\"sequence\":["));
+    for (int index = 0; index < count; index++) {
+      json.add_array_item(status.get_history(index).sequence, index == 0);
     }
 
-    pos = json_add(pos, F("],\"samples\":["));
-    for (int index = 0; index < HISTORY_SIZE; index++) {
-      pos = json_add_array_item(pos, status.get_history(index).samples, index == 0);
+    json.add(F("],\"samples\":["));
+    for (int index = 0; index < count; index++) {
+      json.add_array_item(status.get_history(index).samples, index == 0);
     }
 
-    pos = json_add(pos, F("],\"temperature\":["));
-    for (int index = 0; index < HISTORY_SIZE; index++) {
+    json.add(F("],\"temperature\":["));
+    for (int index = 0; index < count; index++) {
         const StatusHistoryItem& item = status.get_history(index);
-        pos = json_add_counter(pos, item.temperature, index == 0, static_cast<double>(item.samples));
+        json.add_counter(item.temperature, index == 0, item.samples);
     }
 
-    pos = json_add(pos, F("],\"output\":["));
-    for (int index = 0; index < HISTORY_SIZE; index++) {
+    json.add(F("],\"output\":["));
+    for (int index = 0; index < count; index++) {
         const StatusHistoryItem& item = status.get_history(index);
-        pos = json_add_counter(pos, item.output, index == 0, static_cast<double>(item.samples));
+        json.add_counter(item.output, index == 0, item.samples);
     }
 
-    pos = json_add(pos, F("],\"heater\":["));
-    for (int index = 0; index < HISTORY_SIZE; index++) {
+    json.add(F("],\"heater\":["));
+    for (int index = 0; index < count; index++) {
         const StatusHistoryItem& item = status.get_history(index);
-        pos = json_add_counter(pos, item.heater, index == 0, static_cast<double>(item.samples));
+        json.add_counter(item.heater, index == 0, item.samples);
     }
 
-    pos = json_add(pos, F("],\"health\":["));
-    for (int index = 0; index < HISTORY_SIZE; index++) {
+    json.add(F("],\"health\":["));
+    for (int index = 0; index < count; index++) {
         const StatusHistoryItem& item = status.get_history(index);
-        pos = json_add_counter(pos, item.health, index == 0, static_cast<double>(item.samples));
+        json.add_counter(item.health, index == 0, item.samples);
     }
 
-    pos = json_add(pos, F("]}}"));
+    json.add(F("]}"));
+}
+
+void WebServer::create_history_tier_json(JsonStream& json, int tier, int since) {
+    const HistoryTier& history = get_status().get_history_tier(tier);
+    const int count = history.get_count(since);
+
+    json.add(F("{"));
+    json.add_property(F("window"), Status::get_history_tier_slot_time(tier), true);
+
+    json.add(F("\"sequence\":["));
+    for (int index = 0; index < count; index++) {
+        json.add_array_item(history.get_sequence(index), index == 0);
+    }
+
+    json.add(F("],\"samples\":["));
+    for (int index = 0; index < count; index++) {
+        json.add_array_item(history.get(index).samples, index == 0);
+    }
+
+    json.add(F("],\"temperature\":["));
+    for (int index = 0; index < count; index++) {
+        json.add_compact_counter(history.get(index).temperature, index == 0, COMPACT_SCALE_TEMPERATURE);
+    }
+
+    json.add(F("],\"output\":["));
+    for (int index = 0; index < count; index++) {
+        json.add_compact_counter(history.get(index).output, index == 0, COMPACT_SCALE_OUTPUT);
+    }
+
+    json.add(F("],\"heater\":["));
+    for (int index = 0; index < count; index++) {
+        json.add_compact_counter(history.get(index).heater, index == 0, COMPACT_SCALE_HEATER);
+    }
+
+    json.add(F("],\"health\":["));
+    for (int index = 0; index < count; index++) {
+        json.add_compact_counter(history.get(index).health, index == 0, COMPACT_SCALE_HEALTH);
+    }
+
+    json.add(F("]}"));
+}
+
+size_t WebServer::create_status_binary(uint8_t* output, size_t size, int since) {
+    const Settings& settings = get_settings();
+    const Status& status = get_status();
+    const HeaterPID& heater = get_heater();
+    const int count = status.get_history_count(since);
+
+    if (size < STATUS_BINARY_HEADER_SIZE + count * STATUS_BINARY_ITEM_SIZE) {
+        return 0;
+    }
+
+    const uint8_t flags = (settings.is_debug() ? 0x01 : 0x00) | (settings.is_countdown_mode() ? 0x02 : 0x00) | (heater.is_active() ? 0x04 : 0x00);
+
+    uint8_t* pos = output;
+    pos = binary_add_u8(pos, 'B');
+    pos = binary_add_u8(pos, 'B');
+    pos = binary_add_u8(pos, STATUS_BINARY_VERSION);
+    pos = binary_add_u8(pos, static_cast<uint8_t>(count));
+    pos = binary_add_u8(pos, static_cast<uint8_t>(status.heater_mode));
+    pos = binary_add_u8(pos, flags);
+    pos = binary_add_u16(pos, HISTORY_SLOT_TIME);
+    pos = binary_add_i32(pos, get_command_parser().get_security_token());
+    pos = binary_add_string(pos, settings.device_id, array_size(settings.device_id));
+
+    pos = binary_add_milli(pos, status.temperature);
+    pos = binary_add_milli(pos, heater.get_setpoint());
+    pos = binary_add_milli(pos, settings.heater_temperature_low);
+    pos = binary_add_milli(pos, settings.heater_temperature_high);
+
+    pos = binary_add_milli(pos, heater.get_kp());
+    pos = binary_add_milli(pos, heater.get_ki());
+    pos = binary_add_milli(pos, heater.get_kd());
+    pos = binary_add_milli(pos, heater.get_input());
+    pos = binary_add_milli(pos, heater.get_output());
+    pos = binary_add_milli(pos, heater.get_setpoint());
+
+    for (int index = 0; index < count; index++) {
+        const StatusHistoryItem& item = status.get_history(index);
+        pos = binary_add_i32(pos, item.sequence);
+        pos = binary_add_u16(pos, static_cast<uint16_t>(item.samples));
+        pos = binary_add_u16(pos, 0);
+        pos = binary_add_counter(pos, item.temperature, item.samples);
+        pos = binary_add_counter(pos, item.output, item.samples);
+        pos = binary_add_counter(pos, item.heater, item.samples);
+        pos = binary_add_counter(pos, item.health, item.samples);
+    }
+
+    return static_cast<size_t>(pos - output);
+}
+
+void WebServer::create_metrics_json(JsonStream& json) {
+    const Status& status = get_status();
+    const Scheduler& scheduler = get_scheduler();
+
+    // Upper bucket limits in micros, the last bucket has no upper limit
+    json.add(F("{\"uptime\":"));
+    json.add(static_cast<int>(millis() / 1000));
+    json.add(F(",\"wifi_connects\":"));
+    json.add(static_cast<int>(get_webserver().get_connect_count()));
+    json.add(F(",\"sensor_errors\":"));
+    json.add(static_cast<int>(get_temperature_sensor().get_error_count()));
+    json.add(F(",\"bounds\":["));
+    for (int index = 0; index < LATENCY_BUCKETS - 1; index++) {
+        json.add_array_item(static_cast<int>(LatencyHistogram::get_bucket_limit(index)), index == 0);
+    }
+
+    json.add(F("],\"stages\":{"));
+    for (int stage = 0; stage < STAGE_COUNT; stage++) {
+        const LatencyHistogram& latency = status.get_stage_latency(static_cast<LoopStage>(stage));
+        if (stage > 0) {
+            json.add(F(","));
+        }
+
+        json.add(F("\""));
+        json.add(Status::get_stage_name(static_cast<LoopStage>(stage)));
+        json.add(F("\":{"));
+        json.add_property(F("count"), static_cast<int>(latency.count), true);
+        json.add_property(F("max"), static_cast<int>(latency.max), true);
+        json.add_property(F("missed"), static_cast<int>(scheduler.get_missed(static_cast<LoopStage>(stage))), true);
+        json.add(F("\"histogram\":["));
+        for (int index = 0; index < LATENCY_BUCKETS; index++) {
+            json.add_array_item(static_cast<int>(latency.buckets[index]), index == 0);
+        }
+        json.add(F("]}"));
+    }
+
+    json.add(F("}}"));
+}
+
+
+
+#if !WEBSERVER_ASYNC
+// Pushes a status frame to the /events streams when a history slot was closed or the heater mode changed. The frame is the
+// status json with the slots since the last frame, so the slot that was still filling up is sent again with its final values
+void WebServer::push_events() {
+    int clients = 0;
+    for (WiFiClient& client : event_clients) {
+        clients += client.connected() ? 1 : 0;
+    }
+
+    if (clients == 0) {
+        this->event_sequence = -1;
+        return;
+    }
+
+    const Status& status = get_status();
+    const int sequence = status.get_history(0).sequence;
+    if (sequence == this->event_sequence && status.heater_mode == this->event_heater_mode) {
+        return;
+    }
+
+    event_frame_size = 0;
+    append_event_frame("data: ", 6);
+    JsonStream json(WebServer::stream_buffer, array_size(WebServer::stream_buffer), append_event_frame);
+    create_status_json(json, this->event_sequence);
+    json.flush();
+    append_event_frame("\n\n", 2);
+
+    // The sequence stays, so the next try carries the complete history again
+    if (event_frame_size > EVENT_FRAME_SIZE) {
+        Serial.printf("WebServer::push_events Frame of %u bytes is too large\n", static_cast<unsigned>(event_frame_size));
+        return;
+    }
+
+    this->event_sequence = sequence;
+    this->event_heater_mode = status.heater_mode;
+
+    // Writing must not block the loop, a client that can not take the frame is dropped. The browser reconnects and
+    // gets the complete history again
+    for (WiFiClient& client : event_clients) {
+        if (!client.connected()) {
+            continue;
+        }
+
+        if (client.availableForWrite() < static_cast<int>(event_frame_size)) {
+            client.stop();
+            continue;
+        }
+
+        client.write(reinterpret_cast<const uint8_t*>(event_frame), event_frame_size);
+    }
+}
+#endif
+
+bool WebServer::execute_command_json(char* command) {
+    char output[128];
+    output[0] = output[array_size(output) - 1] = 0x00;
+
+    Serial.println(F("Executing web command:"));
+    Serial.println(command);
+    bool success = get_command_parser().execute(command, true, output, array_size(output));
+
+    // Build json from result (reuse command buffer)
+    char* pos = command;
+    pos = json_add(pos, F("{"));
+    pos = json_add_property(pos, F("success"), success, true);
+    pos = json_add_property(pos, F("message"), output, false);
+    pos = json_add(pos, F("}"));
     *pos = 0x00;
+
+    Serial.println(command);
+    return success;
 }
 
+#if WEBSERVER_ASYNC
+///////////////////////////////////////////////////////////////////////////////////
+// Handlers of the async backend, they answer from the callbacks of the tcp stack
+
+// /status is generated into the response buffer in one go
+static_assert(ASYNC_HTTP_BODY_SIZE >= STATUS_JSON_MAX_SIZE, "The response buffer has to take the largest /status");
+
+void WebServer::on_async_index(AsyncHttpConnection& connection) {
+    char etag[24];
+    char accept_encoding[64];
+    connection.add_header(F("ETag"), WebServer::webpage_index_etag);
+    connection.add_header(F("Cache-Control"), F("no-cache"));
+    connection.add_header(F("Vary"), F("Accept-Encoding"));
+    if (connection.get_header("If-None-Match", etag, array_size(etag)) && strcmp_P(etag, reinterpret_cast<PGM_P>(WebServer::webpage_index_etag)) == 0) {
+        connection.send(304, F("text/html; charset=utf-8"));
+        return;
+    }
+
+    if (!connection.get_header("Accept-Encoding", accept_encoding, array_size(accept_encoding)) || !accepts_gzip(accept_encoding)) {
+        connection.send(406, F("text/plain"), "The page is only available gzip compressed");
+        return;
+    }
+
+    connection.add_header(F("Content-Encoding"), F("gzip"));
+    connection.send_P(200, F("text/html; charset=utf-8"), reinterpret_cast<PGM_P>(WebServer::webpage_index_content), WebServer::webpage_index_size);
+}
+
+void WebServer::on_async_status(AsyncHttpConnection& connection) {
+    // Only allow CORS in debug mode
+    if (get_settings().is_debug()) {
+        connection.add_header(F("Access-Control-Allow-Origin"), F("*"));
+    }
+
+    WebServer::async_connection = &connection;
+    JsonStream json(WebServer::stream_buffer, array_size(WebServer::stream_buffer), write_async_chunk);
+    create_status_json(json, get_async_since_argument(connection));
+    json.flush();
+    WebServer::async_connection = nullptr;
+
+    connection.send(200, F("application/json"));
+}
+
+void WebServer::on_async_status_binary(AsyncHttpConnection& connection) {
+    // Only allow CORS in debug mode
+    if (get_settings().is_debug()) {
+        connection.add_header(F("Access-Control-Allow-Origin"), F("*"));
+    }
+
+    uint8_t buffer[STATUS_BINARY_HEADER_SIZE + HISTORY_SIZE * STATUS_BINARY_ITEM_SIZE];
+    const size_t size = create_status_binary(buffer, array_size(buffer), get_async_since_argument(connection));
+    connection.write(reinterpret_cast<const char*>(buffer), size);
+    connection.send(200, F("application/octet-stream"));
+}
+
+void WebServer::on_async_command(AsyncHttpConnection& connection) {
+    // Only allow CORS in debug mode
+    if (get_settings().is_debug()) {
+        connection.add_header(F("Access-Control-Allow-Origin"), F("*"));
+        connection.add_header(F("Access-Control-Allow-Allow-Method"), F("POST, OPTIONS"));
+        connection.add_header(F("Access-Control-Allow-Headers"), F("X-Requested-With, Content-Type"));
+    }
+
+    if (connection.get_method() == HttpMethod::options) {
+        connection.send(204, F("text/plain"));
+        return;
+    }
+
+    char command[256];
+    command[0] = command[array_size(command) - 1] = 0x00;
+    strncpy(command, connection.get_body(), array_size(command) - 1);
+
+    const bool success = execute_command_json(command);
+    connection.send(success ? 200 : 400, F("application/json"), command);
+}
+
+void WebServer::on_async_batch(AsyncHttpConnection& connection) {
+    // Only allow CORS in debug mode
+    if (get_settings().is_debug()) {
+        connection.add_header(F("Access-Control-Allow-Origin"), F("*"));
+        connection.add_header(F("Access-Control-Allow-Allow-Method"), F("POST, OPTIONS"));
+        connection.add_header(F("Access-Control-Allow-Headers"), F("X-Requested-With, Content-Type"));
+    }
+
+    if (connection.get_method() == HttpMethod::options) {
+        connection.send(204, F("text/plain"));
+        return;
+    }
+
+    char commands[512];
+    commands[0] = commands[array_size(commands) - 1] = 0x00;
+    strncpy(commands, connection.get_body(), array_size(commands) - 1);
+
+    // Like the synchronous route the status code does not depend on the results
+    WebServer::async_connection = &connection;
+    JsonStream json(WebServer::stream_buffer, array_size(WebServer::stream_buffer), write_async_chunk);
+    get_command_parser().execute_batch(commands, json);
+    json.flush();
+    WebServer::async_connection = nullptr;
+
+    connection.send(200, F("application/json"));
+}
+
+// Optional "since" query argument of the history endpoints, without it the complete history is sent
+int WebServer::get_async_since_argument(AsyncHttpConnection& connection) {
+    char since[12];
+    return connection.get_argument("since", since, array_size(since)) ? atoi(since) : -1;
+}
+
+void WebServer::write_async_chunk(const char* data, size_t size) {
+    WebServer::async_connection->write(data, size);
+}
+
+AsyncHttpConnection* WebServer::async_connection = nullptr;
+
+///////////////////////////////////////////////////////////////////////////////////
+#endif
+
+void WebServer::send_chunk(const char* data, size_t size) {
+    server.sendContent(data, size);
+}
+
+// Optional "since" query argument of the history endpoints, without it the complete history is sent
+int WebServer::get_since_argument() {
+    return server.hasArg(F("since")) ? atoi(server.arg(F("since")).c_str()) : -1;
+}
+
+int WebServer::get_tier_argument() {
+    const int tier = server.hasArg(F("tier")) ? atoi(server.arg(F("tier")).c_str()) : 0;
+    return tier >= 0 && tier <= HISTORY_TIER_COUNT ? tier : 0;
+}
 
+char WebServer::stream_buffer[256];
 
 WebServer& get_webserver() {
     static WebServer instance;
@@ -2,28 +2,132 @@
 
 #include <Arduino.h>
 
+#include "util.h"
+#include "Status.h"
+#include "AsyncHttpServer.h"
+
+/*
+    Layout of /status.bin (little endian, doubles as int32 milli units):
+        u8[2] magic "BB", u8 version, u8 history count, u8 heater mode (off, low, high), u8 flags (1 debug,
+        2 countdown mode, 4 heater active), u16 history window (ms), i32 token, char[16] id,
+        i32 temperature current/target/low/high, i32 pid kp/ki/kd/input/output/setpoint
+    followed by the history items (newest first):
+        i32 sequence, u16 samples, u16 reserved, 4 x i32 current/min/max/average for temperature/output/heater/health
+*/
+constexpr uint8_t STATUS_BINARY_VERSION = 1;
+constexpr size_t STATUS_BINARY_HEADER_SIZE = 68;
+constexpr size_t STATUS_BINARY_ITEM_SIZE = 72;
+
+// A connection attempt is abandoned after the timeout, the retries wait twice as long each time up to the maximum
+constexpr unsigned long WIFI_CONNECT_TIMEOUT = 30000;
+constexpr unsigned long WIFI_RETRY_MIN_DELAY = 1000;
+constexpr unsigned long WIFI_RETRY_MAX_DELAY = 60000;
+
+// Largest /status json. The complete history with autotune and warm-up is about 1100 bytes, test-status-history
+// checks it with saturated history values (about 1200 bytes)
+constexpr size_t STATUS_JSON_MAX_SIZE = 1536;
+
+// Open /events streams and the largest status frame pushed to them, "data: " and the blank line frame the json
+constexpr int EVENT_MAX_CLIENTS = 3;
+constexpr size_t EVENT_FRAME_SIZE = STATUS_JSON_MAX_SIZE + 8;
+
+enum class WifiState : uint8_t {
+    idle,       // No credentials, the web server is not started
+    connecting,
+    connected,
+    waiting     // Backoff before the next attempt
+};
+
 class WebServer {
 public:
     WebServer();
     WebServer(const WebServer&) = delete;
     WebServer& operator=(const WebServer&) = delete;
 
-    bool connect(const char* hostname, const char* ssid, const char* password, int timeout);
+    // Starts connecting in the background, serve() drives the connection and reconnects if the wifi is lost
+    bool begin(const char* hostname, const char* ssid, const char* password);
 
     void serve();
 
+    WifiState get_wifi_state() const;
+    unsigned long get_connect_count() const;
+
     void get_ip(char* output, size_t size) const;
 
+    // Public for the host benchmark, the device only calls them from the serve handlers
+    // The history contains only the slots with a sequence >= since, see Status::get_history_count
+    static void create_status_json(JsonStream& json, int since);
+    static void create_history_json(JsonStream& json, int since);
+    static void create_history_tier_json(JsonStream& json, int tier, int since);
+    static void create_metrics_json(JsonStream& json);
+    static size_t create_status_binary(uint8_t* output, size_t size, int since);
+
 private:
+    void update_connection();
+    void start_attempt();
+    void set_wifi_state(WifiState state);
+
+    const char* ssid;
+    const char* password;
+    WifiState wifi_state;
+    unsigned long state_start;
+    unsigned long retry_delay;
+    unsigned long connect_count;
+    bool routes_registered;
+
+#if !WEBSERVER_ASYNC
+    // The async backend has no /events
+    void push_events();
+
+    // State of the last /events frame, a new frame is pushed when one of them changes
+    int event_sequence;
+    HeaterMode event_heater_mode;
+#endif
+
     static void on_serve_index();
     static void on_serve_status();
+    static void on_serve_status_binary();
+    static void on_serve_history();
+    static void on_serve_metrics();
     static void on_serve_command();
+    static void on_serve_batch();
+#if !WEBSERVER_ASYNC
+    static void on_serve_events();
+#endif
     static void on_serve_not_found();
 
-    static void create_status_json(char* output, size_t size);
-    
-    // This will be injected by the index/html/js/css script into the "WebServer_index.cpp" file
-    static const __FlashStringHelper* webpage_index_content;
+    static void register_routes();
+    static void start_server();
+    static void stop_server();
+
+#if WEBSERVER_ASYNC
+    static void on_async_index(AsyncHttpConnection& connection);
+    static void on_async_status(AsyncHttpConnection& connection);
+    static void on_async_status_binary(AsyncHttpConnection& connection);
+    static void on_async_command(AsyncHttpConnection& connection);
+    static void on_async_batch(AsyncHttpConnection& connection);
+    static int get_async_since_argument(AsyncHttpConnection& connection);
+    static void write_async_chunk(const char* data, size_t size);
+
+    // Target of write_async_chunk, the callbacks of the tcp stack do not run concurrently
+    static AsyncHttpConnection* async_connection;
+#endif
+
+    // Executes the command in the buffer and replaces it with the json result, the buffer needs to be larger than 128 bytes
+    static bool execute_command_json(char* command);
+
+    static void send_chunk(const char* data, size_t size);
+    static int get_since_argument();
+    static int get_tier_argument();
+
+    // Chunk buffer for streamed responses, requests are served one after another so it is shared
+    static char stream_buffer[256];
+
+    // This will be injected by the index/html/js/css script into the "WebServer_index.cpp" file. The page is gzip
+    // compressed, the etag is a hash of it (quoted)
+    static const uint8_t* webpage_index_content;
+    static const size_t webpage_index_size;
+    static const __FlashStringHelper* webpage_index_etag;
 };
 
 // Use this function to get the webserver instance it MUST be a singleton since the serving methods rely on that
@@ -1,21 +1,508 @@
-﻿#include "WebServer.h"
+#include "WebServer.h"
 
 #include <sys/pgmspace.h>
 
-static const char webpage_index_local[] PROGMEM = R"###(
-<!DOCTYPE html><html><head><meta charset="utf-8"><title>Gaggia Black Betty</title><script>parcelRequire=function(e,r,t,n){var i,o="function"==typeof parcelRequire&&parcelRequire,u="function"==typeof require&&require;function f(t,n){if(!r[t]){if(!e[t]){var i="function"==typeof parcelRequire&&parcelRequire;if(!n&&i)return i(t,!0);if(o)return o(t,!0);if(u&&"string"==typeof t)return u(t);var c=new Error("Cannot find module '"+t+"'");throw c.code="MODULE_NOT_FOUND",c}p.resolve=function(r){return e[t][1][r]||r},p.cache={};var l=r[t]=new f.Module(t);e[t][0].call(l.exports,p,l,l.exports,this)}return r[t].exports;function p(e){return f(p.resolve(e))}}f.isParcelRequire=!0,f.Module=function(e){this.id=e,this.bundle=f,this.exports={}},f.modules=e,f.cache=r,f.parent=o,f.register=function(r,t){e[r]=[function(e,r){r.exports=t},{}]};for(var c=0;c<t.length;c++)try{f(t[c])}catch(e){i||(i=e)}if(t.length){var l=f(t[t.length-1]);"object"==typeof exports&&"undefined"!=typeof module?module.exports=l:"function"==typeof define&&define.amd?define(function(){return l}):n&&(this[n]=l)}if(parcelRequire=f,i)throw i;return f}({"PHZP":[function(require,module,exports) {
-"use strict";var e=this&&this.__awaiter||function(e,t,r,n){return new(r||(r=Promise))(function(o,i){function s(e){try{a(n.next(e))}catch(t){i(t)}}function u(e){try{a(n.throw(e))}catch(t){i(t)}}function a(e){var t;e.done?o(e.value):(t=e.value,t instanceof r?t:new r(function(e){e(t)})).then(s,u)}a((n=n.apply(e,t||[])).next())})},t=this&&this.__generator||function(e,t){var r,n,o,i,s={label:0,sent:function(){if(1&o[0])throw o[1];return o[1]},trys:[],ops:[]};return i={next:u(0),throw:u(1),return:u(2)},"function"==typeof Symbol&&(i[Symbol.iterator]=function(){return this}),i;function u(i){return function(u){return function(i){if(r)throw new TypeError("Generator is already executing.");for(;s;)try{if(r=1,n&&(o=2&i[0]?n.return:i[0]?n.throw||((o=n.return)&&o.call(n),0):n.next)&&!(o=o.call(n,i[1])).done)return o;switch(n=0,o&&(i=[2&i[0],o.value]),i[0]){case 0:case 1:o=i;break;case 4:return s.label++,{value:i[1],done:!1};case 5:s.label++,n=i[1],i=[0];continue;case 7:i=s.ops.pop(),s.trys.pop();continue;default:if(!(o=(o=s.trys).length>0&&o[o.length-1])&&(6===i[0]||2===i[0])){s=0;continue}if(3===i[0]&&(!o||i[1]>o[0]&&i[1]<o[3])){s.label=i[1];break}if(6===i[0]&&s.label<o[1]){s.label=o[1],o=i;break}if(o&&s.label<o[2]){s.label=o[2],s.ops.push(i);break}o[2]&&s.ops.pop(),s.trys.pop();continue}i=t.call(e,s)}catch(u){i=[6,u],n=0}finally{r=o=0}if(5&i[0])throw i[1];return{value:i[0]?i[1]:void 0,done:!0}}([i,u])}}};function r(e){return"http://localhost:8080"===window.origin?"http://esp-grey"+e:window.origin+e}function n(e,t){var r=4*e;return{current:t[r],min:t[r+1],max:t[r+2],average:t[r+3]}}function o(o){return e(this,void 0,Promise,function(){var e,i,s,u,a,c;return t(this,function(t){switch(t.label){case 0:return[4,window.fetch(r("/status"),{method:"GET"})];case 1:return[4,t.sent().json()];case 2:for(e=t.sent(),i={id:e.id,token:e.token,isDebug:e.isDebug,isCountdownMode:e.isCountdownMode,temperature:e.temperature,pid:e.pid,heater:e.heater,window:e.window||1e3,history:[]},s=e.history.samples.length,u=0;u<s;u++)i.history.push({sequence:e.history.sequence[u],samples:e.history.samples[u],temperature:n(u,e.history.temperature),output:n(u,e.history.output),heater:n(u,e.history.heater),health:n(u,e.history.health)});return null!=o&&(a=i.history.map(function(e){return e.sequence}),(c=i.history).push.apply(c,o.history.filter(function(e){return-1===a.indexOf(e.sequence)}))),i.history=i.history.slice(0,120),[2,i]}})})}Object.defineProperty(exports,"__esModule",{value:!0}),exports.getStatus=exports.getApiUri=void 0,exports.getApiUri=r,exports.getStatus=o;
-},{}],"mAKB":[function(require,module,exports) {
-"use strict";var e=this&&this.__awaiter||function(e,t,n,r){return new(n||(n=Promise))(function(o,u){function a(e){try{i(r.next(e))}catch(t){u(t)}}function c(e){try{i(r.throw(e))}catch(t){u(t)}}function i(e){var t;e.done?o(e.value):(t=e.value,t instanceof n?t:new n(function(e){e(t)})).then(a,c)}i((r=r.apply(e,t||[])).next())})},t=this&&this.__generator||function(e,t){var n,r,o,u,a={label:0,sent:function(){if(1&o[0])throw o[1];return o[1]},trys:[],ops:[]};return u={next:c(0),throw:c(1),return:c(2)},"function"==typeof Symbol&&(u[Symbol.iterator]=function(){return this}),u;function c(u){return function(c){return function(u){if(n)throw new TypeError("Generator is already executing.");for(;a;)try{if(n=1,r&&(o=2&u[0]?r.return:u[0]?r.throw||((o=r.return)&&o.call(r),0):r.next)&&!(o=o.call(r,u[1])).done)return o;switch(r=0,o&&(u=[2&u[0],o.value]),u[0]){case 0:case 1:o=u;break;case 4:return a.label++,{value:u[1],done:!1};case 5:a.label++,r=u[1],u=[0];continue;case 7:u=a.ops.pop(),a.trys.pop();continue;default:if(!(o=(o=a.trys).length>0&&o[o.length-1])&&(6===u[0]||2===u[0])){a=0;continue}if(3===u[0]&&(!o||u[1]>o[0]&&u[1]<o[3])){a.label=u[1];break}if(6===u[0]&&a.label<o[1]){a.label=o[1],o=u;break}if(o&&a.label<o[2]){a.label=o[2],a.ops.push(u);break}o[2]&&a.ops.pop(),a.trys.pop();continue}u=t.call(e,a)}catch(c){u=[6,c],r=0}finally{n=o=0}if(5&u[0])throw u[1];return{value:u[0]?u[1]:void 0,done:!0}}([u,c])}}};Object.defineProperty(exports,"__esModule",{value:!0}),exports.execute=void 0;var n=require("./Status");function r(r,o){return e(this,void 0,Promise,function(){var e,u,a,c;return t(this,function(t){switch(t.label){case 0:e="TOKEN "+r.getToken()+" "+o,t.label=1;case 1:return t.trys.push([1,4,,5]),[4,window.fetch(n.getApiUri("/command"),{method:"POST",body:e})];case 2:return[4,t.sent().json()];case 3:return u=t.sent(),a=u.success,c=u.message,r.notify(a?"Successfully executed command":"Error executing command",c),[3,5];case 4:return t.sent(),[3,5];case 5:return[2]}})})}exports.execute=r;
-},{"./Status":"PHZP"}],"tmWP":[function(require,module,exports) {
-"use strict";var t=this&&this.__assign||function(){return(t=Object.assign||function(t){for(var e,i=1,n=arguments.length;i<n;i++)for(var o in e=arguments[i])Object.prototype.hasOwnProperty.call(e,o)&&(t[o]=e[o]);return t}).apply(this,arguments)};Object.defineProperty(exports,"__esModule",{value:!0}),exports.HistoryGraph=void 0;var e=function(){function e(e,i,n){this.element=window.document.getElementById("graph-"+e),this.property=e,this.axisInfo=t({},n);var o=parseInt(i,16);this.color={r:o>>16&255,g:o>>8&255,b:255&o}}return e.prototype.getColor=function(t){return void 0===t&&(t=1),"rgba("+[this.color.r,this.color.g,this.color.b,t].join(",")+")"},e.prototype.resize=function(){var t=this.element.getBoundingClientRect(),e=t.width,i=t.height;this.element.width=e,this.element.height=i;var n=this.element.getBoundingClientRect();e==n.width&&i==n.height||(this.element.width+=e-n.width,this.element.height=i-n.height)},e.prototype.line=function(t,e,i,n,o){t.beginPath(),t.moveTo(e,i),t.lineTo(n,o),t.stroke()},e.prototype.update=function(t,e,i){var n,o=this,r=null===(n=this.element)||void 0===n?void 0:n.getContext("2d");if(null!=r&&null!=t){this.resize();var h={left:48,bottom:20,width:this.element.width-48,fullWidth:this.element.width,height:this.element.height-20,min:this.axisInfo.min,max:this.axisInfo.max},l=[];t.history.slice(0,e).forEach(function(t){var e=t[o.property];h.min=Math.min(h.min,e.min),h.max=Math.max(h.max,e.max),l.push(e)});for(var a={x:[],xy1:h.height,xy2:0,y:[],yx1:h.left,yx2:h.fullWidth},s=0;s<e;s++)a.x.push({x:c(s),label:(-s*t.window/1e3).toFixed(1)+"s"});for(s=Math.floor(h.min/this.axisInfo.yStep)*this.axisInfo.yStep;s<h.max;s+=this.axisInfo.yStep)a.y.push({y:x(s),label:s+this.axisInfo.unit});r.clearRect(0,0,this.element.width,this.element.height),r.lineWidth=1,r.strokeStyle="rgba(32, 32, 32, 0.10)",a.x.forEach(function(t,e){e%i==0&&o.line(r,t.x,a.xy1,t.x,a.xy2)}),a.y.forEach(function(t){return o.line(r,a.yx1,t.y,a.yx2,t.y)}),r.font="16px sans-serif",r.strokeStyle=r.fillStyle="rgb(32, 32, 32)",this.line(r,c(0),x(0),c(e-1),x(0)),this.line(r,c(e-1),x(h.min),c(e-1),x(h.max)),r.textAlign="center",a.x.forEach(function(t,e){e%i==0&&r.fillText(t.label,t.x,a.xy1+16)}),r.textAlign="right",a.y.forEach(function(t){return r.fillText(t.label,a.yx1-4,t.y)});var f=l[0];r.fillStyle=this.getColor(.15),r.beginPath(),r.moveTo(c(0),x(f.max)),l.forEach(function(t,e){r.lineTo(c(e),x(t.max))}),l.slice().reverse().forEach(function(t,e){r.lineTo(c(l.length-e-1),x(t.min))}),r.fill(),r.strokeStyle=this.getColor(.5),r.beginPath(),r.moveTo(c(0),x(f.average)),l.forEach(function(t,e){r.lineTo(c(e),x(t.average))}),r.stroke(),r.strokeStyle=this.getColor(),r.lineWidth=2,r.beginPath(),r.moveTo(c(0),x(f.current)),l.forEach(function(t,e){r.lineTo(c(e),x(t.current))}),r.stroke(),r.font="12px sans-serif",r.textAlign="center",r.strokeStyle=r.fillStyle="rgb(32, 32, 32)",l.forEach(function(t,e){if(e%i==0){var n=c(e),h=x(t.current);r.beginPath(),r.arc(n,h,3,0,2*Math.PI),r.fill(),r.fillText(t.current.toFixed(2)+o.axisInfo.unit,n,h-10)}})}function c(t){var i=(e-t-1)/(e-1)*h.width;return h.left+Math.floor(Math.max(0,Math.min(h.width,i)))+.5}function x(t){var e=h.height-(t-h.min)/(h.max-h.min)*h.height;return Math.floor(Math.max(0,Math.min(h.height,e)))+.5}},e}();exports.HistoryGraph=e;
-},{}],"wj0t":[function(require,module,exports) {
-"use strict";var t=this&&this.__awaiter||function(t,e,n,i){return new(n||(n=Promise))(function(s,r){function o(t){try{a(i.next(t))}catch(e){r(e)}}function u(t){try{a(i.throw(t))}catch(e){r(e)}}function a(t){var e;t.done?s(t.value):(e=t.value,e instanceof n?e:new n(function(t){t(e)})).then(o,u)}a((i=i.apply(t,e||[])).next())})},e=this&&this.__generator||function(t,e){var n,i,s,r,o={label:0,sent:function(){if(1&s[0])throw s[1];return s[1]},trys:[],ops:[]};return r={next:u(0),throw:u(1),return:u(2)},"function"==typeof Symbol&&(r[Symbol.iterator]=function(){return this}),r;function u(r){return function(u){return function(r){if(n)throw new TypeError("Generator is already executing.");for(;o;)try{if(n=1,i&&(s=2&r[0]?i.return:r[0]?i.throw||((s=i.return)&&s.call(i),0):i.next)&&!(s=s.call(i,r[1])).done)return s;switch(i=0,s&&(r=[2&r[0],s.value]),r[0]){case 0:case 1:s=r;break;case 4:return o.label++,{value:r[1],done:!1};case 5:o.label++,i=r[1],r=[0];continue;case 7:r=o.ops.pop(),o.trys.pop();continue;default:if(!(s=(s=o.trys).length>0&&s[s.length-1])&&(6===r[0]||2===r[0])){o=0;continue}if(3===r[0]&&(!s||r[1]>s[0]&&r[1]<s[3])){o.label=r[1];break}if(6===r[0]&&o.label<s[1]){o.label=s[1],s=r;break}if(s&&o.label<s[2]){o.label=s[2],o.ops.push(r);break}s[2]&&o.ops.pop(),o.trys.pop();continue}r=e.call(t,o)}catch(u){r=[6,u],i=0}finally{n=s=0}if(5&r[0])throw r[1];return{value:r[0]?r[1]:void 0,done:!0}}([r,u])}}};Object.defineProperty(exports,"__esModule",{value:!0}),exports.AppUI=void 0;var n=require("./Status"),i=require("./Command"),s=require("./HistoryGraph"),r=function(){function r(){this.status=null,this.graphs=[],this.active=!0}return r.prototype.init=function(){var n=this;this.graphs.push(new s.HistoryGraph("temperature","ff0000",{min:30,max:150,yStep:10,unit:"℃"})),this.graphs.push(new s.HistoryGraph("output","0000ff",{min:-5,max:200,yStep:50,unit:""})),this.graphs.push(new s.HistoryGraph("heater","00ff00",{min:0,max:1,yStep:.25,unit:""})),this.graphs.push(new s.HistoryGraph("health","ffa000",{min:0,max:50,yStep:10,unit:"ms"})),this.on("overview-toggleEnable","click",function(){return t(n,void 0,void 0,function(){return e(this,function(t){switch(t.label){case 0:return null==this.status?[3,2]:[4,i.execute(this,"SET heater.enabled "+("off"===this.status.heater.mode?"true":"false"))];case 1:t.sent(),t.label=2;case 2:return[2]}})})}),this.on("setting-open","click",function(){return t(n,void 0,void 0,function(){var t,n;return e(this,function(e){return null!=(t=this.get("setting-panel"))&&null!=this.status&&((n=this.setText.bind(this))("setting-temperature-low",this.status.temperature.low),n("setting-temperature-high",this.status.temperature.high),n("setting-pid-kp",this.status.pid.kp),n("setting-pid-ki",this.status.pid.ki),n("setting-pid-kd",this.status.pid.kd),n("setting-toggle-countdown",this.status.isCountdownMode?"Disable Countdown":"Enable Countdown"),t.classList.remove("slide-out"),t.classList.add("slide-in")),[2]})})}),this.on("setting-close","click",function(){var t=n.get("setting-panel");null!=t&&(t.classList.remove("slide-in"),t.classList.add("slide-out"))}),this.on("setting-apply-temperature","click",function(){return t(n,void 0,void 0,function(){var t,n;return e(this,function(e){switch(e.label){case 0:return t=parseFloat(this.getText("setting-temperature-low")),n=parseFloat(this.getText("setting-temperature-high")),[4,i.execute(this,"SET heater "+t+" "+n)];case 1:return e.sent(),[2]}})})}),this.on("setting-apply-pid","click",function(){return t(n,void 0,void 0,function(){var t,n,s;return e(this,function(e){switch(e.label){case 0:return null==this.status?[3,2]:(t=parseFloat(this.getText("setting-pid-kp")),n=parseFloat(this.getText("setting-pid-ki")),s=parseFloat(this.getText("setting-pid-kd")),[4,i.execute(this,"SET pid "+t+" "+n+" "+s)]);case 1:e.sent(),e.label=2;case 2:return[2]}})})}),this.on("setting-toggle-countdown","click",function(){return t(n,void 0,void 0,function(){var t;return e(this,function(e){switch(e.label){case 0:return null==this.status?[3,2]:(t=!this.status.isCountdownMode,[4,i.execute(this,"SET countdown_mode "+t.toString())]);case 1:e.sent(),this.setText("setting-toggle-countdown",t?"Disable Countdown":"Enable Countdown"),e.label=2;case 2:return[2]}})})}),this.on("setting-save","click",function(){return t(n,void 0,void 0,function(){return e(this,function(t){switch(t.label){case 0:return[4,i.execute(this,"SAVE")];case 1:return t.sent(),[2]}})})}),this.on("setting-restart","click",function(){return t(n,void 0,void 0,function(){return e(this,function(t){switch(t.label){case 0:return[4,i.execute(this,"RESTART")];case 1:return t.sent(),[2]}})})}),window.addEventListener("blur",function(){n.active=!1}),window.addEventListener("focus",function(){n.active=!0});var r=this.get("notify-panel");null!=r&&(r.style.display="none")},r.prototype.update=function(){return t(this,void 0,Promise,function(){var t,i,s,r,o,u,a=this;return e(this,function(e){switch(e.label){case 0:return this.active?(t=this,[4,n.getStatus(this.status)]):[2];case 1:return t.status=e.sent(),null==this.status?[2]:(i=this.status,s=i.temperature,r=i.pid,o=i.heater,(u=this.setText.bind(this))("overview-temperature",s.current.toFixed(3)),u("overview-mode",o.mode),u("overview-toggleEnable","off"===o.mode?"Enable":"Disable"),u("temperature-current",s.current),u("temperature-target",s.target),u("temperature-low",s.low.toFixed(1)),u("temperature-high",s.high.toFixed(1)),u("pid-kp",r.kp.toFixed(3)),u("pid-ki",r.ki.toFixed(3)),u("pid-kd",r.kd.toFixed(3)),u("pid-input",r.input.toFixed(3)),u("pid-output",r.output.toFixed(3)),u("pid-setpoint",r.setpoint.toFixed(3)),u("heater-mode",o.mode),u("heater-active",o.active),this.graphs.forEach(function(t){return t.update(a.status,15,1)}),[2])}})})},r.prototype.getToken=function(){var t;return(null===(t=this.status)||void 0===t?void 0:t.token)||0},r.prototype.notify=function(t,e){var n=this.get("notify-panel");null!=n&&(n.style.display="none",n.classList.remove("fade-out"),this.setText("notify-header",t),this.setText("notify-message",e),window.setTimeout(function(){n.classList.add("fade-out"),n.style.display="block"},5))},r.prototype.get=function(t){return window.document.getElementById(t)},r.prototype.setText=function(t,e){"number"==typeof e?e=e.toString():"boolean"==typeof e&&(e=e.toString());var n=this.get(t);n instanceof HTMLInputElement?n.value=e:n instanceof HTMLElement&&(n.textContent=e)},r.prototype.getText=function(t){var e=this.get(t);return e instanceof HTMLInputElement?e.value||"":e instanceof HTMLElement&&e.textContent||""},r.prototype.on=function(t,e,n){var i;null===(i=this.get(t))||void 0===i||i.addEventListener(e,n)},r}();exports.AppUI=r;
-},{"./Status":"PHZP","./Command":"mAKB","./HistoryGraph":"tmWP"}],"QCba":[function(require,module,exports) {
-"use strict";var e=this&&this.__awaiter||function(e,t,n,r){return new(n||(n=Promise))(function(o,a){function i(e){try{c(r.next(e))}catch(t){a(t)}}function u(e){try{c(r.throw(e))}catch(t){a(t)}}function c(e){var t;e.done?o(e.value):(t=e.value,t instanceof n?t:new n(function(e){e(t)})).then(i,u)}c((r=r.apply(e,t||[])).next())})},t=this&&this.__generator||function(e,t){var n,r,o,a,i={label:0,sent:function(){if(1&o[0])throw o[1];return o[1]},trys:[],ops:[]};return a={next:u(0),throw:u(1),return:u(2)},"function"==typeof Symbol&&(a[Symbol.iterator]=function(){return this}),a;function u(a){return function(u){return function(a){if(n)throw new TypeError("Generator is already executing.");for(;i;)try{if(n=1,r&&(o=2&a[0]?r.return:a[0]?r.throw||((o=r.return)&&o.call(r),0):r.next)&&!(o=o.call(r,a[1])).done)return o;switch(r=0,o&&(a=[2&a[0],o.value]),a[0]){case 0:case 1:o=a;break;case 4:return i.label++,{value:a[1],done:!1};case 5:i.label++,r=a[1],a=[0];continue;case 7:a=i.ops.pop(),i.trys.pop();continue;default:if(!(o=(o=i.trys).length>0&&o[o.length-1])&&(6===a[0]||2===a[0])){i=0;continue}if(3===a[0]&&(!o||a[1]>o[0]&&a[1]<o[3])){i.label=a[1];break}if(6===a[0]&&i.label<o[1]){i.label=o[1],o=a;break}if(o&&i.label<o[2]){i.label=o[2],i.ops.push(a);break}o[2]&&i.ops.pop(),i.trys.pop();continue}a=t.call(e,i)}catch(u){a=[6,u],r=0}finally{n=o=0}if(5&a[0])throw a[1];return{value:a[0]?a[1]:void 0,done:!0}}([a,u])}}};Object.defineProperty(exports,"__esModule",{value:!0});var n=require("./src/AppUI");window.document.addEventListener("DOMContentLoaded",function(){var e=new n.AppUI;e.init();Date.now();window.setInterval(function(){return e.update()},1e3)});
-},{"./src/AppUI":"wj0t"}]},{},["QCba"], null)
-</script><style>body{font-family:sans-serif;font-size:16px;margin:0;color:#0d0d0d}header{padding:16px;color:#f9f9fa;background-color:#0d0d0d;font-size:64px;line-height:64px;box-shadow:0 4px 2px -2px rgba(0,0,0,.6)}header .logo{display:inline-block;text-align:center;width:64px;height:64px}header .logo img{position:relative;top:-8px}h1{margin:0;font-size:32px}#tokeninfo{font-size:18px;color:#404040;float:right}.panel{width:100%;max-width:1024px;margin:16px auto;padding:8px;background-color:#ebe9e1;box-shadow:4px 4px 2px -2px rgba(0,0,0,.6);box-sizing:border-box}.panel .panel-content{display:grid;grid-template-columns:108px 1fr}.graph-wrapper{position:relative;padding-top:50%;height:0}.graph{position:absolute;left:0;top:0;width:100%;height:100%}.overview-grid{display:grid;grid-template-columns:2fr 1fr}.overview .overview-value{font-size:64px;display:inline-block;width:50%;text-align:right}.panel .side-grid div:nth-of-type(odd){font-weight:700}.panel .side-grid div:nth-of-type(2n){padding-bottom:12px}.setting-panel{position:fixed;top:0;left:-50%;width:50%;height:100%;box-shadow:4px 0 2px -2px rgba(0,0,0,.6);background-color:#fff;padding:24px;overflow-y:auto;box-sizing:border-box}.slide-in{animation:slide-in .3s forwards}@keyframes slide-in{to{left:0}}.slide-out{animation:slide-out .3s forwards}@keyframes slide-out{0%{left:0}to{left:-50%}}.wrapper:hover #slide{transition:1s;left:0}#setting-open{cursor:pointer}.setting-close{float:right;cursor:pointer}.setting-panel h2{padding-top:24px}.setting-panel .setting-grid div:nth-of-type(odd){font-size:24px;font-weight:700}.setting-panel .setting-grid div:nth-of-type(2n){padding-bottom:24px}input[type=text]{padding:0 8px;background-color:#f9f9fa;border:1px solid #0d0d0d;width:100%;box-sizing:border-box}button,input[type=text]{height:40px;font-size:24px}button{background-color:#106ebe;color:#f9f9fa;padding:4px 16px;border:0;width:33%;margin:0 0 0 auto;display:block;cursor:pointer}button:hover{background-color:#2080f0}button#setting-restart{background-color:#be4e10}button#setting-restart:hover{background-color:#f06020}.notify-panel{position:fixed;right:16px;bottom:16px;width:384px;height:128px;background-color:#fff;padding:8px;border:1px solid #ebe9e1;box-shadow:4px 4px 2px -2px rgba(0,0,0,.6)}.notify-panel #notify-header{font-weight:700;padding-bottom:12px}.fade-out{animation:fade-out 4s forwards}@keyframes fade-out{0%{opacity:1}75%{opacity:1}to{opacity:0}}
-</style></head><body> <header> <div class="logo" id="setting-open"> <img src="data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAABQAAAAfCAYAAADnTu3OAAAAAXNSR0IArs4c6QAAAARnQU1BAACxjwv8YQUAAAAJcEhZcwAADsMAAA7DAcdvqGQAAANNSURBVEhLnZa7NutBFMZ3chQai07j1lt0GqFUEKWGeAB0KpfqVMIDoFO5PEDkBVwewCUNVdBQoVPNmd93sv9rJHEuvrXGzOz/nj3fvsyOXFdXV7BvolQq2ebmpp2dndny8rJkef39JlZWVmx8fNx6enpsdHRUsr8aRLG7u7uxa8Xb25tm1/mjwYGBATs5ObGdnZ2G5Gu4YSOGfX19YWtrK8RYhMPDwzA/Px+Qn56eah2VpYMsHQ8PD5L7jCwP1Wq1qhv29/ctflSwj4+PbWJiQuP19VV7Ag/rdnCGP9bX13/e39/b1NSUdXZ22urqqrEn0M/Pz9bb25spj42N2dzcnL28vNjd3Z3Nzs7ax8eHjYyM2MHBgXQ6EJbLZRlYW1tTcGF1c3MjZjBOQWavr6+1Pj8/V9mEEOQdZzswhBuuNDk5aTF2+oibHEpB1tE5OjrSvl6v2+DgoAwSkjwHcImbMdDf3y9XgF/i4BLcwwPWjphQGYRcnptIAi6SnGKxaFdXV2LmsXNwEXrv7+9au3cYRzdWxO+yiYfD0tJSDEXQmpGWB6NQKIR4kUqrUqloHd0NMzMzYW9vLzsjgwgRRLY62M4gsrQWh4eHRYA19epn9FLiRi4xey22QxoCdB4fH21jY0Ox9m9ZtyFzfEQxuvApIU9PTy0JcpBhwHdiKIYElZSTPcqATDbDGUQvtU5nkuheySC1RfYWFhZ0I2ybAQMu4yD97+LiQjMyXOdRgKzbUC7c6AdTODuMMSgX4DMPwSGDuEgN4jKHeYopeIJfNYWhoaFPBJQUTwbDg4/rrHGfGFPI/twcEOFbSqCjMeuRcxMKGKOEiC3u8JJ2d3db3jXAqxRZDDnow0uACwi2s/4XyCDxc2b+Y8P+O5BBGBAPjwklROyY/xfZS4EZz44sY5QEETPqjR8qLm123buNuowDgz5oEvEQb16gA7ks1aGB+J5Og8z3Lf85XF5eZk8PliSG2HrJeBl5MZPl7e3trAI+GUSxVqupRFJwCKM0DYBR1iQz/shlctDCEKOeaUANYoA48TPhDQTkcjmL7mrtyOrQQVKgz/CsT09PiwUyWN3e3qrVwboZLQxTkN3Y7m1xcVGsaVO8XS7xdezcDW1g9guTdXCwgupdzgAAAABJRU5ErkJggg=="> </div> <span>Gaggia Black Betty</span> <span id="tokeninfo">0</span> </header> <div class="content"> <div class="panel overview"> <h1>Overview</h1> <div class="overview-grid"> <div class="side-grid"> <div>Current temperature:</div> <div class="overview-value"><span id="overview-temperature"></span>&#8451;</div> </div> <div class="side-grid"> <div>Current Mode:</div> <div class="overview-value"><span id="overview-mode"></span></div> <div> <button id="overview-toggleEnable">Enable</button> </div> </div> </div> </div> <div class="panel temperature"> <h1>Temperature</h1> <div class="panel-content"> <div> <div class="side-grid"> <div>Current:</div><div><span id="temperature-current"></span> &#8451;</div> <div>Target:</div><div><span id="temperature-target"></span> &#8451;</div> <div>Low:</div><div><span id="temperature-low"></span> &#8451;</div> <div>High:</div><div><span id="temperature-high"></span> &#8451;</div> </div> </div> <div class="graph-wrapper"> <canvas class="graph" id="graph-temperature"></canvas> </div> </div> </div> <div class="panel pid"> <h1>PID Status</h1> <div class="panel-content"> <div class="side-grid"> <div>kp:</div><div id="pid-kp"></div> <div>ki:</div><div id="pid-ki"></div> <div>kd:</div><div id="pid-kd"></div> <div>Input:</div><div id="pid-input"></div> <div>Output:</div><div id="pid-output"></div> <div>Setpoint:</div><div id="pid-setpoint"></div> </div> <div class="graph-wrapper"> <canvas class="graph" id="graph-output"></canvas> </div> </div> </div> <div class="panel heater"> <h1>Heater Relay</h1> <div class="panel-content"> <div class="side-grid"> <div>Mode:</div><div id="heater-mode"></div> <div>Active:</div><div id="heater-active"></div> </div> <div class="graph-wrapper"> <canvas class="graph" id="graph-heater"></canvas> </div> </div> </div> <div class="panel heater"> <h1>Health (ms in loop)</h1> <div class="panel-content"> <div></div> <div class="graph-wrapper"> <canvas class="graph" id="graph-health"></canvas> </div> </div> </div> </div> <div id="setting-panel" class="setting-panel"> <h1>Settings<span class="setting-close" id="setting-close">&#10006;</span></h1> <div class="setting-grid"> <h2>Temperature</h2> <div>Low Temperature</div> <div><input type="text" id="setting-temperature-low"></div> <div>High Temperature</div> <div><input type="text" id="setting-temperature-high"></div> <button id="setting-apply-temperature">Apply</button> <h2>PID</h2> <div>kp</div> <div><input type="text" id="setting-pid-kp"></div> <div>ki</div> <div><input type="text" id="setting-pid-ki"></div> <div>kd</div> <div><input type="text" id="setting-pid-kd"></div> <button id="setting-apply-pid">Apply</button> <h2>System</h2> <button id="setting-toggle-countdown" style="float:left;"></button> <button id="setting-save">Save</button> <div style="height:24px">&nbsp;</div> <button id="setting-restart">Restart</button> </div> </div> <div id="notify-panel" class="notify-panel"> <div id="notify-header"></div> <div id="notify-message"></div> </div> </body></html>
-)###";
+// Generated by black-betty-web/Export.mjs (npm run export-node): index.html with the type stripped scripts and the styles inlined, gzip compressed
+// Sources: 4b255e07efc13e0c
+static const uint8_t webpage_index_local[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x3d, 0x69, 0x77, 0xe2, 0xb8,
+    0xb2, 0xdf, 0xf3, 0x2b, 0x34, 0x9e, 0x73, 0xe7, 0x98, 0x0e, 0x8b, 0x0d, 0x59, 0x08, 0x09, 0xf4,
+    0x83, 0x40, 0xb6, 0x4e, 0x42, 0x02, 0x64, 0xed, 0xd7, 0xe7, 0x1e, 0x63, 0x0b, 0x70, 0x62, 0x6c,
+    0xc7, 0x4b, 0x80, 0xcc, 0xe4, 0xbf, 0xbf, 0xa3, 0xc5, 0xb6, 0x6c, 0xcb, 0x40, 0x32, 0x99, 0x7b,
+    0xcf, 0x9b, 0xbe, 0x77, 0x1a, 0xa4, 0x52, 0xa9, 0x54, 0x9b, 0x4a, 0xa5, 0x12, 0x73, 0xf0, 0x5b,
+    0xbb, 0x7b, 0x38, 0x78, 0xb8, 0xea, 0x80, 0x89, 0x37, 0x35, 0x1a, 0x1b, 0x07, 0xe4, 0xaf, 0x8d,
+    0x83, 0x09, 0x54, 0xb4, 0xc6, 0x06, 0x00, 0x00, 0x1c, 0x4c, 0xa1, 0xa7, 0x00, 0x75, 0xa2, 0x38,
+    0x2e, 0xf4, 0xea, 0x82, 0xef, 0x8d, 0x0a, 0x55, 0x01, 0x94, 0x68, 0xa7, 0xa7, 0x7b, 0x06, 0x6c,
+    0x1c, 0x2b, 0xe3, 0xb1, 0xae, 0x80, 0x96, 0xa1, 0xa8, 0xcf, 0xa0, 0x05, 0x3d, 0x6f, 0x71, 0x50,
+    0x22, 0x3d, 0x04, 0xca, 0x55, 0x1d, 0xdd, 0xf6, 0x1a, 0xe2, 0xc8, 0x37, 0x55, 0x4f, 0xb7, 0x4c,
+    0x20, 0xe6, 0xc0, 0x9f, 0x1b, 0x82, 0xef, 0x42, 0xe0, 0x7a, 0x8e, 0xae, 0x7a, 0xc2, 0xfe, 0x46,
+    0xa9, 0x04, 0x5c, 0x47, 0x2d, 0xf5, 0x3d, 0xc5, 0xf3, 0xdd, 0xa2, 0xe7, 0x6e, 0x84, 0xc0, 0x63,
+    0xe8, 0x35, 0x6d, 0xfd, 0xc6, 0xd1, 0x45, 0x5b, 0xf1, 0x26, 0x68, 0x24, 0x42, 0xaa, 0x8f, 0x80,
+    0x38, 0xd3, 0x4d, 0xcd, 0x9a, 0x15, 0x2d, 0x47, 0x1f, 0xeb, 0x26, 0xa8, 0xd7, 0xeb, 0x40, 0x98,
+    0x78, 0x9e, 0x5d, 0x2b, 0x95, 0x0c, 0x4b, 0x55, 0x8c, 0x89, 0xe5, 0x7a, 0xb5, 0xaa, 0x54, 0x95,
+    0x84, 0x60, 0x10, 0xfa, 0xc7, 0x81, 0x9e, 0xef, 0x98, 0x21, 0x24, 0x74, 0xed, 0xc2, 0xd8, 0x81,
+    0x0b, 0x01, 0x6c, 0x02, 0x84, 0x7f, 0x1f, 0x03, 0xbe, 0x6f, 0x30, 0xa0, 0xf1, 0x69, 0x02, 0xb0,
+    0xf7, 0x88, 0x42, 0x38, 0xb7, 0x0d, 0x4b, 0x83, 0xa2, 0x6e, 0x6a, 0x70, 0x9e, 0x07, 0x8a, 0xe3,
+    0x28, 0x8b, 0x60, 0x4a, 0xd5, 0x32, 0x5d, 0x0f, 0x58, 0xa3, 0x91, 0x0b, 0x3d, 0x50, 0x07, 0x18,
+    0x04, 0x7c, 0x03, 0x5b, 0xfb, 0xec, 0x0c, 0x11, 0x75, 0x82, 0xea, 0x3b, 0x0e, 0x34, 0x3d, 0xa1,
+    0x46, 0xd0, 0xfc, 0x24, 0x23, 0x7f, 0xe5, 0x23, 0x88, 0xa9, 0x6e, 0x26, 0x7a, 0xc1, 0x26, 0x90,
+    0x63, 0x10, 0xca, 0x3c, 0x0d, 0x51, 0x66, 0x21, 0x94, 0x57, 0xe8, 0x28, 0x63, 0x98, 0x86, 0xaa,
+    0xfc, 0x22, 0xeb, 0x8f, 0xad, 0xcf, 0xd5, 0x4d, 0x15, 0x5e, 0xfb, 0xd0, 0x59, 0x88, 0x96, 0xa1,
+    0x11, 0x11, 0xb1, 0x72, 0x08, 0x1b, 0x41, 0xbd, 0x0e, 0x4c, 0xdf, 0x30, 0xc0, 0x5f, 0x7f, 0x81,
+    0xb0, 0xb1, 0x38, 0xd1, 0x5d, 0xcf, 0x72, 0x16, 0x45, 0x03, 0x9a, 0x63, 0x6f, 0x82, 0xe5, 0x24,
+    0xf1, 0x24, 0x22, 0x70, 0x78, 0x2f, 0x7c, 0xc7, 0x93, 0xd7, 0x91, 0x78, 0x52, 0x18, 0x7f, 0x4a,
+    0xbf, 0x8a, 0x2e, 0x7c, 0xf1, 0xa1, 0xa9, 0xc2, 0x18, 0xc1, 0x53, 0xe8, 0x8c, 0xe1, 0x09, 0x01,
+    0x12, 0x5d, 0x3c, 0x26, 0x0f, 0x52, 0xa4, 0x13, 0xd1, 0x38, 0xd0, 0xf5, 0x14, 0xc7, 0x83, 0x1a,
+    0xa8, 0x47, 0x20, 0xe0, 0x37, 0xba, 0x90, 0x3f, 0xfe, 0xc8, 0x5e, 0x48, 0x03, 0x48, 0xa8, 0xdf,
+    0x5d, 0xbf, 0x93, 0x25, 0x18, 0x1c, 0xac, 0x5a, 0x50, 0x9a, 0xbd, 0x0c, 0x55, 0xbf, 0x85, 0x74,
+    0xb3, 0xac, 0x24, 0x4b, 0x0a, 0x50, 0xb8, 0xa0, 0x9e, 0xa4, 0x6e, 0xaa, 0xd8, 0xa2, 0xa8, 0x7b,
+    0x70, 0x9a, 0xab, 0x37, 0xd0, 0x5f, 0xe1, 0x74, 0xb9, 0xfd, 0x10, 0x49, 0x62, 0x88, 0xed, 0xbb,
+    0x13, 0xb1, 0x58, 0x2c, 0xa6, 0xf9, 0x30, 0xd2, 0x0d, 0x0f, 0x3a, 0x21, 0xbe, 0x70, 0xda, 0x22,
+    0xd6, 0xf2, 0xee, 0x48, 0x8c, 0xcf, 0x80, 0x25, 0x5f, 0x90, 0x73, 0x39, 0x56, 0xce, 0xf1, 0xc9,
+    0xd2, 0x04, 0xbb, 0x86, 0xae, 0x42, 0x51, 0xca, 0x03, 0xb9, 0x2c, 0xe5, 0x62, 0x46, 0x43, 0x00,
+    0x63, 0x72, 0xb7, 0x91, 0x97, 0x22, 0x44, 0x8a, 0xae, 0xe5, 0x3b, 0x2a, 0xcc, 0x14, 0xbb, 0x4b,
+    0x15, 0x96, 0xb5, 0x3d, 0x5d, 0x13, 0x6a, 0x80, 0x8c, 0x2b, 0xea, 0x1a, 0x63, 0x2e, 0x9e, 0xf5,
+    0x0c, 0xcd, 0xa8, 0x0f, 0x7f, 0x65, 0xba, 0x75, 0xb7, 0x0d, 0x87, 0xfe, 0x98, 0x19, 0x4c, 0x1a,
+    0x62, 0x20, 0x87, 0x96, 0x6f, 0x7a, 0x9a, 0x35, 0x33, 0x2f, 0x2c, 0x0d, 0xb2, 0xa0, 0xb1, 0x0e,
+    0x76, 0x52, 0x38, 0xb5, 0xa1, 0xa3, 0x78, 0xbe, 0xc3, 0x80, 0x33, 0x8d, 0x0c, 0xa8, 0xcd, 0x52,
+    0x6e, 0xc7, 0x48, 0x9f, 0x40, 0xc5, 0x83, 0x4e, 0xd4, 0x4b, 0xbe, 0x33, 0x00, 0xc4, 0xbb, 0x45,
+    0x00, 0xe4, 0x3b, 0xb2, 0x60, 0x59, 0x92, 0x24, 0x16, 0x13, 0x91, 0x88, 0x50, 0x03, 0x3f, 0x43,
+    0x27, 0x11, 0xf1, 0x53, 0x45, 0xab, 0x40, 0xe2, 0xa3, 0xd3, 0x04, 0xe2, 0x53, 0xa6, 0xb6, 0x01,
+    0x5d, 0x6a, 0x15, 0x64, 0xc0, 0xc8, 0x72, 0x44, 0x03, 0x7a, 0xd4, 0x17, 0xd6, 0x81, 0xb4, 0x4f,
+    0x3f, 0x1e, 0x10, 0x2c, 0xf4, 0xeb, 0xe6, 0x66, 0xee, 0xcf, 0xa5, 0x3a, 0x19, 0xf5, 0x62, 0xfa,
+    0x02, 0x3d, 0x63, 0xd6, 0x1a, 0x10, 0x41, 0x7b, 0x7e, 0x62, 0xbc, 0x8c, 0x1f, 0x24, 0xe3, 0x08,
+    0x89, 0x9c, 0x61, 0xa4, 0x83, 0x3f, 0x2a, 0x2e, 0x9d, 0xc4, 0x0e, 0x90, 0x40, 0xc4, 0xc0, 0xe6,
+    0x12, 0x68, 0x2c, 0xdf, 0xb3, 0x7d, 0x6f, 0x25, 0x06, 0x02, 0x96, 0x1c, 0x1c, 0xca, 0x76, 0xf9,
+    0x60, 0x02, 0xc6, 0x19, 0x6c, 0x78, 0x93, 0x75, 0x06, 0x1b, 0xde, 0x24, 0x17, 0x8e, 0x7d, 0xcf,
+    0x71, 0xbc, 0xf4, 0x0a, 0x7f, 0x8b, 0x6c, 0x54, 0x71, 0x17, 0xa6, 0x0a, 0xd8, 0x4d, 0x9d, 0xda,
+    0x69, 0xb6, 0x5b, 0xb6, 0x2d, 0xd3, 0x85, 0xa0, 0x0e, 0x94, 0x99, 0xa2, 0x7b, 0xc1, 0x2e, 0x3c,
+    0x82, 0x9e, 0x3a, 0x11, 0xa3, 0x98, 0x40, 0x28, 0x91, 0xf9, 0xd0, 0x06, 0xc1, 0xdd, 0xa7, 0x72,
+    0x79, 0xd6, 0xc4, 0xa7, 0xd0, 0x9b, 0x58, 0xc8, 0x58, 0x84, 0xe3, 0xce, 0x40, 0xd8, 0x60, 0x57,
+    0x44, 0xd7, 0xc2, 0xfa, 0x10, 0x32, 0x73, 0x40, 0x4a, 0xf1, 0xc9, 0xb5, 0x4c, 0x31, 0x97, 0x5c,
+    0x59, 0xb4, 0x4d, 0xfa, 0x43, 0x14, 0xe9, 0x0c, 0x83, 0xd1, 0x96, 0x99, 0xde, 0x2a, 0xbd, 0x85,
+    0x0d, 0xad, 0x51, 0xb0, 0x98, 0xce, 0x2b, 0x34, 0xbd, 0x3e, 0x66, 0x38, 0x09, 0x5f, 0x7c, 0x53,
+    0x83, 0x23, 0xdd, 0x84, 0x1a, 0x2f, 0x64, 0x41, 0xae, 0x9f, 0x65, 0x3e, 0x61, 0x14, 0x44, 0x38,
+    0x90, 0x23, 0x33, 0xe1, 0x8c, 0x83, 0x37, 0xc6, 0x2a, 0x02, 0x2b, 0x04, 0x1e, 0x98, 0x7c, 0x2d,
+    0x5a, 0xe6, 0x14, 0xba, 0xae, 0x32, 0x46, 0xbc, 0x16, 0x71, 0x5b, 0xae, 0xde, 0x08, 0x88, 0x17,
+    0xcf, 0xfa, 0xdd, 0xcb, 0x22, 0x66, 0x0a, 0xe9, 0x2b, 0x6a, 0x8a, 0xa7, 0xe4, 0xe2, 0x3c, 0x23,
+    0x88, 0xf8, 0x62, 0xa6, 0x6a, 0x31, 0xd0, 0xa1, 0x23, 0x7a, 0x3a, 0x74, 0x3e, 0x2b, 0x66, 0xaa,
+    0x90, 0xdf, 0x11, 0x0e, 0x1c, 0x0e, 0x60, 0x64, 0xeb, 0x0a, 0x97, 0x3a, 0x7d, 0xca, 0x6a, 0xc0,
+    0x15, 0xec, 0x7e, 0x9c, 0x2e, 0xdf, 0xf0, 0xe2, 0xdb, 0x03, 0xdf, 0x53, 0x7e, 0xd6, 0x43, 0x7e,
+    0x95, 0x67, 0x24, 0x94, 0x7e, 0xd0, 0x33, 0x7e, 0xd0, 0x23, 0xfe, 0x6d, 0x4f, 0xf8, 0x79, 0x0f,
+    0xf8, 0x39, 0xcf, 0xf7, 0x29, 0x8f, 0xb7, 0x8e, 0xa7, 0x23, 0xdc, 0x46, 0x9a, 0x4e, 0x84, 0xda,
+    0x1f, 0x34, 0x07, 0x37, 0xfd, 0x7f, 0xb7, 0x4e, 0x2f, 0x9b, 0xbd, 0x87, 0x7f, 0xdf, 0x76, 0x7a,
+    0xfd, 0xd3, 0xee, 0x25, 0xa8, 0x03, 0x79, 0x9f, 0x0b, 0x70, 0xd2, 0x69, 0xb6, 0x3b, 0xbd, 0x7f,
+    0xf7, 0x4f, 0x1f, 0x3b, 0xa0, 0x0e, 0x76, 0xaa, 0x7c, 0xa8, 0xd3, 0x41, 0xe7, 0x22, 0x80, 0xd9,
+    0x2d, 0x07, 0x30, 0x27, 0x9d, 0xe6, 0xa0, 0xd3, 0xfb, 0xf7, 0x45, 0xb7, 0xdd, 0xe9, 0x83, 0x3a,
+    0xf8, 0xb9, 0x41, 0xd8, 0x37, 0x1a, 0x09, 0x64, 0x9d, 0x82, 0x61, 0xcd, 0x82, 0x8f, 0x13, 0x7d,
+    0x3c, 0x11, 0x36, 0x7e, 0xed, 0x47, 0xce, 0x49, 0x83, 0xaa, 0xa5, 0x51, 0xcf, 0xd4, 0xd2, 0x4d,
+    0xc5, 0x59, 0x88, 0x43, 0x7f, 0x34, 0x4a, 0xda, 0xe3, 0xab, 0x0e, 0x67, 0xd4, 0x97, 0xb4, 0x15,
+    0x4f, 0xb9, 0xd5, 0xe1, 0x2c, 0x80, 0x8b, 0x02, 0x52, 0xd2, 0x50, 0x1c, 0x2e, 0x3c, 0x78, 0x4e,
+    0xa2, 0xdd, 0x83, 0x25, 0xeb, 0xfc, 0xeb, 0x2f, 0x8c, 0xb5, 0x38, 0x86, 0xde, 0x8d, 0x6e, 0x7a,
+    0x55, 0x51, 0xca, 0x81, 0xdf, 0xd0, 0x19, 0x60, 0xbe, 0x55, 0x4e, 0x77, 0xca, 0x51, 0x27, 0xeb,
+    0x02, 0xbd, 0x89, 0x63, 0xcd, 0x30, 0x59, 0x1d, 0xc7, 0xb1, 0x1c, 0x51, 0x38, 0x35, 0x5f, 0x15,
+    0x43, 0xd7, 0xc0, 0x10, 0xaf, 0x85, 0xc6, 0x07, 0x42, 0x4c, 0x64, 0x88, 0xd4, 0x38, 0xf2, 0x32,
+    0x41, 0xce, 0x15, 0xda, 0xd2, 0xd9, 0x6e, 0x4c, 0xd7, 0xb7, 0x6d, 0x0b, 0x1f, 0x13, 0x62, 0x33,
+    0x82, 0x57, 0xe8, 0xb8, 0x88, 0xbf, 0xc8, 0x23, 0x25, 0x27, 0x8b, 0x51, 0x83, 0xec, 0x3a, 0x3c,
+    0x06, 0x4a, 0xac, 0x63, 0xf0, 0xab, 0xc8, 0xf1, 0xe6, 0xea, 0x8d, 0xf8, 0x78, 0x02, 0xbc, 0xb9,
+    0x19, 0xf3, 0x4b, 0xbe, 0xbc, 0x43, 0x81, 0x93, 0x41, 0xff, 0xab, 0x62, 0xf8, 0xc8, 0xb5, 0xb1,
+    0x48, 0xe4, 0x1d, 0x8a, 0x25, 0x0f, 0x3c, 0xc7, 0x67, 0x63, 0xfc, 0xe0, 0xc0, 0x57, 0x07, 0xe5,
+    0xfd, 0xe4, 0x3e, 0x83, 0x31, 0xed, 0xa7, 0x1d, 0x98, 0x5e, 0x29, 0xaf, 0x39, 0xf7, 0xa9, 0xe9,
+    0x55, 0xca, 0xab, 0xa7, 0xde, 0x5a, 0x7b, 0xea, 0xa9, 0x6e, 0x18, 0x3a, 0x9d, 0x5c, 0xaf, 0x94,
+    0xc5, 0x1c, 0x28, 0xe1, 0xf0, 0x74, 0x3f, 0x11, 0xd1, 0x53, 0x90, 0xa4, 0x03, 0x8c, 0x0e, 0xd5,
+    0x18, 0x91, 0x98, 0xf4, 0x0c, 0xe4, 0x48, 0x9d, 0xd1, 0x87, 0x0f, 0xd3, 0xfc, 0xbe, 0xe8, 0x18,
+    0x4d, 0xfb, 0x53, 0xce, 0x23, 0x94, 0x78, 0x85, 0xb7, 0x15, 0xf8, 0xd5, 0xf8, 0xae, 0x33, 0xb5,
+    0x34, 0xc4, 0x46, 0xd6, 0xd2, 0x7f, 0x22, 0x98, 0x5f, 0xc8, 0x4e, 0xb0, 0xa9, 0xb3, 0xd0, 0x23,
+    0x43, 0x19, 0xbb, 0x1c, 0x2c, 0x74, 0x2b, 0xb8, 0x23, 0x81, 0x7c, 0x1d, 0xe9, 0x4c, 0x1c, 0x00,
+    0x9f, 0x5f, 0x50, 0x32, 0x02, 0x71, 0x32, 0x26, 0x61, 0x8d, 0xda, 0x3e, 0xd6, 0xc0, 0x26, 0x4a,
+    0x0d, 0x50, 0x63, 0xcf, 0x83, 0x40, 0x9a, 0xf2, 0x4e, 0x62, 0x08, 0x75, 0x01, 0x75, 0xa0, 0x6b,
+    0xe1, 0xc1, 0x4f, 0x8a, 0x2f, 0x7f, 0xb3, 0x0e, 0xe4, 0x9d, 0xfd, 0x75, 0x4e, 0x5f, 0x68, 0xf2,
+    0x01, 0x9c, 0x7b, 0x6d, 0xec, 0xae, 0x1c, 0x31, 0x57, 0x24, 0x8e, 0x4b, 0xd4, 0xb5, 0xa2, 0xeb,
+    0x0f, 0x71, 0xb6, 0x02, 0x9d, 0x06, 0xc3, 0x69, 0x0f, 0x80, 0x04, 0xbe, 0x03, 0x79, 0x07, 0xd4,
+    0xc2, 0xb6, 0x5c, 0x8e, 0x73, 0x74, 0xcb, 0x3e, 0xb3, 0x89, 0x84, 0x8f, 0x7f, 0x00, 0x69, 0x2e,
+    0x05, 0xde, 0x67, 0xe9, 0xc9, 0x8d, 0x1d, 0x50, 0x4e, 0x0f, 0x88, 0xef, 0x87, 0x1f, 0xd4, 0x44,
+    0x4f, 0x71, 0xc6, 0x30, 0xbb, 0xdb, 0xc0, 0xf1, 0x07, 0xbf, 0x0f, 0xfb, 0x7c, 0x8e, 0x26, 0xa6,
+    0xce, 0x89, 0x09, 0x92, 0x9e, 0xed, 0x4c, 0x94, 0xcf, 0x7a, 0x76, 0x97, 0x96, 0xd9, 0xa5, 0x9b,
+    0x64, 0x43, 0xe7, 0xf7, 0x86, 0xfb, 0x3d, 0xbf, 0xdb, 0x85, 0x9e, 0x6d, 0xe9, 0x2c, 0x87, 0xb8,
+    0x2b, 0x09, 0x03, 0x80, 0xc4, 0x62, 0xa6, 0x44, 0x44, 0xd3, 0xd8, 0x51, 0x9a, 0xd8, 0xaa, 0xea,
+    0xe9, 0xaf, 0x49, 0xf1, 0x6d, 0x51, 0xf1, 0x71, 0xe7, 0x08, 0xe3, 0xbd, 0xb8, 0x41, 0xad, 0x7f,
+    0x32, 0x5e, 0x15, 0xce, 0xe1, 0xec, 0x52, 0x90, 0x79, 0xcb, 0x0a, 0x01, 0x0e, 0xea, 0x20, 0xb5,
+    0xdf, 0xf2, 0xe2, 0xc0, 0x78, 0xea, 0x27, 0x6e, 0xdd, 0x4c, 0x3f, 0x89, 0xe4, 0xe2, 0x5e, 0x21,
+    0x73, 0x43, 0xf8, 0xe0, 0xa9, 0x9b, 0x7e, 0xcc, 0x8e, 0x26, 0xc9, 0xa7, 0xa5, 0xf1, 0x23, 0x9a,
+    0x32, 0x5b, 0x67, 0xb8, 0xbd, 0x51, 0x8a, 0x23, 0xa3, 0x97, 0x44, 0x7d, 0xa4, 0x77, 0x79, 0x78,
+    0x17, 0xe5, 0x94, 0xb2, 0xce, 0xab, 0x34, 0x76, 0xfa, 0xa2, 0x53, 0x6b, 0x71, 0xa8, 0x9b, 0x5f,
+    0x76, 0x72, 0x8d, 0x9d, 0xc2, 0x39, 0xf1, 0x5e, 0xe2, 0xd0, 0x83, 0x7d, 0x69, 0x0b, 0xab, 0x96,
+    0x98, 0x4b, 0x9d, 0x6a, 0x83, 0x84, 0x3c, 0xc5, 0x77, 0xec, 0x28, 0xf6, 0x04, 0xa5, 0xe5, 0x55,
+    0x43, 0x71, 0x5d, 0xc0, 0xb6, 0x52, 0x22, 0xa1, 0x01, 0xa7, 0xd0, 0xf4, 0x02, 0x2f, 0x6f, 0x58,
+    0x0e, 0xf9, 0x68, 0x3b, 0x96, 0x0d, 0x1d, 0x6f, 0x41, 0xbe, 0x29, 0x73, 0xdd, 0x3d, 0x35, 0x47,
+    0x16, 0xb3, 0x19, 0x38, 0xbe, 0xea, 0x59, 0x8e, 0x18, 0xc0, 0xe5, 0xc9, 0xe0, 0x7c, 0x08, 0x9a,
+    0x63, 0xe3, 0x32, 0xdd, 0x2d, 0xd2, 0x89, 0x40, 0x3d, 0x60, 0xae, 0x66, 0xa9, 0x3e, 0x6a, 0x41,
+    0x91, 0x47, 0x87, 0x74, 0xb6, 0x16, 0xa7, 0x9a, 0x28, 0x8c, 0x11, 0x79, 0x05, 0x9c, 0xd9, 0xa7,
+    0xc8, 0x19, 0x85, 0xc7, 0xb8, 0x82, 0x76, 0x50, 0x4f, 0xd0, 0x19, 0x42, 0x04, 0x54, 0xc4, 0xf6,
+    0x2a, 0xf4, 0x4f, 0xb1, 0x18, 0xf6, 0x45, 0x3a, 0x95, 0x34, 0x37, 0xbc, 0x94, 0x20, 0x3a, 0xc2,
+    0x87, 0xe8, 0x53, 0xd3, 0x13, 0xe9, 0x02, 0xc3, 0x9d, 0x34, 0x9c, 0x0c, 0x77, 0xa4, 0x66, 0x12,
+    0x90, 0x6e, 0x33, 0x98, 0x1a, 0x0d, 0xb4, 0xdf, 0x21, 0xff, 0x35, 0x1a, 0x25, 0x94, 0x7d, 0x9c,
+    0x82, 0xac, 0xf2, 0x01, 0x87, 0x71, 0x40, 0x02, 0x93, 0x5c, 0x07, 0x31, 0x8d, 0x31, 0xf4, 0x0e,
+    0x11, 0xa4, 0x68, 0xd9, 0x8a, 0xaa, 0x63, 0x5e, 0xc9, 0xbc, 0xf4, 0xbd, 0x33, 0x1e, 0x2a, 0x22,
+    0x62, 0xf6, 0xcf, 0xd8, 0x54, 0xd1, 0xc2, 0x8a, 0x4e, 0x3e, 0xab, 0x67, 0x9c, 0xd9, 0x33, 0x8c,
+    0xf7, 0x50, 0x1a, 0xc2, 0xb6, 0x5f, 0xc5, 0x27, 0x4b, 0x37, 0x45, 0x21, 0x2f, 0xe4, 0xc0, 0x26,
+    0x10, 0x72, 0x89, 0x3b, 0x04, 0x57, 0x7f, 0x83, 0x62, 0x3a, 0x41, 0xfe, 0x27, 0x98, 0xe9, 0x9a,
+    0x37, 0xc9, 0x83, 0x09, 0xd4, 0xc7, 0x13, 0x0f, 0xbc, 0x83, 0x7a, 0x4c, 0xb7, 0x90, 0x26, 0xb5,
+    0x2c, 0xdf, 0xd4, 0x74, 0x73, 0x7c, 0x68, 0xe8, 0xd0, 0xf4, 0x7a, 0x50, 0xf5, 0xc4, 0xa4, 0xb8,
+    0x02, 0x68, 0x8c, 0x0c, 0xeb, 0xa3, 0x16, 0x9c, 0xe4, 0x53, 0x30, 0x74, 0xa6, 0x3a, 0x9d, 0x32,
+    0xa9, 0x28, 0x43, 0x6b, 0xfe, 0x61, 0x1a, 0xc8, 0x15, 0x18, 0x9a, 0xfa, 0xb7, 0x3a, 0x42, 0x40,
+    0xe9, 0xf8, 0xeb, 0xaf, 0x60, 0x59, 0xb4, 0x99, 0x7c, 0xcb, 0x25, 0xb4, 0x8a, 0xb3, 0x82, 0x4d,
+    0xba, 0x04, 0x50, 0x88, 0xd0, 0xed, 0x67, 0x0f, 0x4a, 0x2c, 0x89, 0x8e, 0x4a, 0xae, 0xef, 0x9d,
+    0x3d, 0x03, 0xe9, 0x26, 0x14, 0x55, 0xc5, 0x7c, 0x55, 0xdc, 0x3c, 0x98, 0xcb, 0x79, 0xb0, 0x90,
+    0xf3, 0x60, 0x5e, 0xce, 0x83, 0x45, 0xec, 0xb0, 0x47, 0x20, 0x8a, 0x43, 0x38, 0xd6, 0xcd, 0x2b,
+    0xc5, 0x9b, 0xc4, 0xb6, 0x31, 0xd2, 0x37, 0xb5, 0x5e, 0xe1, 0xc0, 0x12, 0x09, 0x8e, 0x74, 0x37,
+    0x9a, 0x08, 0x75, 0x13, 0xd4, 0xa9, 0x6e, 0xd7, 0x73, 0xac, 0x67, 0x28, 0xc6, 0x76, 0x00, 0xdf,
+    0xd6, 0x14, 0x0f, 0x8a, 0x74, 0xaf, 0xcb, 0x03, 0xd7, 0xb0, 0x3c, 0xb2, 0xe3, 0xe7, 0xc1, 0x54,
+    0x99, 0x9f, 0x7a, 0x70, 0x8a, 0x88, 0xee, 0x7b, 0xd0, 0x4e, 0x2b, 0x14, 0xc1, 0x9b, 0x90, 0xe0,
+    0xf7, 0x22, 0x36, 0x1d, 0xd3, 0x83, 0x73, 0x4f, 0x14, 0xca, 0x9a, 0x90, 0x90, 0x5d, 0x30, 0x28,
+    0xba, 0x33, 0x5b, 0x75, 0x53, 0x16, 0x99, 0x5b, 0x92, 0xbf, 0xa1, 0x70, 0x02, 0x9d, 0x4f, 0x2b,
+    0x18, 0x51, 0xa5, 0xb4, 0x77, 0x31, 0xe0, 0x08, 0x6d, 0xad, 0x5b, 0xd5, 0xa4, 0x8b, 0xb0, 0x3c,
+    0xcf, 0x9a, 0x0a, 0x35, 0x50, 0x96, 0x12, 0x3d, 0x58, 0x31, 0x50, 0x4c, 0x9d, 0x56, 0xa1, 0x42,
+    0x1a, 0xcf, 0xc8, 0x37, 0x8c, 0xbb, 0xcc, 0x11, 0xa9, 0xdd, 0x1a, 0x69, 0x4f, 0x12, 0x32, 0x54,
+    0xb0, 0x14, 0x29, 0xe4, 0xe4, 0x16, 0xf3, 0xd4, 0xc5, 0xa9, 0x6e, 0x72, 0xcf, 0x70, 0x09, 0x28,
+    0x65, 0xce, 0xf3, 0xdb, 0x38, 0x5e, 0x43, 0xb2, 0x46, 0x29, 0x96, 0x5f, 0x51, 0x7b, 0xea, 0x3e,
+    0x2a, 0xd0, 0x89, 0x5c, 0x71, 0x64, 0x39, 0x1d, 0x45, 0x9d, 0x84, 0xf7, 0x60, 0x71, 0xfe, 0xc6,
+    0x0e, 0xa7, 0x08, 0xe2, 0x67, 0x6c, 0xe7, 0xf9, 0x15, 0x37, 0xb0, 0x40, 0x4c, 0x68, 0x11, 0xa0,
+    0x0e, 0x2e, 0x14, 0x6f, 0x82, 0x3e, 0x8a, 0x6c, 0x7b, 0x1e, 0x63, 0x43, 0x9f, 0x72, 0x59, 0x83,
+    0x95, 0x79, 0x38, 0x58, 0x99, 0x8b, 0x6c, 0x7b, 0x30, 0x58, 0x99, 0x27, 0x06, 0xe3, 0x45, 0x93,
+    0x10, 0x0f, 0x41, 0x30, 0xbd, 0xef, 0xcc, 0xe7, 0xe8, 0xaa, 0x6d, 0x2e, 0xce, 0x93, 0xaa, 0x19,
+    0xd8, 0x82, 0xa1, 0xfa, 0x86, 0x42, 0x6e, 0x54, 0xc5, 0x80, 0x4d, 0xa0, 0x00, 0xe6, 0xa0, 0x80,
+    0x76, 0x8e, 0x52, 0xac, 0x51, 0xce, 0x81, 0x6f, 0x11, 0xe1, 0x1c, 0x97, 0x43, 0xb7, 0x97, 0x10,
+    0x04, 0xa9, 0x2b, 0xd8, 0x24, 0x8b, 0x1b, 0x19, 0x96, 0xe5, 0x88, 0xe1, 0x3a, 0xa5, 0x3c, 0x87,
+    0x61, 0xd4, 0xd3, 0x47, 0x54, 0xe5, 0x72, 0x68, 0xab, 0x90, 0x8a, 0xdb, 0x3c, 0x1b, 0x8a, 0xd6,
+    0xb7, 0x10, 0x17, 0x6b, 0xac, 0x2f, 0x9c, 0x26, 0x54, 0x51, 0x71, 0x81, 0x1d, 0x61, 0x24, 0x2e,
+    0xbc, 0xe2, 0x98, 0x68, 0x92, 0xfd, 0xdf, 0x92, 0x68, 0xb8, 0x1c, 0x58, 0x7b, 0xc5, 0x04, 0xc7,
+    0xda, 0x4b, 0x46, 0x1a, 0x6f, 0x28, 0x0b, 0xcb, 0xf7, 0xd2, 0xbe, 0x61, 0x8e, 0xcf, 0x34, 0x71,
+    0x6b, 0x9a, 0x2f, 0xe4, 0x5a, 0x92, 0xe0, 0x24, 0x44, 0xb9, 0x06, 0x92, 0x96, 0xba, 0xe0, 0xa0,
+    0x5a, 0xcc, 0x59, 0x54, 0x48, 0xb2, 0xc9, 0xfe, 0x32, 0xd3, 0x1f, 0x3a, 0x12, 0x9e, 0xdd, 0x06,
+    0x67, 0xad, 0xb1, 0x83, 0x93, 0x18, 0xd2, 0x3e, 0xf9, 0x74, 0x10, 0xda, 0x29, 0x69, 0x88, 0x1d,
+    0x99, 0x22, 0x99, 0x1a, 0xca, 0x10, 0x1a, 0x28, 0x37, 0x1f, 0x3a, 0x7d, 0xd0, 0xa8, 0xe3, 0x63,
+    0x1e, 0xca, 0x2e, 0x88, 0x05, 0x8c, 0xeb, 0x1b, 0xdb, 0x5d, 0x02, 0x3b, 0xa8, 0xb7, 0x28, 0xe5,
+    0x8a, 0x9e, 0x75, 0xa4, 0xcf, 0xa1, 0x86, 0xf2, 0x9a, 0x9b, 0xc4, 0x23, 0x81, 0x5a, 0xc6, 0x18,
+    0x39, 0x31, 0x44, 0xc6, 0x43, 0x5c, 0x21, 0x2e, 0x70, 0x22, 0x8d, 0xe2, 0x9c, 0x77, 0xe0, 0x0a,
+    0xc5, 0x62, 0xcf, 0x45, 0x34, 0x43, 0xe2, 0xb8, 0x43, 0x3c, 0x3a, 0x5a, 0x8d, 0x50, 0x23, 0xab,
+    0x8a, 0x75, 0xb3, 0xa6, 0xfc, 0x9e, 0xc5, 0x3b, 0x46, 0xd1, 0x62, 0xee, 0xa8, 0x94, 0xf0, 0xa0,
+    0x0b, 0xb2, 0x17, 0x7e, 0xe3, 0x35, 0x87, 0xec, 0x67, 0x15, 0x9f, 0x36, 0x6e, 0xd6, 0xb9, 0x88,
+    0xfe, 0xe4, 0xf1, 0x60, 0x91, 0xc9, 0x03, 0xa4, 0x4f, 0xf6, 0x62, 0x25, 0x0f, 0xc8, 0x8c, 0x89,
+    0x09, 0x7d, 0x53, 0xf7, 0xd6, 0xe0, 0x0b, 0x8d, 0x16, 0x54, 0x03, 0x2a, 0x0e, 0x0e, 0xbe, 0xa4,
+    0x3c, 0x90, 0xf2, 0xbc, 0x4d, 0x8c, 0xb7, 0x5d, 0xf1, 0xa3, 0x92, 0x3b, 0x1a, 0x2b, 0xca, 0x19,
+    0x41, 0x49, 0xdf, 0x5b, 0x18, 0xe8, 0xb0, 0x40, 0xc2, 0xe9, 0x4a, 0x39, 0x0f, 0x82, 0xff, 0x4b,
+    0x45, 0x59, 0xca, 0x31, 0x9a, 0x12, 0x6a, 0x49, 0xb4, 0xff, 0x98, 0x23, 0x2b, 0x4f, 0x52, 0x03,
+    0xa9, 0x6d, 0x08, 0x05, 0x1c, 0x24, 0xf9, 0xf0, 0x2f, 0x12, 0xc4, 0xf0, 0xa3, 0x8b, 0x30, 0x8e,
+    0x88, 0x85, 0x6a, 0x08, 0x71, 0x71, 0x9e, 0x0f, 0xa7, 0x44, 0x61, 0x5b, 0xaa, 0xad, 0x9c, 0xd8,
+    0x50, 0xde, 0xb9, 0x1b, 0x48, 0x28, 0xd7, 0x18, 0xd5, 0xb9, 0x7a, 0x23, 0x3d, 0x6b, 0x00, 0x3a,
+    0x0f, 0x66, 0x5b, 0x30, 0x6d, 0xe5, 0xa0, 0x2d, 0x97, 0xe6, 0xf3, 0xc8, 0xc2, 0xc7, 0x43, 0x41,
+    0xde, 0xb1, 0xe7, 0xc0, 0x55, 0x4c, 0xb7, 0xe0, 0x42, 0x47, 0x1f, 0x09, 0x2b, 0x58, 0x1e, 0x8c,
+    0xd6, 0x0d, 0x83, 0x95, 0x02, 0x23, 0x04, 0x96, 0xfd, 0x69, 0x7a, 0xed, 0xb9, 0x28, 0xe5, 0xf2,
+    0x48, 0x29, 0xf1, 0x5f, 0xf3, 0xf8, 0x36, 0x47, 0x3b, 0x72, 0x2b, 0x30, 0xa4, 0xc7, 0xc4, 0xf6,
+    0x8a, 0x95, 0x30, 0xca, 0x9c, 0xc3, 0x10, 0x14, 0x81, 0x36, 0x0d, 0x7d, 0x8c, 0x42, 0x0a, 0x41,
+    0x85, 0x26, 0x4a, 0x97, 0xfc, 0x07, 0x14, 0x89, 0x61, 0x28, 0xca, 0xe9, 0x62, 0xb4, 0x45, 0x6c,
+    0x98, 0x3c, 0x95, 0x42, 0x55, 0x6c, 0x3b, 0x6b, 0xe9, 0x10, 0x6f, 0x55, 0x0e, 0x8e, 0x1b, 0xd7,
+    0xd0, 0xb3, 0x65, 0x44, 0x45, 0x1a, 0x87, 0x02, 0x59, 0xae, 0x86, 0x91, 0xcc, 0xbb, 0xee, 0xb8,
+    0x41, 0x38, 0xe7, 0xfe, 0x94, 0x7e, 0xa5, 0x35, 0x90, 0xd1, 0x21, 0x2c, 0xe6, 0xf0, 0x10, 0x2d,
+    0x15, 0xe5, 0xed, 0xf4, 0x52, 0xd6, 0x38, 0xea, 0x44, 0xda, 0x85, 0x67, 0x4f, 0x4a, 0x9a, 0x84,
+    0x6f, 0xb1, 0x50, 0x34, 0x4b, 0x82, 0xf1, 0x33, 0x92, 0x3d, 0x27, 0xe2, 0x24, 0xb8, 0x71, 0xc5,
+    0x56, 0x02, 0xf5, 0x7b, 0x6a, 0x1a, 0x12, 0x04, 0xe7, 0x8a, 0x0e, 0x44, 0xd7, 0x5f, 0xe8, 0xd3,
+    0x27, 0x27, 0xc6, 0xd8, 0xe8, 0x69, 0xa7, 0x40, 0x93, 0xa3, 0xa1, 0x52, 0x13, 0x5a, 0x74, 0x33,
+    0x8b, 0x16, 0x86, 0xd7, 0x62, 0x6e, 0x85, 0x6d, 0x27, 0x85, 0xf0, 0x35, 0x32, 0xa0, 0xf7, 0x3f,
+    0xff, 0x94, 0x1c, 0x38, 0xe8, 0xdf, 0x57, 0x1d, 0x66, 0xd7, 0xe4, 0xc0, 0xf2, 0xcd, 0xa9, 0xfc,
+    0x15, 0xcc, 0xa1, 0x57, 0x1d, 0xff, 0x14, 0x73, 0x38, 0xe8, 0x3f, 0xc2, 0x9c, 0x70, 0x8f, 0x28,
+    0xaf, 0xd8, 0x23, 0x96, 0xfb, 0xce, 0x2f, 0xd8, 0x48, 0x3e, 0xc0, 0x94, 0x8f, 0xf8, 0x5e, 0xec,
+    0xa8, 0xd0, 0x31, 0x30, 0xe4, 0xdd, 0x7e, 0x06, 0x10, 0xce, 0x7e, 0x26, 0xb8, 0xba, 0x9f, 0xe5,
+    0xcc, 0xb9, 0x8a, 0x90, 0x80, 0x51, 0x1c, 0x55, 0x9c, 0xe7, 0xc1, 0x22, 0x0f, 0x2a, 0x38, 0x60,
+    0xc2, 0x01, 0xe5, 0xd5, 0x29, 0xf8, 0x06, 0xca, 0xd9, 0x83, 0x92, 0x66, 0x9c, 0xb9, 0x89, 0x30,
+    0x64, 0x86, 0x71, 0x74, 0x39, 0xc7, 0x8d, 0xf1, 0xf2, 0x00, 0x91, 0x81, 0x3c, 0x8a, 0xb4, 0x72,
+    0x63, 0x79, 0x67, 0x92, 0xde, 0x87, 0xd6, 0x74, 0xaa, 0x98, 0x1a, 0xca, 0x77, 0x27, 0xee, 0x01,
+    0xe0, 0x1c, 0xaa, 0xbe, 0x07, 0x45, 0xc5, 0xb6, 0x51, 0xa2, 0x1a, 0x83, 0xc5, 0xaf, 0x00, 0x54,
+    0x94, 0xf0, 0x21, 0xba, 0x35, 0xe8, 0xfe, 0xe8, 0x5c, 0xe2, 0xca, 0x00, 0xc5, 0xb6, 0x91, 0xed,
+    0x0d, 0xd0, 0x25, 0xa4, 0x88, 0x63, 0x7e, 0xdc, 0x4c, 0x11, 0x10, 0x02, 0x3c, 0x67, 0x91, 0xca,
+    0x2b, 0xad, 0x7f, 0x9f, 0x40, 0x51, 0x09, 0xb1, 0x4b, 0x83, 0xc4, 0xc5, 0xc1, 0x55, 0xb7, 0x3f,
+    0x10, 0xf2, 0x89, 0x94, 0x81, 0xb6, 0xa8, 0x05, 0x34, 0xf3, 0x0d, 0x89, 0x66, 0x4c, 0x5d, 0x5f,
+    0x55, 0xa1, 0xeb, 0xe6, 0x41, 0x50, 0x2c, 0xf6, 0xbe, 0xbc, 0x8e, 0x0a, 0x67, 0xfb, 0x6d, 0xbb,
+    0x68, 0x5a, 0x9e, 0x3e, 0x5a, 0x88, 0x74, 0x38, 0xf8, 0x0e, 0x84, 0x3e, 0xf9, 0x88, 0x8e, 0x73,
+    0x8b, 0x80, 0xa1, 0x5a, 0xc0, 0x0b, 0x74, 0x76, 0x12, 0x70, 0xd5, 0x05, 0xed, 0x42, 0x39, 0xab,
+    0xa0, 0x2f, 0x9c, 0x3c, 0x90, 0x19, 0x50, 0x15, 0x4f, 0x9d, 0x00, 0x11, 0xa2, 0x5c, 0xc4, 0x7b,
+    0xfa, 0xda, 0x86, 0x62, 0x6f, 0x21, 0xa8, 0x98, 0xcc, 0xdc, 0x2c, 0xa1, 0x45, 0xc9, 0xeb, 0x4c,
+    0xf1, 0x45, 0x1c, 0x2c, 0x16, 0x8b, 0x01, 0xbe, 0x0d, 0x36, 0x1b, 0xfd, 0xbf, 0x66, 0x90, 0xeb,
+    0xfb, 0x7b, 0x42, 0x1d, 0x22, 0xba, 0xff, 0x29, 0x91, 0x92, 0x52, 0x26, 0x77, 0xb5, 0x14, 0x69,
+    0xcc, 0xa3, 0xe8, 0x06, 0x4e, 0x79, 0xd0, 0x71, 0xc5, 0x91, 0x6e, 0x6a, 0xa2, 0x48, 0xbe, 0xe5,
+    0xea, 0x8d, 0xdf, 0x68, 0x21, 0x1a, 0x15, 0x34, 0x5f, 0x0b, 0x02, 0x24, 0x34, 0xe5, 0xb9, 0x4a,
+    0x19, 0xdc, 0x65, 0xda, 0xe0, 0x0a, 0x79, 0x90, 0xc6, 0x67, 0x3d, 0xa3, 0x31, 0xa4, 0xbd, 0x18,
+    0xd7, 0x16, 0x26, 0x97, 0x12, 0x1f, 0xc7, 0x53, 0xa6, 0xf4, 0x08, 0xc3, 0x85, 0x69, 0x4f, 0xd1,
+    0xb4, 0xed, 0x9b, 0xd3, 0xe8, 0x5e, 0x0c, 0x7f, 0xa5, 0x83, 0x83, 0xbb, 0x44, 0x7c, 0x87, 0x82,
+    0x6e, 0xa2, 0xe8, 0x67, 0x72, 0x11, 0xcd, 0x56, 0x60, 0xd2, 0x5b, 0x3c, 0xc5, 0x1c, 0xd3, 0x66,
+    0x54, 0xda, 0x18, 0x7d, 0x1a, 0xe8, 0x53, 0x98, 0xbe, 0x2f, 0x4b, 0x5e, 0x8b, 0x85, 0x25, 0x15,
+    0xd1, 0x8a, 0xc2, 0x3e, 0x32, 0x7d, 0x22, 0xa3, 0x49, 0xdc, 0x25, 0x26, 0x06, 0x85, 0x07, 0x4e,
+    0x50, 0x78, 0x13, 0xe5, 0xf9, 0xc3, 0xca, 0xd2, 0x34, 0x46, 0x4c, 0x6c, 0x54, 0xc8, 0x14, 0xb6,
+    0x23, 0x7a, 0xf9, 0x23, 0x82, 0x95, 0x44, 0x83, 0x68, 0x95, 0x96, 0xa9, 0x7b, 0x62, 0xbc, 0xf8,
+    0x2a, 0xa4, 0x98, 0x1c, 0xfe, 0x51, 0x4d, 0x08, 0x7b, 0xe1, 0x28, 0xc6, 0xae, 0x8c, 0xf3, 0x40,
+    0x18, 0x8d, 0x50, 0x2a, 0x46, 0x48, 0x9a, 0xc9, 0x54, 0x37, 0x6b, 0xa0, 0x92, 0xc8, 0x43, 0x4d,
+    0x95, 0x79, 0x0d, 0xc8, 0xdb, 0x52, 0x31, 0xd1, 0x8e, 0x73, 0x10, 0x35, 0x20, 0x27, 0x9a, 0xd1,
+    0x2e, 0x52, 0x03, 0xc2, 0xff, 0xfa, 0x65, 0x59, 0xaa, 0x08, 0x8c, 0x35, 0xe5, 0xf6, 0x3f, 0x42,
+    0x30, 0xbd, 0xc0, 0xce, 0x03, 0x01, 0x51, 0x8a, 0x4a, 0xf6, 0x78, 0xb4, 0x16, 0xb6, 0x8b, 0x3c,
+    0x6a, 0xcb, 0x52, 0x16, 0xb5, 0xdb, 0x7c, 0x6a, 0x3f, 0x4f, 0x27, 0xbd, 0x4a, 0xc7, 0x74, 0x22,
+    0xae, 0xf2, 0xe9, 0x94, 0xb8, 0x64, 0xca, 0x19, 0x44, 0x4a, 0xc5, 0xf2, 0xf6, 0xd7, 0x93, 0x89,
+    0xee, 0xf4, 0xb1, 0xe8, 0x95, 0x4c, 0xd1, 0xf3, 0x88, 0xfc, 0xa8, 0xe0, 0xa7, 0xee, 0x32, 0x2a,
+    0x2d, 0x53, 0x14, 0xac, 0x57, 0xe8, 0xa0, 0xba, 0xb7, 0x82, 0x67, 0x8d, 0xc7, 0x06, 0xec, 0x98,
+    0xca, 0xd0, 0xc0, 0x5a, 0xa9, 0x1a, 0xba, 0xfa, 0x2c, 0xe4, 0x01, 0xd9, 0x92, 0x44, 0x6e, 0x30,
+    0xc7, 0x5a, 0x2e, 0x7d, 0xdc, 0xc3, 0x0b, 0xe6, 0x88, 0x83, 0x0e, 0x62, 0x0f, 0x34, 0x28, 0x0f,
+    0x84, 0x7e, 0x67, 0x00, 0x88, 0xbc, 0x8a, 0x10, 0x4f, 0xaa, 0xe1, 0xbd, 0x8a, 0xc5, 0x49, 0x0b,
+    0x61, 0x8b, 0xa4, 0xae, 0x0c, 0x15, 0x98, 0xa3, 0x1a, 0x32, 0xe4, 0x26, 0x91, 0xb9, 0x63, 0xe7,
+    0x8a, 0xfd, 0x9a, 0x90, 0x5b, 0xeb, 0xdc, 0x1d, 0xae, 0x99, 0x5e, 0x86, 0x14, 0xb0, 0x17, 0xc0,
+    0x6b, 0x9d, 0xd0, 0x4f, 0x59, 0x8b, 0x8d, 0x39, 0x8d, 0xf0, 0x22, 0x3c, 0x38, 0x93, 0xe0, 0xc0,
+    0x2e, 0x81, 0x35, 0x97, 0x43, 0x37, 0x62, 0x12, 0xe7, 0xfe, 0x91, 0xeb, 0x63, 0x22, 0x36, 0x61,
+    0x18, 0x72, 0x9b, 0x87, 0x8b, 0xce, 0x73, 0x1c, 0x14, 0x0e, 0x34, 0xb5, 0x78, 0x17, 0x77, 0x9d,
+    0x2e, 0xf4, 0xd0, 0x8e, 0x53, 0xb0, 0x6c, 0x68, 0xae, 0x23, 0x52, 0x5a, 0x91, 0x1f, 0x16, 0x28,
+    0x04, 0xeb, 0x8b, 0x30, 0xd9, 0x8a, 0x09, 0x0d, 0x21, 0x79, 0xf5, 0x32, 0x02, 0x62, 0x30, 0x88,
+    0x79, 0xe2, 0xb5, 0xa6, 0x72, 0xd0, 0x9a, 0xbe, 0x60, 0x3a, 0x97, 0xb0, 0x13, 0x55, 0x96, 0x68,
+    0x98, 0xc1, 0x9c, 0x98, 0x9a, 0x21, 0x88, 0x71, 0xa5, 0x05, 0x5c, 0x40, 0xcc, 0x4e, 0xcb, 0xd6,
+    0x6d, 0x17, 0x0d, 0x6b, 0xb6, 0x3e, 0x2a, 0x5c, 0x8c, 0x96, 0x8d, 0x0b, 0x75, 0x2f, 0x47, 0x66,
+    0xeb, 0x5a, 0xe1, 0xd9, 0x4e, 0xa0, 0xb0, 0x75, 0xad, 0xf8, 0x6c, 0xaf, 0x31, 0x50, 0xe7, 0x0d,
+    0xd4, 0xd7, 0x18, 0xa8, 0xf1, 0x06, 0x6a, 0x2b, 0xd6, 0x8d, 0x0d, 0xbf, 0xa0, 0x06, 0x65, 0x82,
+    0x09, 0x14, 0x89, 0x02, 0x42, 0x64, 0x7d, 0x6d, 0xdd, 0x45, 0x06, 0x0b, 0xc2, 0x0e, 0x12, 0xe7,
+    0x98, 0x89, 0x46, 0xce, 0xb4, 0x41, 0x8a, 0x19, 0x87, 0x1b, 0xe7, 0xba, 0xeb, 0x15, 0x1d, 0x88,
+    0xce, 0xdf, 0xa2, 0xe0, 0x1a, 0xba, 0x06, 0x0b, 0x96, 0xef, 0xad, 0x37, 0x4c, 0xd1, 0xb4, 0x60,
+    0x8c, 0x9e, 0x9a, 0xe9, 0x7d, 0x3d, 0xb3, 0x50, 0x0d, 0xcb, 0x8d, 0xb9, 0xba, 0x7f, 0xd2, 0x22,
+    0x78, 0xaa, 0xbf, 0x8a, 0x1b, 0xba, 0xf9, 0x61, 0x66, 0x70, 0x18, 0xb8, 0x26, 0x37, 0x14, 0xdb,
+    0x36, 0x16, 0x85, 0x44, 0x68, 0xb2, 0x9e, 0xc7, 0x30, 0x70, 0x9d, 0x2e, 0x76, 0x8b, 0x47, 0x86,
+    0xa5, 0x24, 0x1d, 0x63, 0x96, 0xad, 0x26, 0xbd, 0x76, 0x50, 0xfe, 0x3b, 0x9e, 0x7c, 0x14, 0x1b,
+    0x36, 0xd7, 0x24, 0xba, 0x15, 0xbb, 0x0e, 0xde, 0x6d, 0x10, 0xe5, 0xc1, 0x69, 0x36, 0x61, 0xd4,
+    0x6b, 0x30, 0x0b, 0xd5, 0xa3, 0x7e, 0xed, 0x4e, 0x49, 0x58, 0xf0, 0x6c, 0xaf, 0xc3, 0x00, 0xea,
+    0x62, 0x72, 0x99, 0x89, 0x91, 0x67, 0x7d, 0x6d, 0x34, 0xfa, 0x32, 0x34, 0xda, 0xda, 0x68, 0x34,
+    0x2e, 0x9a, 0x4c, 0x41, 0xd8, 0x3a, 0xd9, 0xf3, 0x9f, 0xed, 0x50, 0x08, 0xcf, 0x7a, 0xf4, 0x51,
+    0xfb, 0x9c, 0x22, 0x73, 0xfc, 0xd9, 0xd7, 0x8b, 0x88, 0x96, 0xba, 0xff, 0xb6, 0xc4, 0x53, 0x7e,
+    0x80, 0x11, 0x21, 0xad, 0xff, 0xc6, 0x78, 0xd1, 0xea, 0xd1, 0x87, 0xa2, 0x67, 0xf5, 0x3d, 0x47,
+    0x37, 0xc7, 0x22, 0x8f, 0xad, 0xec, 0x76, 0xb9, 0x74, 0xf5, 0xd3, 0xbf, 0xe5, 0xb6, 0xd7, 0xe4,
+    0xba, 0xab, 0xbc, 0xfe, 0xbf, 0xf7, 0x18, 0x5f, 0x60, 0x7d, 0x5f, 0x60, 0x79, 0x5f, 0x60, 0x75,
+    0x31, 0x45, 0x23, 0xd9, 0x23, 0xa2, 0x6d, 0x3f, 0xd3, 0x37, 0xcd, 0x2b, 0x3c, 0x62, 0x9e, 0x3f,
+    0x62, 0x95, 0xe9, 0xf2, 0x86, 0x35, 0x6f, 0x3b, 0x42, 0xac, 0xf9, 0xd7, 0xba, 0xee, 0x96, 0xfe,
+    0x58, 0xc0, 0x3a, 0xfa, 0x85, 0x0a, 0x01, 0xc2, 0xd7, 0x8f, 0x5c, 0x83, 0xeb, 0x75, 0xfa, 0x83,
+    0x66, 0x6f, 0x20, 0x64, 0x4c, 0x4e, 0xb3, 0x59, 0x8a, 0xa6, 0xe1, 0x67, 0xa8, 0x68, 0x83, 0x85,
+    0x26, 0x74, 0x44, 0x61, 0x68, 0xf8, 0x0e, 0x37, 0x48, 0x88, 0x67, 0x22, 0x98, 0x4c, 0xcb, 0xda,
+    0xa8, 0x47, 0x96, 0xea, 0xbb, 0x6b, 0xe0, 0x8e, 0x67, 0x39, 0xd2, 0x39, 0x31, 0x92, 0xa6, 0x8a,
+    0xc5, 0x29, 0xa4, 0x29, 0x1d, 0xa6, 0x20, 0x8f, 0x47, 0xc1, 0x33, 0x9c, 0x1d, 0xe9, 0x2d, 0xba,
+    0xe8, 0x0a, 0xa0, 0xa8, 0xe9, 0xae, 0x6d, 0x28, 0x08, 0xb5, 0x60, 0x5a, 0x26, 0x14, 0x32, 0x0b,
+    0xf8, 0xc2, 0xac, 0x4b, 0xf2, 0x39, 0x31, 0xfd, 0x45, 0x03, 0xfe, 0x0a, 0xc3, 0xec, 0x0f, 0xef,
+    0x27, 0x10, 0x18, 0x08, 0x4e, 0x9c, 0xc5, 0x70, 0x28, 0xb3, 0x1a, 0x20, 0x7d, 0x5e, 0xca, 0x4a,
+    0xa2, 0x63, 0xeb, 0xc1, 0xaa, 0x45, 0x0b, 0x2a, 0x59, 0x9c, 0x68, 0xba, 0xdf, 0x96, 0xcc, 0x97,
+    0x5d, 0xdb, 0x48, 0x5f, 0xbf, 0x61, 0x94, 0x5a, 0xa8, 0x98, 0x4b, 0x8e, 0x7a, 0xe1, 0xca, 0x28,
+    0x3f, 0x93, 0xe7, 0x2a, 0xfa, 0xf6, 0xd9, 0x81, 0x8a, 0xb6, 0x40, 0xec, 0x22, 0xe7, 0x63, 0xe6,
+    0xe1, 0x74, 0xb1, 0x7b, 0xd5, 0xb9, 0x4c, 0x12, 0x88, 0xb0, 0x52, 0x22, 0x3e, 0xcd, 0xab, 0x35,
+    0x8a, 0x38, 0x43, 0x69, 0x92, 0x65, 0x26, 0x1f, 0x1f, 0xf0, 0xe5, 0xc9, 0x99, 0x3c, 0x2d, 0x0e,
+    0xc2, 0xa6, 0x84, 0x48, 0xd8, 0xc3, 0x39, 0xba, 0x4f, 0x42, 0x07, 0xef, 0xe8, 0xa4, 0xcd, 0x70,
+    0xae, 0xad, 0x78, 0xb0, 0x68, 0x5a, 0x33, 0x31, 0x07, 0x0a, 0x89, 0xac, 0xde, 0x41, 0xf4, 0x9d,
+    0x3e, 0x8c, 0xe6, 0x0b, 0x37, 0x65, 0xde, 0x11, 0xfd, 0xb1, 0x54, 0x39, 0x2f, 0x6f, 0x18, 0x4d,
+    0x9f, 0x9d, 0x15, 0x08, 0x39, 0x16, 0x7b, 0x77, 0x1e, 0x2e, 0x30, 0xc7, 0x2d, 0xad, 0x4b, 0xb8,
+    0x05, 0x7e, 0x22, 0x78, 0x75, 0xfe, 0x61, 0xd9, 0x0a, 0x83, 0x8a, 0x74, 0x22, 0x1e, 0x9e, 0x00,
+    0xdc, 0xd8, 0x4f, 0xe8, 0x7c, 0xd4, 0x34, 0xfe, 0x04, 0xcc, 0xee, 0x5c, 0xc3, 0x5f, 0xf2, 0x68,
+    0x93, 0xc9, 0x07, 0x7b, 0x53, 0x58, 0xe3, 0xce, 0xe6, 0xa5, 0x3f, 0x98, 0x3f, 0xf0, 0xd8, 0x74,
+    0x57, 0xec, 0xa0, 0x83, 0xbe, 0xa5, 0x6e, 0xe5, 0x2a, 0xb9, 0x8c, 0xb1, 0xf8, 0x95, 0x56, 0x40,
+    0x19, 0xce, 0x4e, 0x65, 0x4d, 0x12, 0xcf, 0xa9, 0x65, 0xa6, 0xb3, 0x28, 0x04, 0x0a, 0xc7, 0x68,
+    0x90, 0x26, 0xc4, 0x31, 0xb2, 0xa1, 0x4b, 0xf0, 0x06, 0x2f, 0x4e, 0x75, 0x36, 0x3c, 0x7d, 0x93,
+    0x47, 0xc1, 0xc9, 0xb7, 0x6c, 0x68, 0x9a, 0x44, 0x41, 0xa0, 0x86, 0x35, 0x63, 0x2a, 0xfd, 0xb2,
+    0x87, 0x04, 0xc9, 0x12, 0x34, 0x06, 0x7d, 0xce, 0x1c, 0x14, 0x26, 0x45, 0x48, 0x22, 0x24, 0x93,
+    0xd1, 0x61, 0x0e, 0x84, 0xe4, 0x3d, 0x96, 0xc3, 0x69, 0x01, 0x9c, 0xb6, 0x14, 0x8e, 0xbc, 0xea,
+    0x23, 0xa0, 0xf8, 0xf3, 0x52, 0xe8, 0x30, 0xe1, 0x8d, 0xc0, 0xc9, 0x97, 0xa5, 0xf0, 0xe1, 0xb3,
+    0x3f, 0x32, 0x22, 0xf8, 0x9a, 0x39, 0x86, 0x68, 0xc2, 0x4a, 0x45, 0xa2, 0x60, 0xf4, 0xed, 0x5f,
+    0x08, 0x48, 0x77, 0x9f, 0xf4, 0x25, 0x67, 0x58, 0xfd, 0x4f, 0x5c, 0x58, 0x8d, 0xad, 0xde, 0x0c,
+    0x0d, 0x28, 0xe6, 0x15, 0xbf, 0x33, 0x6d, 0xb5, 0x65, 0x06, 0xf6, 0x33, 0xf1, 0x88, 0xe0, 0x57,
+    0x06, 0xba, 0x78, 0x84, 0xb9, 0x23, 0xe5, 0x33, 0xf3, 0xa8, 0xf5, 0x3a, 0x90, 0xc1, 0x77, 0x80,
+    0x9e, 0xbe, 0xca, 0xd1, 0x0b, 0xc6, 0x5f, 0xa0, 0x96, 0xc0, 0x21, 0x27, 0xd2, 0xef, 0x72, 0x04,
+    0xcb, 0xcf, 0xba, 0x87, 0xb5, 0x08, 0xf8, 0x7b, 0xae, 0xde, 0xc0, 0x7f, 0x17, 0x3f, 0xf2, 0x42,
+    0x22, 0x97, 0x78, 0x41, 0x14, 0xdc, 0x7c, 0xa7, 0xee, 0xd5, 0x18, 0x8e, 0x7d, 0x27, 0x3f, 0xac,
+    0xc4, 0xa4, 0x7d, 0xc9, 0x70, 0x7a, 0x77, 0x88, 0x7e, 0x93, 0x0e, 0x3d, 0x44, 0x0e, 0x2e, 0xf5,
+    0x52, 0xf7, 0xaa, 0xbc, 0x2c, 0xd3, 0xb2, 0xe8, 0x6d, 0x45, 0x82, 0x29, 0x48, 0x13, 0xad, 0x8a,
+    0xdf, 0x96, 0x27, 0xa2, 0x46, 0x0a, 0x3f, 0xa9, 0x14, 0x3f, 0x7c, 0x52, 0x32, 0xc9, 0x12, 0x89,
+    0x9e, 0x6a, 0xe1, 0x4f, 0x2e, 0x2c, 0x1d, 0x42, 0xb9, 0x91, 0xba, 0x1a, 0x4f, 0x84, 0xcc, 0x68,
+    0x98, 0x3e, 0x85, 0x96, 0xef, 0x89, 0xe9, 0x18, 0x79, 0x49, 0x52, 0x2c, 0x8b, 0xfc, 0xa5, 0x0c,
+    0x1a, 0x1a, 0x96, 0xfa, 0x9c, 0xe0, 0xd0, 0x7b, 0x1e, 0x6c, 0xe7, 0xf8, 0x9b, 0x22, 0x12, 0x94,
+    0xae, 0x71, 0x74, 0x63, 0xc5, 0xfb, 0x3e, 0x5d, 0x8b, 0xff, 0x92, 0x18, 0xe5, 0x0c, 0xda, 0xf3,
+    0x50, 0xd1, 0x4e, 0x6a, 0x93, 0x25, 0x3f, 0xbd, 0x83, 0xba, 0xc8, 0xe6, 0x61, 0xfa, 0xd3, 0x21,
+    0x74, 0x84, 0xd4, 0x1e, 0x8f, 0x01, 0xf0, 0x5f, 0x4c, 0xfe, 0x80, 0x0d, 0x0f, 0xa0, 0xe1, 0x42,
+    0x3e, 0xca, 0xa1, 0x65, 0x19, 0x50, 0x31, 0x3f, 0x8e, 0x73, 0xb5, 0x2a, 0xeb, 0x5a, 0x86, 0xfa,
+    0xea, 0xa6, 0xeb, 0x29, 0xa6, 0x8a, 0x08, 0x39, 0x19, 0x5c, 0x9c, 0x9f, 0x22, 0xdf, 0x4c, 0xd9,
+    0x94, 0xa5, 0xd2, 0xc1, 0x8b, 0x44, 0x44, 0x0f, 0x77, 0x61, 0x19, 0xb8, 0x57, 0xa0, 0x45, 0xe8,
+    0x0e, 0xc3, 0x4a, 0x8a, 0x04, 0xf2, 0x84, 0x3f, 0x20, 0x92, 0x5a, 0xcb, 0x88, 0x3f, 0xb3, 0x72,
+    0xe4, 0x44, 0x32, 0xc0, 0xfa, 0xd0, 0x80, 0x6a, 0x16, 0x87, 0x82, 0x1f, 0x34, 0x8a, 0x31, 0x0a,
+    0xfd, 0xf8, 0x82, 0xf0, 0x05, 0x7c, 0x4a, 0x20, 0x67, 0xd9, 0x95, 0x9c, 0x62, 0xf9, 0x8f, 0x23,
+    0x5a, 0x26, 0xd6, 0x72, 0x7c, 0x86, 0xc1, 0xef, 0x3c, 0x8c, 0xa1, 0xa2, 0x3e, 0xa7, 0x2f, 0xd1,
+    0x09, 0xf3, 0xbe, 0xa7, 0x0f, 0xcc, 0xc9, 0x91, 0xf1, 0xc2, 0x06, 0x5c, 0x2e, 0x86, 0x8a, 0x1a,
+    0x92, 0x06, 0x98, 0x3e, 0x78, 0xb7, 0xbb, 0x17, 0x74, 0x09, 0xe7, 0x96, 0xa2, 0x41, 0x2d, 0x76,
+    0x06, 0x27, 0x12, 0x55, 0x6c, 0x9b, 0xfe, 0xaa, 0x04, 0xae, 0x8e, 0x08, 0xd4, 0x1e, 0x55, 0x85,
+    0x90, 0xbb, 0xff, 0xfd, 0xf0, 0xf7, 0x51, 0x4c, 0x38, 0x0f, 0xdc, 0x14, 0x27, 0xdc, 0x4f, 0xd4,
+    0xf6, 0x70, 0xce, 0x97, 0xe9, 0x23, 0x04, 0x39, 0x0e, 0xa0, 0xb9, 0x02, 0x70, 0x56, 0x8e, 0x23,
+    0xdd, 0x54, 0x0c, 0x63, 0xc1, 0x4b, 0xb0, 0x99, 0x38, 0xc1, 0x96, 0x75, 0xe2, 0x20, 0x30, 0x1a,
+    0x24, 0x0e, 0x8f, 0x25, 0xbb, 0x80, 0x46, 0x26, 0x5c, 0xf0, 0x44, 0x37, 0xa0, 0xc8, 0x02, 0x1d,
+    0x20, 0xa0, 0x5c, 0xda, 0x09, 0xb3, 0x30, 0x9b, 0x75, 0xe6, 0x17, 0x4e, 0xf8, 0xa7, 0x48, 0x44,
+    0x85, 0x65, 0xa0, 0x9b, 0xb9, 0xb1, 0x28, 0xb4, 0x11, 0x31, 0xa8, 0x3c, 0x06, 0xe5, 0x8f, 0x30,
+    0x65, 0x6b, 0xed, 0x04, 0x01, 0x5b, 0xf2, 0xd1, 0x73, 0xb1, 0x6d, 0x49, 0xca, 0x53, 0x0c, 0x19,
+    0x1e, 0x3b, 0x42, 0x75, 0x8a, 0xea, 0x21, 0x5f, 0x15, 0x03, 0xe3, 0x62, 0xd9, 0x9c, 0xc7, 0xd4,
+    0xa3, 0xa7, 0xe4, 0xb9, 0xfd, 0x8d, 0x8d, 0xf7, 0x9c, 0x98, 0xdb, 0x3f, 0x28, 0xd1, 0x1f, 0x82,
+    0xa5, 0xbf, 0x0a, 0x8b, 0xb6, 0x8d, 0x06, 0xaa, 0x56, 0xa2, 0x32, 0x43, 0x25, 0x99, 0x85, 0x91,
+    0x32, 0xd5, 0x8d, 0x45, 0x8d, 0x29, 0xc9, 0xdc, 0x8f, 0x3a, 0xd1, 0xd3, 0xc6, 0x1a, 0x40, 0x65,
+    0xfd, 0xa4, 0x71, 0xaa, 0x38, 0x63, 0x7c, 0xd3, 0xcf, 0xbc, 0x3a, 0xaf, 0x81, 0xdf, 0x25, 0x0d,
+    0xfd, 0xc1, 0xaf, 0xd8, 0xc9, 0x46, 0x4a, 0x27, 0xb0, 0x15, 0x0d, 0x15, 0xc9, 0xb3, 0x18, 0x82,
+    0x21, 0xa3, 0xbd, 0xd1, 0xde, 0x48, 0x21, 0x6d, 0xc8, 0x22, 0xc6, 0x0e, 0xaa, 0xa8, 0x2f, 0x24,
+    0x31, 0x26, 0x28, 0xd9, 0xd9, 0x0a, 0xf0, 0xa0, 0x3a, 0xd5, 0x02, 0x79, 0xf7, 0xc1, 0x36, 0x0f,
+    0xad, 0x79, 0xc1, 0x9d, 0x28, 0x38, 0x94, 0x94, 0xc0, 0x96, 0x3d, 0x07, 0xa8, 0xdc, 0xb4, 0x80,
+    0xfe, 0x85, 0xdf, 0x77, 0x90, 0x07, 0x25, 0xe8, 0x7f, 0xc5, 0x9d, 0x1c, 0x4b, 0x30, 0x92, 0xa9,
+    0x45, 0xc9, 0xa6, 0x3b, 0x6b, 0x0d, 0xe8, 0x26, 0x9e, 0x06, 0x6f, 0xaf, 0xb4, 0x3c, 0x08, 0xce,
+    0xbd, 0x82, 0x82, 0xaa, 0x53, 0x6b, 0x80, 0xd4, 0xa6, 0xee, 0x53, 0x01, 0x69, 0xde, 0x84, 0x25,
+    0x24, 0x4e, 0x5a, 0x72, 0x1e, 0x7d, 0x3a, 0x0e, 0x58, 0x64, 0xb9, 0x3a, 0xb2, 0xae, 0x1a, 0x70,
+    0xa0, 0xa1, 0x44, 0x85, 0x4a, 0x9e, 0x65, 0xd7, 0x40, 0xa1, 0x1a, 0x0c, 0x96, 0x29, 0x78, 0x42,
+    0x00, 0x0c, 0x6b, 0x2a, 0x65, 0x0a, 0xfb, 0x3b, 0x0e, 0xea, 0x50, 0x25, 0x3d, 0x2b, 0x66, 0x2a,
+    0xc9, 0x6a, 0x52, 0x0e, 0x5b, 0x12, 0xfa, 0x43, 0xb1, 0xa1, 0xbc, 0x6d, 0x0d, 0x38, 0xe4, 0x45,
+    0xdc, 0xfb, 0xc6, 0xc6, 0x46, 0x11, 0xc7, 0x71, 0x14, 0x0f, 0x5d, 0xa3, 0x2c, 0x49, 0xff, 0x0a,
+    0xb4, 0x61, 0x5e, 0x08, 0x1b, 0xcb, 0x5b, 0x49, 0x25, 0xc1, 0xaf, 0x41, 0x14, 0xdf, 0xb3, 0xa2,
+    0x4f, 0xfb, 0x71, 0xb5, 0x08, 0xa9, 0xe1, 0x68, 0x00, 0x1c, 0xc2, 0x3d, 0x28, 0xa7, 0xa5, 0x8a,
+    0x64, 0xba, 0x52, 0xae, 0xe1, 0x20, 0xfd, 0x0d, 0x4f, 0x34, 0xb4, 0x1c, 0x0d, 0x3a, 0x85, 0xa1,
+    0x45, 0x58, 0x44, 0x97, 0x45, 0xfe, 0x2a, 0x04, 0xb5, 0x88, 0x09, 0xe1, 0xa3, 0x87, 0x4c, 0x41,
+    0x31, 0x99, 0xae, 0xe1, 0xe3, 0x37, 0x7a, 0xdb, 0x87, 0x08, 0xf4, 0xa7, 0xa6, 0x8b, 0xd6, 0x5c,
+    0xb5, 0xe7, 0x40, 0x1e, 0x39, 0x04, 0x27, 0xf9, 0xf1, 0x83, 0x99, 0xa3, 0xd8, 0x76, 0x64, 0x00,
+    0x19, 0xd2, 0xa5, 0x1c, 0x28, 0x60, 0x29, 0x6f, 0x07, 0xfc, 0x0c, 0x74, 0x46, 0x62, 0x10, 0xa6,
+    0x10, 0x29, 0x43, 0xd7, 0x32, 0x7c, 0x0f, 0x06, 0x4e, 0x7c, 0xe4, 0x85, 0xda, 0x80, 0xb1, 0x49,
+    0xfb, 0x7c, 0x61, 0x05, 0xc8, 0x49, 0x0b, 0xc2, 0x1f, 0x1e, 0xfa, 0xf1, 0x93, 0xad, 0x8f, 0xae,
+    0xbe, 0x3c, 0x72, 0xa2, 0xb5, 0x07, 0xa8, 0x40, 0x84, 0x94, 0xec, 0xe4, 0x7f, 0x66, 0x5b, 0xf0,
+    0x12, 0x2b, 0xa3, 0xc4, 0x87, 0x8c, 0x61, 0xad, 0x2e, 0xd2, 0xce, 0x40, 0x8a, 0x2e, 0xba, 0x46,
+    0xc6, 0x6b, 0xd0, 0xf4, 0xd7, 0x9a, 0xe9, 0x4d, 0x0a, 0xd6, 0xa8, 0x80, 0x22, 0x45, 0xb1, 0x8c,
+    0x7e, 0x3d, 0x3a, 0xfc, 0xed, 0x04, 0x4c, 0xc5, 0x8c, 0xb2, 0x61, 0x68, 0x19, 0xda, 0xda, 0x58,
+    0x72, 0x71, 0x7f, 0x56, 0x20, 0x2f, 0xb5, 0x6b, 0x40, 0x0e, 0x6c, 0x6e, 0x63, 0xa3, 0xf4, 0xed,
+    0x1b, 0xe8, 0x93, 0xe4, 0xbf, 0x0b, 0xbe, 0x7d, 0x2b, 0x6d, 0x6c, 0x14, 0x63, 0x17, 0xee, 0x29,
+    0x39, 0x8e, 0xd0, 0x31, 0x3b, 0x2d, 0x37, 0x22, 0xd0, 0x42, 0xb8, 0xf4, 0x24, 0x2b, 0xe2, 0x62,
+    0xe4, 0x19, 0x87, 0xb4, 0x86, 0x69, 0xa4, 0xcd, 0x6d, 0x84, 0xff, 0x49, 0xd8, 0x67, 0x64, 0xd3,
+    0x48, 0xac, 0x23, 0xc3, 0x9a, 0x15, 0x16, 0x35, 0xc6, 0x90, 0x97, 0x99, 0x58, 0x50, 0x10, 0x40,
+    0x17, 0xae, 0x98, 0xfa, 0x54, 0x21, 0x2b, 0x0f, 0x7b, 0xa4, 0x62, 0xc5, 0x45, 0x6f, 0x21, 0x67,
+    0x8a, 0xa3, 0xe1, 0xdf, 0x80, 0xd9, 0xf8, 0x9f, 0x67, 0xb8, 0x18, 0x39, 0xca, 0x14, 0xba, 0x20,
+    0x31, 0x1e, 0xad, 0x17, 0xfc, 0x19, 0xea, 0x3b, 0x0e, 0x9d, 0x8a, 0x61, 0x05, 0x41, 0xd6, 0x24,
+    0xa8, 0x2b, 0x35, 0x4b, 0x6a, 0x92, 0x08, 0x41, 0x72, 0x8e, 0xd4, 0xcc, 0x58, 0x30, 0x24, 0x6e,
+    0xdb, 0x28, 0x52, 0x5b, 0xaf, 0x4d, 0x10, 0x77, 0xc0, 0xef, 0x18, 0x19, 0x45, 0xe4, 0x39, 0x8a,
+    0x19, 0x48, 0x5a, 0x76, 0x13, 0xb6, 0x8a, 0x9c, 0x34, 0x5b, 0xe9, 0x14, 0x54, 0x46, 0xfb, 0x8e,
+    0x8b, 0x64, 0x81, 0x13, 0x31, 0x90, 0x5a, 0x56, 0xac, 0xf4, 0x23, 0x50, 0xe4, 0x98, 0x9f, 0x5e,
+    0x39, 0x94, 0xe8, 0xdf, 0xa4, 0x9c, 0x50, 0x62, 0xac, 0x75, 0xe5, 0x60, 0x7b, 0x4a, 0x40, 0x87,
+    0x5f, 0x33, 0x2c, 0x62, 0x33, 0x6e, 0x55, 0xc4, 0xb6, 0x23, 0x75, 0xc9, 0x30, 0xb5, 0x8f, 0xcd,
+    0x91, 0x65, 0x75, 0x21, 0xcd, 0x38, 0x2b, 0xf6, 0x13, 0x41, 0xd7, 0x05, 0xe4, 0x22, 0x84, 0x5f,
+    0x74, 0x44, 0x60, 0x24, 0x5b, 0x52, 0x40, 0x50, 0xa8, 0xd2, 0x12, 0xda, 0x74, 0xc8, 0xbf, 0xf7,
+    0xb3, 0xe9, 0xe7, 0x19, 0x08, 0x1b, 0xb0, 0x60, 0x5d, 0xaf, 0x01, 0x19, 0x3d, 0x65, 0xb1, 0xd0,
+    0xaf, 0x22, 0xc6, 0x02, 0x96, 0x94, 0xef, 0x5d, 0x62, 0x27, 0x43, 0xdf, 0xf3, 0x2c, 0x73, 0x7d,
+    0xba, 0x3f, 0x4a, 0xb6, 0x2c, 0xed, 0x74, 0x5a, 0x9d, 0xec, 0xd8, 0x2b, 0x9c, 0x00, 0xb9, 0x0e,
+    0xbc, 0x4f, 0x07, 0x1f, 0xe2, 0x4b, 0x8d, 0x6f, 0x2b, 0x95, 0xca, 0xbf, 0x12, 0x01, 0x21, 0xfe,
+    0x13, 0x79, 0x86, 0xd0, 0xb9, 0x33, 0x5e, 0x9d, 0xa7, 0xa4, 0x64, 0xf9, 0xd4, 0x82, 0xfe, 0xcc,
+    0x5a, 0x44, 0x59, 0xaa, 0x4a, 0x23, 0x89, 0x19, 0xf0, 0x7b, 0xe2, 0x9e, 0x35, 0x7b, 0xe8, 0x10,
+    0x6e, 0x41, 0x79, 0xd9, 0xd0, 0x55, 0x73, 0x8f, 0xa4, 0x1d, 0xa9, 0x2c, 0xd1, 0x70, 0x88, 0xcd,
+    0x6e, 0x2d, 0xf3, 0xe8, 0x0e, 0x75, 0xd2, 0x0c, 0x1b, 0xe9, 0x8e, 0x11, 0xb6, 0x04, 0x9c, 0xac,
+    0xa6, 0x42, 0x46, 0xb9, 0xbc, 0x2c, 0x2e, 0xe2, 0x3a, 0xea, 0x6a, 0x52, 0x5c, 0x8c, 0x66, 0xfe,
+    0xad, 0x40, 0xea, 0x3d, 0xb9, 0xe8, 0xdf, 0x63, 0x99, 0xb3, 0xec, 0x9d, 0x75, 0xe9, 0x76, 0x59,
+    0x0c, 0xb2, 0x5c, 0x69, 0xbf, 0x1d, 0xf6, 0x6c, 0x65, 0x3a, 0xed, 0xc4, 0x60, 0xec, 0x9d, 0xe9,
+    0xcf, 0x14, 0xd5, 0x80, 0x1c, 0xb8, 0xed, 0xdd, 0x6d, 0x7e, 0x3b, 0x75, 0xe7, 0x61, 0x07, 0xd9,
+    0x4b, 0x0e, 0x4a, 0xe4, 0x74, 0xb4, 0x71, 0x50, 0x22, 0xff, 0x29, 0x8e, 0x8d, 0x03, 0x74, 0x50,
+    0xa2, 0x27, 0x27, 0xb2, 0xd8, 0x46, 0x78, 0x34, 0x3b, 0xd0, 0xf4, 0x57, 0x80, 0x13, 0x77, 0x75,
+    0x01, 0xc5, 0xf3, 0x02, 0xd0, 0xb5, 0x7a, 0xbc, 0x78, 0xb5, 0x11, 0x3b, 0x0a, 0x1e, 0xa0, 0x80,
+    0xdf, 0x75, 0xd4, 0xba, 0x80, 0x7e, 0xcc, 0xb9, 0xa6, 0x4f, 0x95, 0x31, 0x2c, 0xd9, 0xe6, 0x78,
+    0x7f, 0xa8, 0xb8, 0x70, 0x67, 0x2b, 0xaf, 0xdf, 0xb6, 0xba, 0xbd, 0x99, 0xf4, 0xe3, 0x78, 0x6c,
+    0x35, 0x9b, 0xcd, 0xe6, 0x65, 0xff, 0x66, 0xd2, 0xb9, 0x19, 0x37, 0x9b, 0xcd, 0xd6, 0x35, 0xfa,
+    0x3e, 0x3a, 0x6c, 0x3e, 0x34, 0x9b, 0xcd, 0xb6, 0x39, 0xf0, 0x2b, 0x5d, 0xd4, 0xd0, 0xbc, 0xbf,
+    0xec, 0xf7, 0xa4, 0xd3, 0xa6, 0xe3, 0x6e, 0xa9, 0x3b, 0x18, 0xa4, 0x67, 0x5e, 0xdf, 0xc8, 0xad,
+    0x66, 0xf3, 0x70, 0xfe, 0x34, 0x7b, 0xad, 0x3e, 0x5c, 0xdf, 0xa0, 0xc6, 0x33, 0xb5, 0x33, 0x79,
+    0x54, 0x67, 0xcd, 0x66, 0xdb, 0xbd, 0x68, 0x36, 0x9b, 0xbb, 0xed, 0xa6, 0xaa, 0xbd, 0xbe, 0x1c,
+    0xa3, 0x01, 0x97, 0x97, 0xfd, 0x9b, 0x5e, 0xeb, 0xb6, 0x33, 0x39, 0x37, 0x1f, 0x95, 0xdd, 0x4b,
+    0xdf, 0x6b, 0x1d, 0x5d, 0x3c, 0x56, 0xd4, 0xc9, 0xb5, 0xa2, 0x4b, 0xbb, 0x4f, 0xb2, 0xe1, 0x49,
+    0xc7, 0x2f, 0x47, 0x37, 0x9d, 0x1f, 0x77, 0xc7, 0xb0, 0xd9, 0x92, 0x7e, 0xd8, 0xa3, 0x97, 0xdb,
+    0x8b, 0xd3, 0xb6, 0x75, 0xd4, 0xdd, 0xbe, 0xea, 0xb4, 0x9f, 0x5b, 0xb7, 0x33, 0x38, 0x3b, 0xbc,
+    0xb9, 0xbc, 0xd5, 0x5a, 0xd7, 0xd6, 0xed, 0xd5, 0xe5, 0x54, 0xdb, 0xab, 0xb8, 0xaf, 0x7b, 0xce,
+    0xd9, 0x49, 0xc7, 0x7f, 0x75, 0xee, 0x8f, 0xdf, 0xba, 0x6f, 0x25, 0xf3, 0xa9, 0x32, 0x7a, 0x75,
+    0x17, 0xdd, 0xfb, 0x23, 0xed, 0xfe, 0x76, 0xb7, 0xf5, 0x6a, 0x19, 0xd7, 0x2f, 0x65, 0x38, 0x9c,
+    0xda, 0x76, 0x59, 0x33, 0x35, 0x73, 0x51, 0x75, 0xce, 0x9e, 0xe1, 0xa8, 0xb2, 0x77, 0x66, 0x3c,
+    0xde, 0xdd, 0x4e, 0xe7, 0xd5, 0xd1, 0xe5, 0x7c, 0x07, 0x9a, 0xb6, 0xab, 0x9d, 0xf4, 0x6e, 0x5c,
+    0xa7, 0xaa, 0xf4, 0xce, 0x8f, 0x77, 0xfd, 0x5d, 0x7f, 0xae, 0x54, 0xef, 0x87, 0xe5, 0x6d, 0x6f,
+    0x2a, 0x97, 0xa6, 0x4f, 0xb3, 0x87, 0xe3, 0x56, 0x73, 0xe0, 0x6e, 0x77, 0x87, 0xc7, 0x9a, 0xf9,
+    0x58, 0x3e, 0xde, 0x3e, 0xf6, 0xb7, 0x1e, 0xfa, 0xdd, 0xe3, 0xd1, 0xbd, 0xbc, 0xf7, 0x70, 0xe7,
+    0x39, 0x3f, 0xaa, 0xbd, 0x87, 0xc9, 0xc5, 0x55, 0x7b, 0xf6, 0xd6, 0x2c, 0x5d, 0xcd, 0x37, 0xaf,
+    0xcd, 0xed, 0x1d, 0xa8, 0x4c, 0xca, 0xb7, 0xf6, 0xc3, 0x85, 0x7b, 0x72, 0x5d, 0xbd, 0x6a, 0x6f,
+    0x9f, 0xef, 0x3e, 0x1d, 0xce, 0xae, 0xe4, 0xbb, 0x17, 0xf9, 0x65, 0xf2, 0x5a, 0xde, 0x2b, 0xa9,
+    0xde, 0xc8, 0xe8, 0xcf, 0x9e, 0xb6, 0x36, 0xaf, 0x86, 0x77, 0x67, 0xfa, 0xb5, 0x7f, 0x25, 0xef,
+    0xdd, 0xde, 0xee, 0x36, 0xc7, 0x25, 0x47, 0x33, 0x0f, 0x8f, 0xaf, 0xf6, 0x86, 0xf7, 0x72, 0xa5,
+    0x04, 0x2b, 0x7b, 0xa5, 0xa1, 0x7c, 0xd9, 0xbf, 0xd1, 0xee, 0x1f, 0xcb, 0x65, 0xdf, 0x79, 0x79,
+    0x71, 0x3a, 0xa6, 0x74, 0x51, 0xba, 0x7a, 0xdb, 0x1b, 0x0e, 0xcb, 0xdb, 0xae, 0xfd, 0xb4, 0x55,
+    0xbe, 0x2c, 0x6b, 0x6f, 0xaa, 0x79, 0x5e, 0xae, 0xbe, 0x5e, 0x3e, 0x69, 0x95, 0xc7, 0xca, 0xe5,
+    0x9b, 0xbb, 0xab, 0xcc, 0xab, 0xf0, 0xe4, 0xe9, 0x61, 0x71, 0x51, 0xbe, 0x38, 0x69, 0x8d, 0xef,
+    0xaf, 0x77, 0x3a, 0x67, 0xc3, 0xf3, 0xc7, 0x9e, 0xf1, 0x70, 0x27, 0x7b, 0x03, 0xf5, 0xf8, 0x48,
+    0x56, 0x2b, 0x17, 0x4f, 0x8f, 0x4f, 0xad, 0xee, 0xf5, 0x9d, 0xf2, 0xea, 0xec, 0x6c, 0xca, 0x57,
+    0x4f, 0xd5, 0xd2, 0xed, 0xde, 0xb4, 0xd3, 0xe9, 0x5e, 0x6b, 0x8f, 0x6f, 0xee, 0x6c, 0xd2, 0xf2,
+    0xfd, 0xcb, 0xf6, 0xf3, 0xb6, 0x32, 0x38, 0x2a, 0x6f, 0x5a, 0xfa, 0xf0, 0xa4, 0x63, 0xb7, 0x64,
+    0xaf, 0xb3, 0xdd, 0x7d, 0x72, 0xfa, 0xaf, 0xc6, 0xce, 0x6b, 0x79, 0xb3, 0x3d, 0xb6, 0x9a, 0xb3,
+    0xfe, 0xf3, 0xd3, 0xec, 0x44, 0x3d, 0x9d, 0x0e, 0x2f, 0xb4, 0xf6, 0xa8, 0xb2, 0xd8, 0xbb, 0x1f,
+    0x1f, 0x95, 0xf4, 0xad, 0xd6, 0xb9, 0x3a, 0x9b, 0x5d, 0xdd, 0x3d, 0xd9, 0x93, 0xeb, 0xe3, 0x87,
+    0x9e, 0x6a, 0xda, 0xde, 0x69, 0x53, 0xdf, 0xe9, 0x9b, 0xc7, 0x3f, 0xe6, 0x0a, 0x92, 0x49, 0xf9,
+    0x7c, 0xea, 0xde, 0x5f, 0xce, 0x3a, 0xf7, 0xce, 0xeb, 0xee, 0xe6, 0x9e, 0xe2, 0x57, 0xd4, 0x87,
+    0xde, 0x9b, 0x76, 0x37, 0xef, 0x6e, 0x2e, 0xf4, 0x87, 0x51, 0x5b, 0xf2, 0xce, 0xfa, 0xed, 0xce,
+    0xfd, 0xf5, 0xd4, 0x3e, 0xbe, 0x6b, 0xed, 0x5c, 0x5e, 0xff, 0x38, 0xed, 0x6d, 0x3d, 0xdf, 0xbc,
+    0x38, 0x37, 0x2f, 0x86, 0x75, 0xa2, 0x49, 0x97, 0x17, 0x6f, 0x17, 0x6f, 0x0f, 0x77, 0x7b, 0xaf,
+    0xe7, 0x6f, 0xee, 0xd3, 0x78, 0x36, 0xee, 0xf5, 0xce, 0x1f, 0x76, 0xca, 0x17, 0x5b, 0x63, 0xd7,
+    0xb9, 0xbe, 0x9b, 0x6c, 0xc1, 0x93, 0xde, 0x43, 0x53, 0xde, 0x83, 0xb6, 0xb9, 0x77, 0x74, 0xae,
+    0xf7, 0xf4, 0xad, 0x39, 0x5c, 0x94, 0xcb, 0xd7, 0x73, 0xeb, 0x50, 0x6b, 0x6d, 0x8d, 0x4e, 0xca,
+    0xf2, 0xd3, 0x83, 0xd4, 0x9d, 0xef, 0x4d, 0xf7, 0x1e, 0xbd, 0xc5, 0xd1, 0xdb, 0xa8, 0x73, 0x3d,
+    0xf7, 0x5f, 0x9b, 0xf6, 0xe9, 0xcd, 0xde, 0xd5, 0x60, 0x21, 0x9d, 0xa9, 0x76, 0x6b, 0x32, 0x3b,
+    0xd1, 0xf4, 0x1f, 0xa7, 0x0f, 0x1d, 0xe3, 0xb1, 0x3f, 0xb8, 0x52, 0x5f, 0x9a, 0x83, 0xf6, 0xb0,
+    0x7d, 0x7c, 0x73, 0xfd, 0xea, 0xdd, 0x6c, 0x9b, 0xcf, 0xfe, 0x04, 0x2e, 0xfa, 0x87, 0x72, 0x6f,
+    0xf4, 0x70, 0x77, 0x34, 0x79, 0x94, 0x4e, 0xcb, 0x8b, 0x61, 0xf3, 0xfa, 0xc2, 0xdf, 0x5a, 0xb4,
+    0xf7, 0x76, 0x37, 0xcf, 0xf5, 0xeb, 0xa7, 0x8b, 0xc5, 0x7d, 0x57, 0xeb, 0x8d, 0x7f, 0xbc, 0x0d,
+    0x6f, 0x0e, 0x77, 0xd5, 0x9d, 0xa6, 0x36, 0xe8, 0xb6, 0xfd, 0x8b, 0x8b, 0xfe, 0xf8, 0x7e, 0xab,
+    0x7d, 0x71, 0x35, 0xeb, 0x1f, 0xb7, 0xfd, 0xce, 0xf8, 0x72, 0xeb, 0xe9, 0xc7, 0x09, 0x7c, 0xb0,
+    0x6c, 0x78, 0x7a, 0x36, 0xba, 0x7c, 0xb8, 0x9b, 0x58, 0xca, 0xd1, 0x55, 0xeb, 0xec, 0xfa, 0x66,
+    0x30, 0x1b, 0xb6, 0xc7, 0x5b, 0x25, 0xc7, 0x39, 0x39, 0x1e, 0x1d, 0x1f, 0x5d, 0x9d, 0x96, 0xbc,
+    0x99, 0xda, 0xe9, 0x1e, 0x0d, 0xfb, 0x2f, 0x87, 0x4f, 0x17, 0xd0, 0xef, 0xa9, 0xf3, 0x8b, 0x1f,
+    0xc7, 0x3f, 0xba, 0x1d, 0xfd, 0xb0, 0xe2, 0x57, 0xcf, 0xce, 0xca, 0x5a, 0x45, 0x1b, 0x56, 0x9e,
+    0xee, 0x9b, 0x2f, 0xf3, 0xde, 0x63, 0xbb, 0x6d, 0x5a, 0x33, 0xc9, 0x6f, 0x1e, 0xce, 0xf4, 0xb2,
+    0x5b, 0xda, 0xba, 0x5f, 0x1c, 0xb6, 0xe7, 0x6a, 0x79, 0xb8, 0xf9, 0x50, 0xbd, 0xda, 0xec, 0x6e,
+    0xb7, 0x5a, 0xc7, 0xad, 0xe6, 0xd5, 0xd3, 0xec, 0xd9, 0xe8, 0x75, 0x17, 0x0f, 0xa5, 0xf9, 0xe8,
+    0xb1, 0xbf, 0xd5, 0x79, 0x7c, 0xdb, 0xda, 0x72, 0x1f, 0xb6, 0xaf, 0x3b, 0x9d, 0xc1, 0xd5, 0xcb,
+    0x53, 0xaf, 0xfa, 0x72, 0x3e, 0x95, 0xcb, 0x95, 0xa1, 0x7f, 0xe9, 0x5b, 0xb3, 0xf6, 0xf8, 0x6d,
+    0xdb, 0xea, 0xbc, 0x76, 0xae, 0x87, 0xf2, 0xce, 0xb8, 0xb9, 0xfb, 0xec, 0xca, 0xca, 0x71, 0x6b,
+    0xf3, 0x6c, 0xbb, 0x3b, 0xae, 0xbe, 0x55, 0xce, 0x47, 0xd5, 0xed, 0xfb, 0xa3, 0x6d, 0xf8, 0xf8,
+    0x5c, 0xbd, 0x32, 0xf4, 0xfe, 0x71, 0xf9, 0xc4, 0x39, 0x83, 0x2d, 0x63, 0xfb, 0xe2, 0xf1, 0xca,
+    0xd8, 0x85, 0x15, 0xcf, 0x69, 0x9e, 0x6e, 0x1e, 0xdf, 0xf4, 0xe7, 0xb7, 0x2f, 0xbe, 0xdd, 0x3b,
+    0x3a, 0x9b, 0x1d, 0xfe, 0xb8, 0x90, 0xda, 0x0f, 0xad, 0x9e, 0xac, 0x5f, 0xbf, 0x95, 0xdc, 0x89,
+    0xa1, 0x7a, 0xed, 0xc3, 0xce, 0x8f, 0x2e, 0x54, 0x6e, 0x9a, 0x97, 0x0f, 0x56, 0x73, 0xab, 0x3a,
+    0xb8, 0x9a, 0xb4, 0xaf, 0x07, 0xcf, 0xea, 0xd3, 0xf4, 0x7c, 0x77, 0xea, 0x78, 0x8b, 0xae, 0x73,
+    0x7d, 0x7d, 0xfb, 0x63, 0xfc, 0x56, 0x3a, 0x74, 0x07, 0xd2, 0xde, 0x95, 0x3e, 0xbb, 0x59, 0xdc,
+    0x5d, 0x56, 0x60, 0xe5, 0xc5, 0xb9, 0x9d, 0x0d, 0xad, 0xc7, 0xf3, 0xeb, 0xf9, 0xe0, 0xf9, 0xb2,
+    0xf2, 0xb0, 0x3b, 0x95, 0xe7, 0xea, 0xed, 0xb1, 0xab, 0xdc, 0x76, 0xab, 0xf7, 0xfd, 0xdd, 0xb9,
+    0x06, 0xdf, 0xd4, 0xf6, 0x9d, 0x3c, 0xde, 0x1b, 0xfb, 0x03, 0xed, 0xfe, 0x70, 0x36, 0xf6, 0x6d,
+    0xed, 0x0d, 0xf9, 0xb3, 0x66, 0xeb, 0xac, 0x77, 0xb3, 0xdd, 0x71, 0x9e, 0xcf, 0xc6, 0xe3, 0x71,
+    0xbd, 0xce, 0xb8, 0xc9, 0x83, 0x92, 0xa6, 0xbf, 0x32, 0x5f, 0x5d, 0x5b, 0x31, 0xb9, 0xff, 0xa1,
+    0x23, 0xdc, 0x11, 0x87, 0xc3, 0xee, 0x37, 0x4c, 0x7b, 0x08, 0x0d, 0x89, 0x85, 0x22, 0x1e, 0x3d,
+    0x70, 0xdf, 0xac, 0xeb, 0xa6, 0x07, 0x7f, 0xa1, 0xb1, 0xc1, 0xf5, 0xec, 0x64, 0xc3, 0x0b, 0x0e,
+    0xb4, 0x49, 0x8f, 0x3e, 0x91, 0x1b, 0x5d, 0xda, 0x75, 0x50, 0x9a, 0xc8, 0x89, 0x5e, 0x06, 0x4d,
+    0xec, 0x98, 0x9d, 0xc0, 0x92, 0x84, 0x0d, 0x0f, 0xa1, 0x1c, 0xb8, 0x00, 0xb6, 0x71, 0x48, 0xee,
+    0xcf, 0x63, 0xf5, 0x07, 0x09, 0xee, 0xad, 0xa4, 0x05, 0x9f, 0xce, 0x85, 0x46, 0xc4, 0x3d, 0x6e,
+    0x99, 0x41, 0x83, 0xf2, 0xf1, 0x8f, 0xdf, 0xab, 0x5b, 0xdb, 0xf2, 0x7e, 0xc6, 0x24, 0x59, 0xcd,
+    0x9f, 0x5d, 0x17, 0x2a, 0x45, 0xfd, 0xc2, 0x05, 0xe1, 0x2b, 0xeb, 0x60, 0x25, 0x2b, 0xd0, 0xf2,
+    0x7b, 0x70, 0x2f, 0x0d, 0xd4, 0xe3, 0xbc, 0x62, 0xab, 0x25, 0x1a, 0xe4, 0xef, 0x83, 0x12, 0x81,
+    0xcc, 0x98, 0xe4, 0xb3, 0xf3, 0xd3, 0xea, 0x9a, 0x5a, 0x36, 0x81, 0x2e, 0xbe, 0x66, 0xc1, 0x04,
+    0xc6, 0x1f, 0xf6, 0x64, 0x23, 0xc5, 0xe3, 0x2c, 0x1b, 0x67, 0xf7, 0x31, 0x03, 0xeb, 0x82, 0x24,
+    0x34, 0xce, 0xf5, 0x57, 0x78, 0x50, 0x22, 0xcd, 0x1f, 0x1a, 0x2b, 0x0b, 0x0d, 0x59, 0x42, 0x4f,
+    0xc1, 0x7c, 0x0f, 0xba, 0x9f, 0xc2, 0x50, 0x16, 0x1a, 0x32, 0x98, 0x58, 0xbe, 0xb3, 0x7a, 0xf4,
+    0x41, 0x89, 0x2c, 0xf8, 0x43, 0x7c, 0xe6, 0x34, 0x27, 0xfd, 0x0e, 0xf9, 0xba, 0xc4, 0x21, 0xc4,
+    0x0c, 0x24, 0xe5, 0x13, 0x06, 0x51, 0xef, 0x72, 0xb7, 0x10, 0xcb, 0x3d, 0x66, 0xb8, 0x05, 0xfe,
+    0xda, 0x56, 0x1a, 0xc5, 0x2a, 0x6b, 0x4b, 0x5a, 0x1c, 0x35, 0x36, 0xdc, 0xc4, 0xf8, 0x53, 0x4e,
+    0x05, 0x4f, 0x60, 0x46, 0x60, 0xb9, 0x47, 0x88, 0x4d, 0x32, 0xc0, 0xf5, 0x3b, 0xab, 0xe7, 0xa0,
+    0x55, 0x3f, 0x9f, 0x99, 0xe2, 0xdc, 0x9a, 0xad, 0xc6, 0x8f, 0xea, 0x84, 0x3e, 0x83, 0xfc, 0x44,
+    0x1f, 0x4f, 0x56, 0x63, 0xc7, 0x25, 0x45, 0x1f, 0x40, 0xff, 0x79, 0x5f, 0x1a, 0xcb, 0x33, 0x67,
+    0xf9, 0x53, 0xfa, 0x53, 0x97, 0xec, 0x10, 0x72, 0x48, 0x21, 0xa3, 0x13, 0x4e, 0x9e, 0x40, 0xff,
+    0x33, 0xe6, 0x62, 0xa7, 0xd4, 0x10, 0x99, 0xc9, 0xd5, 0x69, 0x1b, 0x90, 0x12, 0xcb, 0xbf, 0x6f,
+    0x25, 0x1f, 0xda, 0x64, 0x9e, 0x6d, 0x46, 0x96, 0x98, 0x23, 0xb4, 0xc6, 0x6b, 0xe5, 0xd6, 0xf0,
+    0xac, 0x73, 0x47, 0xea, 0x6b, 0x8c, 0xd4, 0xb8, 0x23, 0xb5, 0xd5, 0x23, 0xf1, 0x0d, 0x3b, 0x6f,
+    0x30, 0x29, 0x0e, 0x5b, 0x39, 0xbe, 0x8b, 0x0b, 0xc1, 0x78, 0x08, 0x68, 0xbd, 0xd8, 0x4a, 0x0c,
+    0x7d, 0x5a, 0x18, 0xc6, 0xc3, 0x11, 0xd6, 0x90, 0x35, 0xfe, 0xbb, 0xda, 0x1c, 0xad, 0xe5, 0x9f,
+    0x54, 0x64, 0xfa, 0x54, 0x3b, 0xad, 0xcb, 0x27, 0xa4, 0xde, 0xb3, 0x87, 0x2e, 0x70, 0xff, 0xc3,
+    0xda, 0xcc, 0x84, 0x4a, 0xa1, 0x64, 0xd8, 0x4a, 0xbd, 0x95, 0xe2, 0x6d, 0xe2, 0xc2, 0xbc, 0x0c,
+    0x14, 0xb4, 0x8a, 0xef, 0xbf, 0x2c, 0xdd, 0x80, 0xef, 0xff, 0x3d, 0xe9, 0x1a, 0xde, 0x04, 0x88,
+    0x53, 0x17, 0xe8, 0x26, 0x30, 0x2c, 0xcb, 0xce, 0x7d, 0xc1, 0xc6, 0xfe, 0x9f, 0xe3, 0x1d, 0x7a,
+    0xb7, 0xff, 0x15, 0xbc, 0x4b, 0xb2, 0x31, 0x54, 0x96, 0xf8, 0xbb, 0xd2, 0x50, 0x7d, 0x63, 0xad,
+    0x0c, 0xb6, 0x89, 0xdc, 0x08, 0xee, 0xc9, 0xc8, 0x4e, 0x9a, 0x18, 0x40, 0xde, 0xb8, 0xc6, 0x30,
+    0x93, 0xa6, 0xc6, 0x1f, 0xbf, 0xa3, 0x0a, 0x87, 0x9d, 0xfd, 0x30, 0x94, 0x67, 0xa5, 0x10, 0x33,
+    0x1d, 0xe6, 0x5e, 0x21, 0x25, 0xd1, 0x72, 0x22, 0x44, 0x2b, 0xa7, 0x25, 0x89, 0xe2, 0x09, 0x10,
+    0x83, 0x4a, 0xf3, 0x08, 0x0b, 0x11, 0x7b, 0x61, 0xc0, 0x5c, 0x40, 0xc4, 0xc8, 0xe6, 0x04, 0x1f,
+    0x7c, 0x3c, 0x28, 0xc2, 0xf8, 0xe2, 0xf9, 0x82, 0x70, 0x24, 0x8d, 0x88, 0x39, 0xc7, 0x64, 0x3f,
+    0xa4, 0x6d, 0x34, 0x51, 0x53, 0x74, 0x94, 0x49, 0xf1, 0xf0, 0xea, 0xb4, 0x9d, 0xc1, 0xbb, 0x67,
+    0xfb, 0x93, 0xe4, 0x2f, 0xd9, 0x87, 0xe9, 0xfe, 0xfb, 0x77, 0x10, 0xeb, 0x4b, 0x10, 0x6b, 0x7f,
+    0x07, 0xb1, 0xf6, 0x41, 0x36, 0xe3, 0x78, 0x68, 0x15, 0x7b, 0xfb, 0x0b, 0xd7, 0x83, 0x53, 0x0e,
+    0x87, 0x39, 0x68, 0x53, 0xef, 0x27, 0x01, 0x4e, 0x65, 0xd7, 0x05, 0x72, 0x4d, 0x88, 0x6e, 0x1d,
+    0xf7, 0x11, 0x8d, 0xbc, 0x63, 0x29, 0x0f, 0x1f, 0x7e, 0x17, 0xd9, 0xe8, 0x2b, 0xaf, 0x19, 0x47,
+    0x59, 0x6c, 0x69, 0x74, 0x8a, 0xe0, 0xca, 0x02, 0x5d, 0x41, 0x09, 0x8d, 0x3f, 0xcc, 0xa1, 0x6b,
+    0xef, 0xaf, 0xc9, 0x8d, 0xe0, 0x85, 0x5c, 0xa3, 0x47, 0x3e, 0xa4, 0x27, 0x5b, 0xe5, 0x78, 0x62,
+    0xa5, 0xc6, 0x81, 0xed, 0xc7, 0x1a, 0x13, 0xee, 0x81, 0x19, 0x44, 0x0b, 0x7f, 0x93, 0xa2, 0x4b,
+    0x82, 0x05, 0xc5, 0xbe, 0x8d, 0x34, 0x2d, 0x07, 0x25, 0x7c, 0x41, 0xf0, 0x7f, 0x6b, 0x8d, 0x17,
+    0x2f, 0xd2, 0x7b, 0x00, 0x00,
+};
 
-const __FlashStringHelper* WebServer::webpage_index_content = reinterpret_cast<const __FlashStringHelper*>(webpage_index_local);
+static const char webpage_index_etag_local[] PROGMEM = "\"15b7f457c0af02f7\"";
+
+const uint8_t* WebServer::webpage_index_content = webpage_index_local;
+const size_t WebServer::webpage_index_size = sizeof(webpage_index_local);
+const __FlashStringHelper* WebServer::webpage_index_etag = reinterpret_cast<const __FlashStringHelper*>(webpage_index_etag_local);
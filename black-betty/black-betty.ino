@@ -1,13 +1,16 @@
 #include <WString.h>
-#include <EasyADT7410.h>
 #include <TM1637Display.h>
 
 #include "util.h"
 #include "Settings.h"
+#include "SettingsJournal.h"
 #include "HeaterPID.h"
 #include "WebServer.h"
 #include "CommandParser.h"
 #include "Status.h"
+#include "Scheduler.h"
+#include "RelayOutput.h"
+#include "TemperatureSensor.h"
 
 static TM1637Display& get_display() {
   const Settings &settings = get_settings();
@@ -15,12 +18,6 @@ static TM1637Display& get_display() {
   return instance;
 }
 
-static ADT7410& get_sensor()
-{
-  static ADT7410 instance;
-  return instance;
-}
-
 void nextStep(const __FlashStringHelper* message) {
   if (message != nullptr) {
     Serial.println(message);
@@ -30,6 +27,107 @@ void nextStep(const __FlashStringHelper* message) {
   get_display().showNumberDecEx(++setup_step, 0, false, 4, 0);
 }
 
+// Measure temperature, the bus is only used when a conversion of the sensor is due
+static void task_sensor() {
+  Status& status = get_status();
+  TemperatureSensor& sensor = get_temperature_sensor();
+  SensorSample sample;
+  if (sensor.update() && sensor.get(0, sample)) {
+    status.temperature = sample.temperature;
+  }
+
+  status.is_heater_toggle_active = digitalRead(get_settings().heater_toggle_pin) == HIGH;
+}
+
+// Update heater
+static void task_heater() {
+  const Settings& settings = get_settings();
+  Status& status = get_status();
+  HeaterPID &heater = get_heater();
+  const TemperatureSensor& sensor = get_temperature_sensor();
+
+  // Update heater once per new sample, the relay itself is switched by the RelayOutput timer interrupt
+  static uint32_t heater_sequence = 0;
+  SensorSample sample;
+  if (sensor.get(0, sample) && sample.sequence != heater_sequence && heater.compute(sample)) {
+    heater_sequence = sample.sequence;
+  }
+
+  if (sensor.is_lost()) {
+    heater.suspend();
+  }
+
+  status.relay_switches = get_relay_output().get_switch_count();
+
+  if (!heater.is_enabled()) {
+    status.heater_mode = HeaterMode::off;
+  } else if (settings.is_countdown_mode() || !status.is_heater_toggle_active) {
+    status.heater_mode = HeaterMode::low;
+  } else {
+    status.heater_mode = HeaterMode::high;
+  }
+
+  heater.set_setpoint(status.heater_mode == HeaterMode::low ? settings.heater_temperature_low : settings.heater_temperature_high);
+}
+
+// Execute console CommandParser, it is right after the heater to be responsible if something bad happens
+static void task_console() {
+  get_command_parser().update();
+}
+
+// Update display. This is a 4 digit display, the last number is 0.1, so multiply by 10 for displaying
+static void task_display() {
+  const Settings& settings = get_settings();
+  Status& status = get_status();
+  const HeaterPID &heater = get_heater();
+
+  // Use the first dot as on/off indicator for the heater
+  const uint8_t dots = heater.is_active() ? 0b10100000 : 0b00100000;
+  if (settings.is_countdown_mode() && status.is_heater_toggle_active) {
+    int elapsed = status.update_countdown() / 100;
+    if (status.display_needs_update(elapsed, heater.is_active())) {
+      get_display().showNumberDecEx(elapsed, dots, false, 4, 0); //(number, dots, leading_zeros, length, position)
+    }
+  } else {
+    // Normal temperature mode
+    status.countdown_start = 0;
+    const int display_temperature = static_cast<int>(status.temperature * 10.0);
+    if (status.display_needs_update(display_temperature, heater.is_active())) {
+      get_display().showNumberDecEx(display_temperature, dots, false, 4, 0); //(number, dots, leading_zeros, length, position)
+    }
+  }
+}
+
+// Handle web requests and keep the wifi connected
+static void task_webserver() {
+  get_webserver().serve();
+}
+
+// The health is the busy time of the last scheduler run in ms
+static void task_history() {
+  Status& status = get_status();
+  HeaterPID &heater = get_heater();
+  status.update_history(status.temperature, heater.get_output(), heater.is_active(), get_scheduler().get_busy_time() / 1000);
+
+  // The boiler model of the warm-up learns from every closed slot, a new current slot means the last one closed
+  static int history_sequence = 0;
+  if (status.get_history(0).sequence != history_sequence) {
+    history_sequence = status.get_history(0).sequence;
+    heater.identify(status.get_history(1));
+  }
+}
+
+// Write pending settings to the flash journal
+static void task_settings() {
+  // Sector erases stall the cpu, so they wait until the relay is off
+  get_settings_journal().update(!get_relay_output().is_active());
+}
+
+// Serial status alive
+static void task_alive() {
+  get_status().sendStatus();
+}
+
 void setup()
 {
   // Serial connection
@@ -49,96 +147,55 @@ void setup()
 
   // Temperature sensor
   nextStep(F("Setting up temperature sensor..."));
-  ADT7410 &sensor = get_sensor();
-  sensor.begin();
+  get_temperature_sensor().begin();
 
   // Heater pid
   nextStep(F("Setting up header pid..."));
   HeaterPID &heater = get_heater();
   heater.set_setpoint(settings.heater_temperature_low);
 
+  // Tasks of the main loop, the lower the priority number the more important the task. They are registered
+  // before the relay starts, without the complete set the heater would regulate on stale samples
+  Scheduler &scheduler = get_scheduler();
+  bool scheduled = scheduler.add(task_sensor, 5, 0, STAGE_SENSOR);
+  scheduled &= scheduler.add(task_heater, 25, 1, STAGE_HEATER);
+  scheduled &= scheduler.add(task_console, 15, 2, STAGE_CONSOLE);
+  scheduled &= scheduler.add(task_display, 30, 3, STAGE_DISPLAY);
+  scheduled &= scheduler.add(task_webserver, 50, 4, STAGE_WEBSERVER);
+  scheduled &= scheduler.add(task_history, 5, 5, STAGE_HISTORY);
+  scheduled &= scheduler.add(task_alive, 10000, 6, STAGE_ALIVE);
+  scheduled &= scheduler.add(task_settings, 20, 7, STAGE_SETTINGS);
+  if (!scheduled) {
+    // The relay timer is not started, so the relay stays off
+    heater.disable();
+    pinMode(settings.relay_pin, OUTPUT);
+    digitalWrite(settings.relay_pin, LOW);
+    Serial.println(F("Setup failed, the scheduler has no free slot for all tasks"));
+    return;
+  }
+
   // Pins
   nextStep(F("Setting up pins..."));
   pinMode(settings.relay_pin, OUTPUT);
   pinMode(settings.heater_toggle_pin, INPUT);
+  get_relay_output().begin(settings.relay_pin);
+  get_relay_output().configure(settings);
 
-  // Setup server
-  Serial.printf("Setting up web server. Connecting to %s\n", settings.wifi_ssid);
-  nextStep(nullptr);
-  get_webserver().connect(settings.device_id, settings.wifi_ssid, settings.wifi_password, 30000);
-
-  // Activate heater pid
+  // Activate heater pid, it does not wait for the wifi
   nextStep(F("Setting up PID..."));
   heater.enable();
 
+  // Setup server, the connection is established in the background by the webserver task
+  Serial.printf("Setting up web server. Connecting to %s\n", settings.wifi_ssid);
+  nextStep(nullptr);
+  get_webserver().begin(settings.device_id, settings.wifi_ssid, settings.wifi_password);
+
   delay(100);
+
   Serial.println("Setup successful");
 }
 
 void loop() {
-  unsigned long start = millis();
-  const Settings& settings = get_settings();
-  Status& status = get_status();
-  HeaterPID &heater = get_heater();
-
-  // Execute console CommandParser first to be responsible if something bad happens after this
-  if (status.console_timer.next()) {
-    get_command_parser().update();
-  }
-
-  // Measure temperature
-  double temperature = get_sensor().readTemperature(); // 50.0 + static_cast<double>(rand() % 10); 
-  status.temperature = temperature;
-  status.is_heater_toggle_active = digitalRead(settings.heater_toggle_pin) == HIGH;
-
-  // Update heater
-  if (status.heater_timer.next()) {
-    // Update heater rely
-    heater.compute(temperature);
-    digitalWrite(settings.relay_pin, heater.is_active() ? HIGH : LOW);
-    
-    if (!heater.is_enabled()) {
-      status.heater_mode = HeaterMode::off;
-    } else if (settings.is_countdown_mode() || !status.is_heater_toggle_active) {
-      status.heater_mode = HeaterMode::low;
-    } else {
-      status.heater_mode = HeaterMode::high;
-    }
-
-    heater.set_setpoint(status.heater_mode == HeaterMode::low ? settings.heater_temperature_low : settings.heater_temperature_high);
-  }
-
-  // Update display. This is a 4 digit display, the last number is 0.1, so multiply by 10 for displaying
-  if (status.display_timer.next()) {
-    // Use the first dot as on/off indicator for the heater
-    const uint8_t dots = heater.is_active() ? 0b10100000 : 0b00100000;
-    if (settings.is_countdown_mode() && status.is_heater_toggle_active) {
-      int elapsed = status.update_countdown() / 100;
-      if (status.display_needs_update(elapsed, heater.is_active())) {
-        get_display().showNumberDecEx(elapsed, dots, false, 4, 0); //(number, dots, leading_zeros, length, position)
-      }
-    } else {
-      // Normal temperature mode
-      status.countdown_start = 0;
-      const int display_temperature = static_cast<int>(status.temperature * 10.0);
-      if (status.display_needs_update(display_temperature, heater.is_active())) {
-        get_display().showNumberDecEx(display_temperature, dots, false, 4, 0); //(number, dots, leading_zeros, length, position)
-      }
-    }
-  }
-
-  // Handle web requests
-  if (status.webserver_timer.next()) {
-    get_webserver().serve();
-  }
-
-  // Serial status alive
-  if (status.alive_timer.next()) {
-    status.sendStatus();
-  }
-
-  status.update_history(temperature, heater.get_output(), heater.is_active(), static_cast<double>(millis() - start));
-
-  // Wait a nick of time
-  delay(5);
+  // Runs the due tasks and sleeps until the next one is due
+  get_scheduler().run();
 }
@@ -195,18 +195,23 @@ char* json_add_property(char* pos, const __FlashStringHelper* name, bool value,
   return json_add_postfix(pos, add_comma);
 }
 
-char* json_add_counter(char* pos, const StatCounter& counter, bool first, int samples) {
+// Milli units are rendered without any floating point math, clamped to the range of the double counters
+char* json_add_milli(char* pos, int32_t value) {
+  return json_add(pos, static_cast<int>(clamp<int32_t>(value, -99999, 999999)), 3);
+}
+
+char* json_add_counter(char* pos, const MilliCounter& counter, bool first, int samples) {
   if (!first) {
   *(pos++) = ',';
   }
-    pos = json_add(pos, counter.current, -99.999, 999.999);
+    pos = json_add_milli(pos, counter.current);
     *(pos++) = ',';
-    pos = json_add(pos, counter.min, -99.999, 999.999);
+    pos = json_add_milli(pos, counter.min);
     *(pos++) = ',';
-    pos = json_add(pos, counter.max, -99.999, 999.999);
+    pos = json_add_milli(pos, counter.max);
     *(pos++) = ',';
     if (samples > 0) {
-      pos = json_add(pos, counter.sum / static_cast<double>(samples), -99.999, 999.999);
+      pos = json_add_milli(pos, static_cast<int32_t>(counter.sum / samples));
     } else {
       *(pos++) = '0';
       *(pos++) = '.';
@@ -216,6 +221,23 @@ char* json_add_counter(char* pos, const StatCounter& counter, bool first, int sa
     return pos;
 }
 
+// Same layout as json_add_counter, compact counters have no current value so the average is used. The int16 values
+// are not clamped like the live counters, so the output of a long heater window (up to 65534 ms) is kept
+char* json_add_compact_counter(char* pos, const CompactCounter& counter, bool first, double scale) {
+  if (!first) {
+    *(pos++) = ',';
+  }
+
+  const double average = static_cast<double>(counter.average) / scale;
+  pos = json_add(pos, average);
+  *(pos++) = ',';
+  pos = json_add(pos, static_cast<double>(counter.min) / scale);
+  *(pos++) = ',';
+  pos = json_add(pos, static_cast<double>(counter.max) / scale);
+  *(pos++) = ',';
+  return json_add(pos, average);
+}
+
 char* json_add_array_item(char* pos, int value, bool first) {
   if (!first) {
     *(pos++) = ',';
@@ -230,6 +252,57 @@ char* double_to_string(char* output, double value) {
   return output;
 }
 
+uint16_t crc16(const uint8_t* data, size_t size, uint16_t crc) {
+  while (size-- > 0) {
+    crc ^= static_cast<uint16_t>(*(data++)) << 8;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) != 0 ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+    }
+  }
+
+  return crc;
+}
+
+uint8_t* binary_add_u8(uint8_t* pos, uint8_t value) {
+  *(pos++) = value;
+  return pos;
+}
+
+uint8_t* binary_add_u16(uint8_t* pos, uint16_t value) {
+  *(pos++) = static_cast<uint8_t>(value);
+  *(pos++) = static_cast<uint8_t>(value >> 8);
+  return pos;
+}
+
+uint8_t* binary_add_i32(uint8_t* pos, int32_t value) {
+  const uint32_t bits = static_cast<uint32_t>(value);
+  *(pos++) = static_cast<uint8_t>(bits);
+  *(pos++) = static_cast<uint8_t>(bits >> 8);
+  *(pos++) = static_cast<uint8_t>(bits >> 16);
+  *(pos++) = static_cast<uint8_t>(bits >> 24);
+  return pos;
+}
+
+uint8_t* binary_add_milli(uint8_t* pos, double value) {
+  return binary_add_i32(pos, static_cast<int32_t>(value * 1000.0));
+}
+
+// Fixed size and zero padded, the last byte is always zero
+uint8_t* binary_add_string(uint8_t* pos, const char* value, size_t size) {
+  size_t length = strnlen(value, size - 1);
+  memcpy(pos, value, length);
+  memset(pos + length, 0, size - length);
+  return pos + size;
+}
+
+// Current, min, max and average
+uint8_t* binary_add_counter(uint8_t* pos, const MilliCounter& counter, int samples) {
+  pos = binary_add_i32(pos, counter.current);
+  pos = binary_add_i32(pos, counter.min);
+  pos = binary_add_i32(pos, counter.max);
+  return binary_add_i32(pos, samples > 0 ? static_cast<int32_t>(counter.sum / samples) : 0);
+}
+
 char* copy_flash_string(char* output, const __FlashStringHelper* source_flash, size_t count) {
   // Casting to char here enables pointer arimetrics
   const char* source = reinterpret_cast<const char*>(source_flash);
@@ -246,3 +319,87 @@ char* copy_flash_string(char* output, const __FlashStringHelper* source_flash, s
   *output = 0x00;
   return output;
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// JsonStream
+JsonStream::JsonStream(char* buffer, size_t size, FlushFunction flush) : buffer(buffer), end(buffer + size), pos(buffer), flush_function(flush), flushed(0) {
+}
+
+void JsonStream::reserve(size_t size) {
+  if (this->pos + size > this->end) {
+    this->flush();
+  }
+}
+
+void JsonStream::flush() {
+  if (this->pos > this->buffer) {
+    this->flush_function(this->buffer, static_cast<size_t>(this->pos - this->buffer));
+    this->flushed += static_cast<size_t>(this->pos - this->buffer);
+    this->pos = this->buffer;
+  }
+}
+
+size_t JsonStream::get_size() const {
+  return this->flushed + static_cast<size_t>(this->pos - this->buffer);
+}
+
+void JsonStream::add(const __FlashStringHelper* source_flash) {
+  // Casting to char here enables pointer arimetrics, strings may be longer than the buffer so copy them char by char
+  const char* source = reinterpret_cast<const char*>(source_flash);
+
+  char c;
+  while ((c = static_cast<char>(pgm_read_byte_near(source++))) != 0x00) {
+    this->reserve(1);
+    *(this->pos++) = c;
+  }
+}
+
+void JsonStream::add(const char* source) {
+  while (*source != 0x00) {
+    this->reserve(1);
+    *(this->pos++) = *(source++);
+  }
+}
+
+void JsonStream::add(int value) {
+  this->reserve(JSON_STREAM_ITEM_SIZE);
+  this->pos = json_add(this->pos, value);
+}
+
+void JsonStream::add_property(const __FlashStringHelper* name, const char* value, bool add_comma) {
+  this->add(F("\""));
+  this->add(name);
+  this->add(F("\":\""));
+  this->add(value);
+  this->add(add_comma ? F("\",") : F("\""));
+}
+
+void JsonStream::add_property(const __FlashStringHelper* name, int value, bool add_comma) {
+  this->reserve(strlen_P(reinterpret_cast<const char*>(name)) + JSON_STREAM_ITEM_SIZE);
+  this->pos = json_add_property(this->pos, name, value, add_comma);
+}
+
+void JsonStream::add_property(const __FlashStringHelper* name, double value, bool add_comma) {
+  this->reserve(strlen_P(reinterpret_cast<const char*>(name)) + JSON_STREAM_ITEM_SIZE);
+  this->pos = json_add_property(this->pos, name, value, add_comma);
+}
+
+void JsonStream::add_property(const __FlashStringHelper* name, bool value, bool add_comma) {
+  this->reserve(strlen_P(reinterpret_cast<const char*>(name)) + JSON_STREAM_ITEM_SIZE);
+  this->pos = json_add_property(this->pos, name, value, add_comma);
+}
+
+void JsonStream::add_counter(const MilliCounter& counter, bool first, int samples) {
+  this->reserve(JSON_STREAM_ITEM_SIZE);
+  this->pos = json_add_counter(this->pos, counter, first, samples);
+}
+
+void JsonStream::add_compact_counter(const CompactCounter& counter, bool first, double scale) {
+  this->reserve(JSON_STREAM_ITEM_SIZE);
+  this->pos = json_add_compact_counter(this->pos, counter, first, scale);
+}
+
+void JsonStream::add_array_item(int value, bool first) {
+  this->reserve(JSON_STREAM_ITEM_SIZE);
+  this->pos = json_add_array_item(this->pos, value, first);
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <stddef.h>
+#include <stdint.h>
 
 // Get the size of an array without hardcoding numbers. Way back this was a macro, now it seems to be done via constexpr
 template <size_t N, class T> static constexpr size_t array_size(T (&)[N]) { return N; }
@@ -11,7 +12,9 @@ template<typename T> inline T clamp(T value, T min, T max) {
 // Tokenizes a string seperated by space including quote support
 int tokenize(const char* source, char* dest, const int dest_count, char** token, const int token_count);
 
-class StatCounter;
+template <typename T, typename S> class BasicStatCounter;
+typedef BasicStatCounter<int32_t, int64_t> MilliCounter;
+struct CompactCounter;
 class __FlashStringHelper;
 
 // Json support
@@ -23,10 +26,63 @@ char* json_add_property(char* pos, const __FlashStringHelper* name, const char*
 char* json_add_property(char* pos, const __FlashStringHelper* name, int value, bool add_comma);
 char* json_add_property(char* pos, const __FlashStringHelper* name, double value, bool add_comma);
 char* json_add_property(char* pos, const __FlashStringHelper* name, bool value, bool add_comma);
-char* json_add_counter(char* pos, const StatCounter& counter, bool first, int samples);
+char* json_add_counter(char* pos, const MilliCounter& counter, bool first, int samples);
+char* json_add_compact_counter(char* pos, const CompactCounter& counter, bool first, double scale);
 char* json_add_array_item(char* pos, int value, bool first);
+char* json_add_milli(char* pos, int32_t value);
 
 char* double_to_string(char* output, double value);
 
+// CRC-16/CCITT-FALSE, pass the previous result as crc to continue over several blocks
+uint16_t crc16(const uint8_t* data, size_t size, uint16_t crc = 0xFFFF);
+
+// Little endian binary support, the counterpart to the json helpers. Doubles are written as int32 milli units
+uint8_t* binary_add_u8(uint8_t* pos, uint8_t value);
+uint8_t* binary_add_u16(uint8_t* pos, uint16_t value);
+uint8_t* binary_add_i32(uint8_t* pos, int32_t value);
+uint8_t* binary_add_milli(uint8_t* pos, double value);
+uint8_t* binary_add_string(uint8_t* pos, const char* value, size_t size);
+uint8_t* binary_add_counter(uint8_t* pos, const MilliCounter& counter, int samples);
+
+// Streams json through a small chunk buffer using the json_add helpers. The buffer is flushed before an item could
+// overflow it, so the buffer size limits only the memory usage and not the size of the json
+constexpr size_t JSON_STREAM_ITEM_SIZE = 64;
+
+class JsonStream {
+public:
+    typedef void (*FlushFunction)(const char* data, size_t size);
+
+    // The buffer needs to hold at least JSON_STREAM_ITEM_SIZE bytes
+    JsonStream(char* buffer, size_t size, FlushFunction flush);
+    JsonStream(const JsonStream&) = delete;
+    JsonStream& operator=(const JsonStream&) = delete;
+
+    void add(const __FlashStringHelper* source_flash);
+    void add(const char* source);
+    void add(int value);
+    void add_property(const __FlashStringHelper* name, const char* value, bool add_comma);
+    void add_property(const __FlashStringHelper* name, int value, bool add_comma);
+    void add_property(const __FlashStringHelper* name, double value, bool add_comma);
+    void add_property(const __FlashStringHelper* name, bool value, bool add_comma);
+    void add_counter(const MilliCounter& counter, bool first, int samples);
+    void add_compact_counter(const CompactCounter& counter, bool first, double scale);
+    void add_array_item(int value, bool first);
+
+    // Sends the remaining buffer content
+    void flush();
+
+    // Number of bytes streamed so far
+    size_t get_size() const;
+
+private:
+    char* buffer;
+    char* end;
+    char* pos;
+    FlushFunction flush_function;
+    size_t flushed;
+
+    void reserve(size_t size);
+};
+
 // Flash string helper
 char* copy_flash_string(char* output, const __FlashStringHelper* source_flash, size_t count);